@@ -0,0 +1,80 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_models.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+//
+// Parametric Minibex models shared by the benchmarks.
+//
+// Each generator writes a system of size n in the stream f (the file
+// is then loaded with System(filename)).
+//
+//============================================================================
+
+#ifndef __IBEX_BENCH_MODELS_H__
+#define __IBEX_BENCH_MODELS_H__
+
+#include <algorithm>
+#include <fstream>
+
+/*
+ * Discretized Bratu problem: n explicit constraints, each
+ * involving 3 variables (tridiagonal Jacobian).
+ *
+ * If minimize is true, the sum of squares of the
+ * variables is added as objective.
+ */
+inline void bratu(std::ofstream& f, int n, bool minimize) {
+	f << "Constants\n  h=1/" << (n+1)*(n+1) << ";\n\n";
+	f << "Variables\n  x[" << n << "] in [-1e8,20];\n\n";
+	if (minimize)
+		f << "Minimize sum(i=1:" << n << ", x(i)^2);\n\n";
+	f << "Constraints\n";
+	for (int i=1; i<=n; i++) {
+		f << "  h*exp(x(" << i << "))";
+		if (i>1) f << " + x(" << i-1 << ")";
+		f << " - 2*x(" << i << ")";
+		if (i<n) f << " + x(" << i+1 << ")";
+		f << " = 0;\n";
+	}
+	f << "end\n";
+}
+
+inline void bratu(std::ofstream& f, int n) {
+	bratu(f,n,false);
+}
+
+/*
+ * Broyden banded function: n explicit constraints, each
+ * involving up to 7 variables.
+ */
+inline void banded(std::ofstream& f, int n) {
+	f << "Variables\n  x[" << n << "] in [-1,1];\n\n";
+	f << "Constraints\n";
+	for (int i=1; i<=n; i++) {
+		f << "  x(" << i << ")*(2+5*x(" << i << ")^2) + 1";
+		for (int j=std::max(1,i-5); j<=std::min(n,i+1); j++)
+			if (j!=i) f << " - x(" << j << ")*(1+x(" << j << "))";
+		f << " = 0;\n";
+	}
+	f << "end\n";
+}
+
+/*
+ * Nested transcendental terms: n inequalities, each
+ * involving 2 variables.
+ */
+inline void trig(std::ofstream& f, int n) {
+	f << "Variables\n  x[" << n << "] in [-1,1];\n\n";
+	f << "Constraints\n";
+	for (int i=1; i<=n; i++) {
+		int j=i%n+1;
+		f << "  exp(sin(x(" << i << ")+x(" << j << ")))*sqrt(1+cos(x(" << i << "))^2)"
+		  << " + tanh(x(" << i << ")*x(" << j << ")) <= 2;\n";
+	}
+	f << "end\n";
+}
+
+#endif // __IBEX_BENCH_MODELS_H__
@@ -0,0 +1,120 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_builder.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+//
+// Compares three ways of building a large system generated by code:
+//
+// - minibex:   the model is printed in Minibex in a temporary file which
+//              is then loaded with System(filename);
+// - operators: the constraints are built with the operators of ExprNode
+//              and added with SystemFactory::add_ctr;
+// - builder:   the constraints are recorded with an ExprBuilder.
+//
+// The model is the discretized Bratu problem with n variables and n
+// constraints (about 10 nodes per constraint). For each path, the total
+// time until the System object is built is reported, as well as the number
+// of nodes of the system function (smaller with the builder, where the
+// terms that appear in several constraints, like 2*x(i), are shared).
+//
+// Usage: benchmark_builder [n]   (default: 100000, i.e., ~10^6 nodes)
+//
+// Compile with:
+//   g++ -O3 -frounding-math benchmark_builder.cpp -o benchmark_builder `pkg-config --cflags --libs ibex`
+//
+//============================================================================
+
+#include "ibex.h"
+#include "bench_models.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+const char* filename = "benchmark_builder.tmp.bch";
+
+void report(const char* path, const System& sys, double time) {
+	cout << setw(10) << path << setw(12) << sys.f_ctrs.nodes.size()
+		 << fixed << setprecision(3) << setw(10) << time << endl;
+}
+
+void minibex(int n) {
+	Timer timer;
+	timer.start();
+	{
+		ofstream f(filename);
+		bratu(f,n);
+	}
+	System sys(filename);
+	timer.stop();
+	report("minibex", sys, timer.get_time());
+	remove(filename);
+}
+
+void operators(int n) {
+	Interval h=1.0/Interval((n+1)*(n+1));
+
+	Timer timer;
+	timer.start();
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(n));
+	SystemFactory fac;
+	fac.add_var(x, IntervalVector(n,Interval(-1e8,20)));
+	for (int i=0; i<n; i++) {
+		const ExprNode* e=&(h*exp(x[i]));
+		if (i>0) e=&(*e+x[i-1]);
+		e=&(*e-2*x[i]);
+		if (i<n-1) e=&(*e+x[i+1]);
+		fac.add_ctr(*e=0);
+	}
+	System sys(fac);
+	timer.stop();
+	report("operators", sys, timer.get_time());
+}
+
+void builder(int n) {
+	Interval h=1.0/Interval((n+1)*(n+1));
+
+	Timer timer;
+	timer.start();
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(n));
+	SystemFactory fac;
+	fac.add_var(x, IntervalVector(n,Interval(-1e8,20)));
+	ExprBuilder b(fac);
+	ExprBuilder::Node two=b.cst(2);
+	ExprBuilder::Node ch=b.cst(h);
+	for (int i=0; i<n; i++) {
+		ExprBuilder::Node e=b.mul(ch,b.exp(b.var(x,i)));
+		if (i>0) e=b.add(e,b.var(x,i-1));
+		e=b.sub(e,b.mul(two,b.var(x,i)));
+		if (i<n-1) e=b.add(e,b.var(x,i+1));
+		b.add_ctr(e,EQ);
+	}
+	System sys(fac);
+	timer.stop();
+	report("builder", sys, timer.get_time());
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 100000;
+
+	cout << "bratu n=" << n << " (times in seconds)" << endl;
+	cout << setw(10) << "path" << setw(12) << "nodes" << setw(10) << "time" << endl;
+
+	minibex(n);
+	operators(n);
+	builder(n);
+
+	return 0;
+}
@@ -0,0 +1,174 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_capi.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+//
+// Compares the throughput of the C interface (see ibex_CApi.h) with the
+// C++ interface, on small boxes.
+//
+// The system is the Broyden banded function with n variables. For each
+// operation (evaluation, jacobian and HC4 contraction), the following are
+// reported, in calls per second (in thousands): the C++ interface (with an
+// IntervalVector built from the bounds and a result returned by value, as
+// done by bindings), the C interface with one box per call and the C
+// interface with batches of 1000 boxes.
+//
+// Usage: benchmark_capi [n]
+//
+// Compile with:
+//   g++ -O3 -frounding-math benchmark_capi.cpp -o benchmark_capi `pkg-config --cflags --libs ibex`
+//
+//============================================================================
+
+#include "ibex.h"
+#include "bench_models.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+const char* filename = "benchmark_capi.tmp.bch";
+
+// number of boxes
+const int nb_box = 1000;
+
+// number of times the boxes are processed
+const int nb_rounds = 20;
+
+/*
+ * Thousands of calls per second.
+ */
+double rate(Timer& timer) {
+	return nb_box*nb_rounds/timer.get_time()/1e3;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 10;
+
+	{
+		ofstream f(filename);
+		banded(f,n);
+	}
+
+	System sys(filename);
+	ibex_system* csys=ibex_system_load(filename);
+	ibex_function* f=ibex_system_ctrs(csys);
+	ibex_ctc* hc4=ibex_ctc_hc4(csys);
+	CtcHC4 ctc(sys);
+
+	// random small boxes
+	vector<double> lb(nb_box*n), ub(nb_box*n);
+	for (int i=0; i<nb_box*n; i++) {
+		lb[i]=-1+2*((double) rand())/RAND_MAX;
+		ub[i]=lb[i]+0.01;
+	}
+
+	vector<double> ylb(nb_box*n*n), yub(nb_box*n*n);
+	vector<double> blb(nb_box*n), bub(nb_box*n);
+
+	Timer timer;
+
+	cout << "n=" << n << " (thousands of calls per second)" << endl;
+	cout << setw(10) << "" << setw(10) << "C++" << setw(10) << "C" << setw(10) << "C(batch)" << endl;
+	cout << fixed << setprecision(1);
+
+	//============================= eval ================================
+	timer.restart();
+	for (int r=0; r<nb_rounds; r++)
+		for (int k=0; k<nb_box; k++) {
+			IntervalVector box(n);
+			for (int i=0; i<n; i++) box[i]=Interval(lb[k*n+i],ub[k*n+i]);
+			IntervalVector y=sys.f_ctrs.eval_vector(box);
+			for (int i=0; i<n; i++) { ylb[k*n+i]=y[i].lb(); yub[k*n+i]=y[i].ub(); }
+		}
+	timer.stop();
+	cout << setw(10) << "eval" << setw(10) << rate(timer);
+
+	timer.restart();
+	for (int r=0; r<nb_rounds; r++)
+		for (int k=0; k<nb_box; k++)
+			ibex_function_eval(f,1,&lb[k*n],&ub[k*n],&ylb[k*n],&yub[k*n]);
+	timer.stop();
+	cout << setw(10) << rate(timer);
+
+	timer.restart();
+	for (int r=0; r<nb_rounds; r++)
+		ibex_function_eval(f,nb_box,&lb[0],&ub[0],&ylb[0],&yub[0]);
+	timer.stop();
+	cout << setw(10) << rate(timer) << endl;
+
+	//============================= jacobian ================================
+	timer.restart();
+	for (int r=0; r<nb_rounds; r++)
+		for (int k=0; k<nb_box; k++) {
+			IntervalVector box(n);
+			for (int i=0; i<n; i++) box[i]=Interval(lb[k*n+i],ub[k*n+i]);
+			IntervalMatrix J=sys.f_ctrs.jacobian(box);
+			for (int i=0; i<n; i++)
+				for (int j=0; j<n; j++) { ylb[(k*n+i)*n+j]=J[i][j].lb(); yub[(k*n+i)*n+j]=J[i][j].ub(); }
+		}
+	timer.stop();
+	cout << setw(10) << "jacobian" << setw(10) << rate(timer);
+
+	timer.restart();
+	for (int r=0; r<nb_rounds; r++)
+		for (int k=0; k<nb_box; k++)
+			ibex_function_jacobian(f,1,&lb[k*n],&ub[k*n],&ylb[k*n*n],&yub[k*n*n]);
+	timer.stop();
+	cout << setw(10) << rate(timer);
+
+	timer.restart();
+	for (int r=0; r<nb_rounds; r++)
+		ibex_function_jacobian(f,nb_box,&lb[0],&ub[0],&ylb[0],&yub[0]);
+	timer.stop();
+	cout << setw(10) << rate(timer) << endl;
+
+	//============================= HC4 ================================
+	timer.restart();
+	for (int r=0; r<nb_rounds; r++)
+		for (int k=0; k<nb_box; k++) {
+			IntervalVector box(n);
+			for (int i=0; i<n; i++) box[i]=Interval(lb[k*n+i],ub[k*n+i]);
+			ctc.contract(box);
+			for (int i=0; i<n; i++) { blb[k*n+i]=box[i].lb(); bub[k*n+i]=box[i].ub(); }
+		}
+	timer.stop();
+	cout << setw(10) << "hc4" << setw(10) << rate(timer);
+
+	timer.restart();
+	for (int r=0; r<nb_rounds; r++) {
+		blb=lb; bub=ub;
+		for (int k=0; k<nb_box; k++)
+			ibex_ctc_contract(hc4,1,&blb[k*n],&bub[k*n],NULL);
+	}
+	timer.stop();
+	cout << setw(10) << rate(timer);
+
+	timer.restart();
+	for (int r=0; r<nb_rounds; r++) {
+		blb=lb; bub=ub;
+		ibex_ctc_contract(hc4,nb_box,&blb[0],&bub[0],NULL);
+	}
+	timer.stop();
+	cout << setw(10) << rate(timer) << endl;
+
+	ibex_ctc_free(hc4);
+	ibex_system_free(csys);
+
+	remove(filename);
+
+	return 0;
+}
@@ -0,0 +1,98 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_diff.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+//
+// Measures the symbolic differentiation of the constraints of systems of
+// growing size (see Function::diff()).
+//
+// For each size, the following are reported: the number of nodes of the
+// function and of its differential, the time of the differentiation (which
+// includes simplification), the time of compiling the differential and the
+// time of evaluating it (20 times) on the initial box.
+//
+// Usage: benchmark_diff [bratu|banded|trig] [max size] [min size]
+//
+// Compile with:
+//   g++ -O3 -frounding-math benchmark_diff.cpp -o benchmark_diff `pkg-config --cflags --libs ibex`
+//
+//============================================================================
+
+#include "ibex.h"
+#include "bench_models.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+const char* filename = "benchmark_diff.tmp.bch";
+
+}
+
+int main(int argc, char** argv) {
+
+	const char* model = argc>1 ? argv[1] : "bratu";
+	int max_size = argc>2 ? atoi(argv[2]) : 2000;
+	int min_size = argc>3 ? atoi(argv[3]) : 250;
+
+	void (*generate)(ofstream&, int);
+
+	if (strcmp(model,"bratu")==0)       generate = bratu;
+	else if (strcmp(model,"banded")==0) generate = banded;
+	else if (strcmp(model,"trig")==0)   generate = trig;
+	else {
+		cerr << "unknown model \"" << model << "\" (must be bratu, banded or trig)" << endl;
+		return -1;
+	}
+
+	cout << model << " (times in seconds)" << endl;
+	cout << setw(8) << "size" << setw(10) << "nodes(f)" << setw(10) << "nodes(df)"
+		 << setw(10) << "diff" << setw(10) << "compile" << setw(10) << "eval" << endl;
+
+	for (int n=min_size; n<=max_size; n*=2) {
+		{
+			ofstream f(filename);
+			generate(f,n);
+		}
+
+		System sys(filename);
+		const Function& f=sys.f_ctrs;
+
+		Array<const ExprSymbol> x(f.nb_arg());
+		varcopy(f.args(),x);
+
+		Timer timer;
+		timer.start();
+		const ExprNode& d=ExprDiff(f.args(),x).diff(f.expr(),f.args());
+		timer.stop();
+		double diff_time = timer.get_time();
+
+		timer.restart();
+		Function df(x,d);
+		timer.stop();
+		double compile_time = timer.get_time();
+
+		timer.restart();
+		for (int i=0; i<20; i++)
+			df.eval_matrix(sys.box);
+		timer.stop();
+
+		cout << setw(8) << n << setw(10) << f.nodes.size() << setw(10) << df.nodes.size()
+			 << fixed << setprecision(3) << setw(10) << diff_time << setw(10) << compile_time
+			 << setw(10) << timer.get_time() << endl;
+	}
+
+	remove(filename);
+
+	return 0;
+}
@@ -0,0 +1,120 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_eval.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+//
+// Measures the throughput of the compiled functions of systems of growing
+// size (see CompiledFunction).
+//
+// For each size, the following are reported: the number of nodes of the
+// system function, and the number of nodes processed per second (in millions)
+// by a forward evaluation (Function::eval_vector), a forward-backward
+// contraction (Function::backward) and a gradient calculation (done for
+// every constraint, Function::gradient).
+//
+// Usage: benchmark_eval [bratu|banded|trig] [max size] [min size]
+//
+// Compile with:
+//   g++ -O3 -frounding-math benchmark_eval.cpp -o benchmark_eval `pkg-config --cflags --libs ibex`
+//
+//============================================================================
+
+#include "ibex.h"
+#include "bench_models.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+const char* filename = "benchmark_eval.tmp.bch";
+
+// minimal time of a measure (in seconds)
+const double min_time = 0.5;
+
+/*
+ * Millions of nodes per second processed by "run" (on
+ * a function of "nodes" nodes), repeated at least min_time.
+ */
+double throughput(long nodes, void (*run)(const System&), const System& sys) {
+	Timer timer;
+	long reps=0;
+	timer.start();
+	do {
+		run(sys);
+		reps++;
+	} while (timer.get_time()<min_time);
+	timer.stop();
+	return ((double) nodes)*reps/timer.get_time()/1e6;
+}
+
+void eval(const System& sys) {
+	sys.f_ctrs.eval_vector(sys.box);
+}
+
+void backward(const System& sys) {
+	IntervalVector box(sys.box);
+	IntervalVector y(sys.nb_ctr,Interval::zero());
+	sys.f_ctrs.backward(y,box);
+}
+
+void gradient(const System& sys) {
+	IntervalVector g(sys.nb_var);
+	for (int i=0; i<sys.nb_ctr; i++)
+		sys.ctrs[i].f.gradient(sys.box,g);
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	const char* model = argc>1 ? argv[1] : "bratu";
+	int max_size = argc>2 ? atoi(argv[2]) : 16000;
+	int min_size = argc>3 ? atoi(argv[3]) : 1000;
+
+	void (*generate)(ofstream&, int);
+
+	if (strcmp(model,"bratu")==0)       generate = bratu;
+	else if (strcmp(model,"banded")==0) generate = banded;
+	else if (strcmp(model,"trig")==0)   generate = trig;
+	else {
+		cerr << "unknown model \"" << model << "\" (must be bratu, banded or trig)" << endl;
+		return -1;
+	}
+
+	cout << model << " (millions of nodes per second)" << endl;
+	cout << setw(8) << "size" << setw(10) << "nodes" << setw(10) << "eval"
+		 << setw(10) << "backward" << setw(10) << "gradient" << endl;
+
+	for (int n=min_size; n<=max_size; n*=2) {
+		{
+			ofstream f(filename);
+			generate(f,n);
+		}
+
+		System sys(filename);
+
+		long nodes=sys.f_ctrs.nodes.size();
+		long ctr_nodes=0;
+		for (int i=0; i<sys.nb_ctr; i++)
+			ctr_nodes+=sys.ctrs[i].f.nodes.size();
+
+		cout << setw(8) << n << setw(10) << nodes << fixed << setprecision(2)
+			 << setw(10) << throughput(nodes, eval, sys)
+			 << setw(10) << throughput(nodes, backward, sys)
+			 << setw(10) << throughput(ctr_nodes, gradient, sys) << endl;
+	}
+
+	remove(filename);
+
+	return 0;
+}
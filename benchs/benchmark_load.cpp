@@ -0,0 +1,167 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_load.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+//
+// Measures the time of loading Minibex systems of growing size.
+//
+// Parametric models are generated in a temporary file and loaded with
+// System(filename). The time of each phase (parsing, simplification,
+// compilation of the functions and construction of the system) is given
+// by System::load_times. The time of loading the same system saved in
+// binary format (see System::save) is also reported, as well as the
+// startup time of each derived system built by a solver or an optimizer:
+// the normalized system, the extended system and, if the system has a
+// goal, the KKT contractor (construction and first contraction on the
+// initial box) and the default optimizer.
+//
+// The constraints are simplified and compiled by [threads] threads
+// (see SystemFactory::default_nb_threads). As the times given by Timer
+// are processor times (added over all the threads), the elapsed
+// (wall-clock) time of the loading is also reported.
+//
+// Usage: benchmark_load [bratu|banded|loop|optim] [max size] [min size] [threads]
+//
+// Compile with:
+//   g++ -O3 -frounding-math benchmark_load.cpp -o benchmark_load `pkg-config --cflags --libs ibex`
+//
+//============================================================================
+
+#include "ibex.h"
+#include "bench_models.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+const char* filename = "benchmark_load.tmp.bch";
+const char* binfilename = "benchmark_load.tmp.bin";
+
+/*
+ * Same as bratu but the constraints are generated by a loop.
+ */
+void loop(ofstream& f, int n) {
+	f << "Constants\n  n=" << n << ";\n  h=1/" << (n+1)*(n+1) << ";\n\n";
+	f << "Variables\n  x[n] in [-1e8,20];\n\n";
+	f << "Constraints\n";
+	f << "  h*exp(x(1)) - 2*x(1) + x(2) = 0;\n";
+	f << "  for i=2:n-1;\n";
+	f << "    h*exp(x(i)) + x(i-1) - 2*x(i) + x(i+1) = 0;\n";
+	f << "  end;\n";
+	f << "  h*exp(x(n)) + x(n-1) - 2*x(n) = 0;\n";
+	f << "end\n";
+}
+
+/*
+ * Same as bratu with an objective to minimize.
+ */
+void optim(ofstream& f, int n) {
+	bratu(f,n,true);
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	const char* model = argc>1 ? argv[1] : "bratu";
+	int max_size = argc>2 ? atoi(argv[2]) : 8000;
+	int min_size = argc>3 ? atoi(argv[3]) : 1000;
+	int nb_threads = argc>4 ? atoi(argv[4]) : 1;
+
+	void (*generate)(ofstream&, int);
+
+	if (strcmp(model,"bratu")==0)       generate = bratu;
+	else if (strcmp(model,"banded")==0) generate = banded;
+	else if (strcmp(model,"loop")==0)   generate = loop;
+	else if (strcmp(model,"optim")==0)  generate = optim;
+	else {
+		cerr << "unknown model \"" << model << "\" (must be bratu, banded, loop or optim)" << endl;
+		return -1;
+	}
+
+	if (nb_threads<=0) {
+		cerr << "the number of threads must be positive" << endl;
+		return -1;
+	}
+
+	SystemFactory::default_nb_threads = nb_threads;
+
+	cout << model << ", " << nb_threads << " thread(s) (times in seconds)" << endl;
+	cout << setw(8) << "size" << setw(10) << "parse" << setw(10) << "simplify"
+		 << setw(10) << "compile" << setw(10) << "build" << setw(10) << "total"
+		 << setw(10) << "wall" << setw(10) << "binary" << setw(10) << "normalize" << setw(10) << "extend"
+		 << setw(10) << "kkt" << setw(10) << "optimizer" << endl;
+
+	for (int n=min_size; n<=max_size; n*=2) {
+		{
+			ofstream f(filename);
+			generate(f,n);
+		}
+
+		Timer timer;
+		timer.start();
+		chrono::steady_clock::time_point start=chrono::steady_clock::now();
+		System sys(filename);
+		double wall = chrono::duration<double>(chrono::steady_clock::now()-start).count();
+		timer.stop();
+		double total = timer.get_time();
+
+		sys.save(binfilename);
+		timer.restart();
+		System sys2(binfilename);
+		timer.stop();
+		double binary = timer.get_time();
+
+		timer.restart();
+		NormalizedSystem norm(sys,NormalizedSystem::default_eps_h);
+		timer.stop();
+		double normalize = timer.get_time();
+
+		timer.restart();
+		ExtendedSystem ext(sys,ExtendedSystem::default_eps_h);
+		timer.stop();
+		double extend = timer.get_time();
+
+		const System::LoadTimes& t = sys.load_times;
+		cout << setw(8) << n << fixed << setprecision(3)
+			 << setw(10) << t.parse << setw(10) << t.simplify
+			 << setw(10) << t.compile << setw(10) << t.build
+			 << setw(10) << total << setw(10) << wall << setw(10) << binary
+			 << setw(10) << normalize << setw(10) << extend;
+
+		if (sys.goal) {
+			timer.restart();
+			CtcKuhnTucker kkt(norm,false);
+			IntervalVector box(ext.nb_var);
+			box.put(0,sys.box);
+			kkt.contract(box);
+			timer.stop();
+			cout << setw(10) << timer.get_time();
+
+			timer.restart();
+			DefaultOptimizerConfig config(sys);
+			Optimizer optimizer(config);
+			timer.stop();
+			cout << setw(10) << timer.get_time();
+		} else
+			cout << setw(10) << "-" << setw(10) << "-";
+
+		cout << endl;
+	}
+
+	remove(filename);
+	remove(binfilename);
+
+	return 0;
+}
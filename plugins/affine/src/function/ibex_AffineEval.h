@@ -56,6 +56,7 @@ public:
 	void symbol_fwd(int y);
 	void apply_fwd (int* x, int y);
 	void chi_fwd   (int x1, int x2, int x3, int y);
+	void sum_fwd   (int* x, int n, const bool* neg, int y);
 	void gen2_fwd  (int x1, int x2, int y);
 	void add_fwd   (int x1, int x2, int y);
 	void mul_fwd   (int x1, int x2, int y);
@@ -101,6 +102,7 @@ public:
 	void mul_MV_fwd (int x1, int x2, int y);
 	void mul_VM_fwd (int x1, int x2, int y);
 	void mul_MM_fwd (int x1, int x2, int y);
+	void mul_CV_fwd (int x1, int x2, int y);
 	void sub_V_fwd  (int x1, int x2, int y);
 	void sub_M_fwd  (int x1, int x2, int y);
 
@@ -261,6 +263,23 @@ inline void AffineEval<T>::add_fwd(int x1, int x2, int y) {
 	d[y].i()=(af2[y].i().itv() & (d[x1].i()+d[x2].i()));
 }
 
+template<class T>
+inline void AffineEval<T>::sum_fwd(int* x, int n, const bool* neg, int y) {
+	AffineMain<T> s=af2[x[0]].i();
+	Interval itv=d[x[0]].i();
+	for (int k=1; k<n; k++) {
+		if (neg[k]) {
+			s=s-af2[x[k]].i();
+			itv=(s.itv() & (itv-d[x[k]].i()));
+		} else {
+			s=s+af2[x[k]].i();
+			itv=(s.itv() & (itv+d[x[k]].i()));
+		}
+	}
+	af2[y].i()=s;
+	d[y].i()=itv;
+}
+
 template<class T>
 inline void AffineEval<T>::mul_fwd(int x1, int x2, int y) {
 	af2[y].i()=af2[x1].i()*af2[x2].i();
@@ -525,6 +544,13 @@ inline void AffineEval<T>::mul_MM_fwd(int x1, int x2, int y) {
 	d[y].m() &=  (d[x1].m()*d[x2].m());
 }
 
+template<class T>
+inline void AffineEval<T>::mul_CV_fwd(int x1, int x2, int y) {
+	const IntervalMatrix& m=((const ExprConstant&) f.node(x1)).get_matrix_value();
+	af2[y].v()=AffineMainMatrix<T>(m)*af2[x2].v();
+	d[y].v()=(af2[y].v().itv() & (m*d[x2].v()));
+}
+
 template<class T>
 inline void AffineEval<T>::sub_V_fwd(int x1, int x2, int y) {
 	af2[y].v()=af2[x1].v()-af2[x2].v();
@@ -8,6 +8,42 @@ using namespace ibex;
 #define MIN(a,b) ((a < b) ? a : b)
 
 double tot_time = 0.0;
+double tot_buffer_time = 0.0;
+double tot_first_loup_time = 0.0;
+bool local_search = false;
+
+/* Default configuration, except that the buffer is a double heap
+ * with the given second criterion (if buffer_crit is not NULL).
+ */
+class BenchOptimizerConfig : public DefaultOptimizerConfig
+{
+	public:
+		BenchOptimizerConfig (const System &sys, const char *buffer_crit)
+			: DefaultOptimizerConfig (sys), buffer_crit (buffer_crit) {}
+
+	protected:
+		virtual CellBufferOptim& get_cell_buffer ()
+		{
+			if (!buffer_crit)
+				return DefaultOptimizerConfig::get_cell_buffer ();
+
+			CellCostFunc::criterion crit;
+			if (strcmp (buffer_crit, "ub") == 0)      crit = CellCostFunc::UB;
+			else if (strcmp (buffer_crit, "c3") == 0) crit = CellCostFunc::C3;
+			else if (strcmp (buffer_crit, "c5") == 0) crit = CellCostFunc::C5;
+			else if (strcmp (buffer_crit, "c7") == 0) crit = CellCostFunc::C7;
+			else if (strcmp (buffer_crit, "pu") == 0) crit = CellCostFunc::PU;
+			else
+			{
+				ibex_error ("\"--buffer\" must be one of ub, c3, c5, c7, pu");
+				crit = CellCostFunc::UB;
+			}
+			return rec (new CellDoubleHeap (get_ext_sys (), 50, crit));
+		}
+
+	private:
+		const char *buffer_crit;
+};
 
 double
 double_from_arg (const char *argname, const char *str)
@@ -48,7 +84,12 @@ usage (const char *errmsg)
 	  << "  --time-limit <t>      optimizer will stop after <t> seconds" << std::endl
 	  << "  --prec-ndigits-min <d>        " << std::endl
 	  << "  --prec-ndigits-max <d>        " << std::endl
-	  << "  --iter <i>        " << std::endl;
+	  << "  --iter <i>        " << std::endl
+	  << "Optional parameter is:" << std::endl
+	  << "  --buffer <crit>       use a double heap with second criterion <crit>" << std::endl
+	  << "                        (ub, c3, c5, c7 or pu) and report the time" << std::endl
+	  << "                        spent in the buffer" << std::endl
+	  << "  --local-search        improve loup candidates with a local solver" << std::endl;
 	ibex_error (s.str().c_str());
 }
 
@@ -129,7 +170,7 @@ ostream& operator<< (ostream &os, DecimalFP const &v)
  */
 bool
 do_benchs_iter (System &sys, DecimalFP prec, double time_limit,
-                unsigned int iter)
+                unsigned int iter, const char *buffer_crit)
 {
 	bool timeout = false;
 	double eps = pow (10, -prec.get_double());
@@ -137,7 +178,7 @@ do_benchs_iter (System &sys, DecimalFP prec, double time_limit,
 	for (unsigned int i = 0; i < iter; i++)
 	{
 		/* Build the default optimizer */
-		DefaultOptimizerConfig config(sys);
+		BenchOptimizerConfig config(sys, buffer_crit);
 
 		config.set_rel_eps_f(eps);
 		config.set_abs_eps_f(eps);
@@ -145,6 +186,7 @@ do_benchs_iter (System &sys, DecimalFP prec, double time_limit,
 		config.set_rigor(false);
 		config.set_inHC4(true);
 		config.set_kkt(false);
+		config.set_local_search(local_search);
 		config.set_random_seed(config.default_random_seed + (double) i);
 		config.set_eps_x(0.0);
 		config.set_timeout(time_limit); /* Set the time limit */
@@ -158,13 +200,19 @@ do_benchs_iter (System &sys, DecimalFP prec, double time_limit,
 		std::cout << "BENCH: eps = 10^-" << prec
 		          << " ; status = " << DefOpt.get_status()
 		          << " ; time = " << DefOpt.get_time()
+		          << " ; time_first_loup = " << DefOpt.get_first_loup_time()
 		          << " ; nb_cells = " << DefOpt.get_nb_cells()
 		          << " ; uplo = " << DefOpt.get_uplo()
 		          << " ; loup = " << DefOpt.get_loup()
-		          << " ; random_seed = " << config.get_random_seed()
-		          << std::endl;
+		          << " ; random_seed = " << config.get_random_seed();
+		if (buffer_crit)
+			std::cout << " ; buffer_time = " << DefOpt.get_buffer_time();
+		std::cout << std::endl;
 
 		tot_time += DefOpt.get_time();
+		tot_buffer_time += DefOpt.get_buffer_time();
+		/* no loup found: count the whole time */
+		tot_first_loup_time += DefOpt.get_first_loup_time()>=0 ? DefOpt.get_first_loup_time() : DefOpt.get_time();
 		timeout |= status == Optimizer::TIME_OUT;
 	}
 
@@ -180,12 +228,20 @@ main (int argc, char *argv[])
 		double time_limit = NAN;
 		DecimalFP prec_max, prec_min;
 		unsigned int iter = 0;
+		const char *buffer_crit = NULL;
 
 		argc--; argv++; /* skip argv[0] = binary name */
 
-		while (argc >= 2)
+		while (argc >= 1)
 		{
-			if (strcmp (argv[0], "--bench-file") == 0)
+			if (strcmp (argv[0], "--local-search") == 0)
+			{
+				local_search = true;
+				argc--; argv++;
+			}
+			else if (argc < 2)
+				usage ("missing value of command-line parameter");
+			else if (strcmp (argv[0], "--bench-file") == 0)
 			{
 				benchfile = argv[1];
 				argc-=2; argv+=2;
@@ -205,6 +261,11 @@ main (int argc, char *argv[])
 				prec_min = double_from_arg ("--prec-ndigits-min", argv[1]);
 				argc-=2; argv+=2;
 			}
+			else if (strcmp (argv[0], "--buffer") == 0)
+			{
+				buffer_crit = argv[1];
+				argc-=2; argv+=2;
+			}
 			else if (strcmp (argv[0], "--prec-ndigits-max") == 0)
 			{
 				prec_max = double_from_arg ("--prec-ndigits-max", argv[1]);
@@ -220,6 +281,10 @@ main (int argc, char *argv[])
 		cout << "# INPUT: time limit: " << time_limit << "s" << endl;
 		cout << "# INPUT: prec ndigits max: " << prec_max << endl;
 		cout << "# INPUT: prec ndigits min: " << prec_min << endl;
+		if (buffer_crit)
+			cout << "# INPUT: buffer: double heap (" << buffer_crit << ")" << endl;
+		if (local_search)
+			cout << "# INPUT: local search: on" << endl;
 
 		/* Check for missing command-line parameter */
 		if (prec_max.is_nan())
@@ -241,8 +306,11 @@ main (int argc, char *argv[])
 		if (!sys.goal)
 			ibex_error ("input file does not contains an optimization problem.");
 
+		/* the time spent in the buffer is only measured with profiling */
+		CtcProfile::enabled = (buffer_crit != NULL);
+
 		/* always bench prec_min */
-		bool has_timeout = do_benchs_iter (sys, prec_min, time_limit, iter);
+		bool has_timeout = do_benchs_iter (sys, prec_min, time_limit, iter, buffer_crit);
 		if (!has_timeout)
 		{
 			DecimalFP prec = 0., incr = 1.;
@@ -250,7 +318,7 @@ main (int argc, char *argv[])
 			{
 				if (prec_min < prec)
 				{
-					has_timeout = do_benchs_iter (sys, prec, time_limit, iter);
+					has_timeout = do_benchs_iter (sys, prec, time_limit, iter, buffer_crit);
 					if (has_timeout)
 						break;
 				}
@@ -264,15 +332,18 @@ main (int argc, char *argv[])
 					break;
 				else
 				{
-					has_timeout = do_benchs_iter (sys, prec, time_limit, iter);
+					has_timeout = do_benchs_iter (sys, prec, time_limit, iter, buffer_crit);
 					if (has_timeout)
 						break;
 				}
 			}
 			if (!has_timeout && prec_max != prec_min)
-				do_benchs_iter (sys, prec_max, time_limit, iter);
+				do_benchs_iter (sys, prec_max, time_limit, iter, buffer_crit);
 		}
 		std::cout << "# Total time: " << tot_time << std::endl;
+		std::cout << "# Total time to first loup: " << tot_first_loup_time << std::endl;
+		if (buffer_crit)
+			std::cout << "# Total buffer time: " << tot_buffer_time << std::endl;
 		return EXIT_SUCCESS;
 	}
 	catch (ibex::SyntaxError& e)
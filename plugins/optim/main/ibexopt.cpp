@@ -44,16 +44,26 @@ int main(int argc, char** argv) {
 	args::ValueFlag<double> initial_loup(parser, "float", "Intial \"loup\" (a priori known upper bound).", {"initial-loup"});
 	args::ValueFlag<string> input_file(parser, "filename", "COV input file. The file contains "
 			"optimization data in the COV (binary) format.", {'i',"input"});
+	args::ValueFlag<string> warm_start(parser, "filename", "COV file of a previous run with the same constraints "
+			"(the objective or the bounds may differ). Its loup point is the first candidate of the upper bounding.", {"warm-start"});
 	args::ValueFlag<string> output_file(parser, "filename", "COV output file. The file will contain the "
 			"optimization data in the COV (binary) format. See --format", {'o',"output"});
 	args::Flag rigor(parser, "rigor", "Activate rigor mode (certify feasibility of equalities).", {"rigor"});
 	args::Flag kkt(parser, "kkt", "Activate contractor based on Kuhn-Tucker conditions.", {"kkt"});
+	args::Flag local_search(parser, "local-search", "Improve the loup candidates with a local NLP solver (augmented Lagrangian).", {"local-search"});
+	args::ValueFlag<unsigned int> max_cells(parser, "int", "Maximal number of cells in memory (the others are temporarily stored on disk). Default value is 0 (no limit).", {"max-cells"});
+	args::ValueFlag<int> loup_threads(parser, "int", "Number of threads for asynchronous upper bounding. Default value is 0 (synchronous).", {"loup-threads"});
+	args::ValueFlag<unsigned int> beam_width(parser, "int", "Maximal number of cells in the current beam of the beam search. Default value is 1.", {"beam-width"});
+	args::ValueFlag<int> beam_threads(parser, "int", "Number of threads contracting and bounding the cells of the beam in parallel. Default value is 0 (sequential).", {"beam-threads"});
 	args::Flag output_no_obj(parser, "output-no-obj", "Generate a COV with domains of variables only (not objective values).", {"output-no-obj"});
 	args::Flag trace(parser, "trace", "Activate trace. Updates of loup/uplo are printed while minimizing.", {"trace"});
 	args::Flag format(parser, "format", "Give a description of the COV format used by IbexOpt", {"format"});
+	args::ValueFlag<string> profile(parser, "filename", "Profile the contractors. Statistics are displayed in the report and written in JSON format in the given file.", {"profile"});
 	args::Flag quiet(parser, "quiet", "Print no report on the standard output.",{'q',"quiet"});
 
-	args::Positional<std::string> filename(parser, "filename", "The name of the MINIBEX file.");
+	args::ValueFlag<string> save_compiled(parser, "filename", "Save the system in binary (precompiled) format in the given file and exit. "
+			"This file can be given instead of the MINIBEX file in next runs, to skip parsing and simplification.", {"save-compiled"});
+	args::Positional<std::string> filename(parser, "filename", "The name of the MINIBEX file (or of a file generated with --save-compiled).");
 
 	try
 	{
@@ -111,6 +121,14 @@ int main(int argc, char** argv) {
 			// Load a system of equations
 			sys = new System(filename.Get().c_str());
 
+		if (save_compiled) {
+			sys->save(save_compiled.Get().c_str());
+			if (!quiet)
+				cout << "  system saved in:\t" << save_compiled.Get() << endl;
+			delete sys;
+			return 0;
+		}
+
 		DefaultOptimizerConfig config(*sys);
 
 		string output_cov_file; // cov output file
@@ -164,6 +182,30 @@ int main(int argc, char** argv) {
 				cout << "  KKT contractor:\tON" << endl;
 		}
 
+		if (local_search) {
+			config.set_local_search(true);
+			if (!quiet)
+				cout << "  local search:\t\tON" << endl;
+		}
+
+		if (loup_threads) {
+			config.set_nb_loup_threads(loup_threads.Get());
+			if (!quiet)
+				cout << "  upper bounding:\t" << loup_threads.Get() << " threads (asynchronous)" << endl;
+		}
+
+		if (beam_width) {
+			config.set_beam_width(beam_width.Get());
+			if (!quiet)
+				cout << "  beam width:\t\t" << beam_width.Get() << endl;
+		}
+
+		if (beam_threads) {
+			config.set_nb_beam_threads(beam_threads.Get());
+			if (!quiet)
+				cout << "  beam search:\t\t" << beam_threads.Get() << " threads (parallel)" << endl;
+		}
+
 		if (initial_loup) {
 			if (!quiet)
 				cout << "  initial loup:\t\t" << initial_loup.Get() << " (a priori upper bound of the minimum)" << endl;
@@ -182,6 +224,16 @@ int main(int argc, char** argv) {
 			}
 		}
 
+		if (warm_start) {
+			if (input_file) {
+				cerr << "\n\033[31mOptions --input and --warm-start are exclusive.\033[0m\n\n";
+				exit(0);
+			}
+			if (!quiet) {
+				cout << "  warm start COV file:\t" << warm_start.Get().c_str() << "\n";
+			}
+		}
+
 		if (output_file) {
 			output_cov_file = output_file.Get();
 		} else {
@@ -223,6 +275,13 @@ int main(int argc, char** argv) {
 			config.set_timeout(timeout.Get());
 		}
 
+		// This option limits the memory used by the search
+		if (max_cells) {
+			if (!quiet)
+				cout << "  max cells in memory:\t" << max_cells.Get() << endl;
+			config.set_max_cells(max_cells.Get());
+		}
+
 		// This option prints each better feasible point when it is found
 		if (trace) {
 			if (!quiet)
@@ -242,6 +301,12 @@ int main(int argc, char** argv) {
 			config.set_extended_cov(false);
 		}
 
+		if (profile) {
+			if (!quiet)
+				cout << "  profile:\t\t" << profile.Get() << endl;
+			CtcProfile::enabled=true;
+		}
+
 		if (!quiet) {
 			cout << "*******************************************************" << endl << endl;
 		}
@@ -262,6 +327,13 @@ int main(int argc, char** argv) {
 				o.optimize(input_file.Get().c_str(), initial_loup.Get());
 			else
 				o.optimize(input_file.Get().c_str());
+		else if (warm_start) {
+			CovOptimData previous(warm_start.Get().c_str());
+			if (initial_loup)
+				o.optimize(sys->box, previous, initial_loup.Get());
+			else
+				o.optimize(sys->box, previous);
+		}
 		else
 			if (initial_loup)
 				o.optimize(sys->box, initial_loup.Get());
@@ -275,6 +347,11 @@ int main(int argc, char** argv) {
 		if (!quiet)
 			o.report();
 
+		if (profile) {
+			ofstream json(profile.Get().c_str());
+			CtcProfile::to_json(json);
+		}
+
 		o.get_data().save(output_cov_file.c_str());
 
 		if (!quiet) {
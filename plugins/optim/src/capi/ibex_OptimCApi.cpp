@@ -0,0 +1,89 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_OptimCApi.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_OptimCApi.h"
+#include "ibex_CApiImpl.h"
+#include "ibex_DefaultOptimizerConfig.h"
+#include "ibex_Optimizer.h"
+
+using namespace std;
+using namespace ibex;
+using namespace ibex::capi;
+
+struct ibex_optimizer {
+	ibex_optimizer(ibex_system* sys, double rel_eps_f, double abs_eps_f, double timeout);
+
+	ibex_system* sys;
+	DefaultOptimizerConfig config;
+	Optimizer optimizer;
+	IntervalVector box; // allocated once
+};
+
+namespace {
+
+DefaultOptimizerConfig& configure(DefaultOptimizerConfig& config, double rel_eps_f, double abs_eps_f, double timeout) {
+	config.set_rel_eps_f(rel_eps_f);
+	config.set_abs_eps_f(abs_eps_f);
+	config.set_timeout(timeout);
+	return config;
+}
+
+} // end anonymous namespace
+
+ibex_optimizer::ibex_optimizer(ibex_system* sys, double rel_eps_f, double abs_eps_f, double timeout) :
+		sys(sys), config(*sys->sys), optimizer(configure(config, rel_eps_f, abs_eps_f, timeout)), box(sys->sys->nb_var) {
+}
+
+extern "C" {
+
+ibex_optimizer* ibex_optimizer_new(ibex_system* sys, double rel_eps_f, double abs_eps_f, double timeout) {
+	restore();
+
+	if (!sys->sys->goal) {
+		error("[ibex_optimizer_new] the system has no goal");
+		return NULL;
+	}
+
+	try {
+		return new ibex_optimizer(sys, rel_eps_f, abs_eps_f, timeout);
+	} catch(...) {
+		handle_exception();
+		return NULL;
+	}
+}
+
+void ibex_optimizer_free(ibex_optimizer* o) {
+	delete o;
+}
+
+int ibex_optimizer_optimize(ibex_optimizer* o, const double* lb, const double* ub) {
+	restore();
+	try {
+		if (lb)
+			read(lb, ub, o->box);
+		else
+			o->box=o->sys->sys->box;
+		return o->optimizer.optimize(o->box);
+	} catch(...) {
+		return handle_exception();
+	}
+}
+
+double ibex_optimizer_uplo(const ibex_optimizer* o) {
+	return o->optimizer.get_uplo();
+}
+
+double ibex_optimizer_loup(const ibex_optimizer* o) {
+	return o->optimizer.get_loup();
+}
+
+void ibex_optimizer_loup_point(const ibex_optimizer* o, double* lb, double* ub) {
+	write(o->optimizer.get_loup_point(), lb, ub);
+}
+
+} // end extern "C"
@@ -0,0 +1,77 @@
+/*============================================================================
+ *                                  I B E X
+ * File        : ibex_OptimCApi.h
+ * Copyright   : IMT Atlantique (France)
+ * License     : See the LICENSE file
+ * Created     : Oct 19, 2026
+ *============================================================================*/
+
+#ifndef __IBEX_OPTIM_C_API_H__
+#define __IBEX_OPTIM_C_API_H__
+
+#include "ibex_CApi.h"
+
+/*
+ * C interface of the optimizer (see ibex_CApi.h).
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \ingroup capi \brief Optimizer (see ibex::Optimizer). */
+typedef struct ibex_optimizer ibex_optimizer;
+
+/**
+ * \ingroup capi
+ * \brief Default optimizer of a system (see ibex::DefaultOptimizerConfig).
+ *
+ * \param timeout - time limit in seconds (-1 for no limit).
+ * \pre The system must have a goal and must not be deleted
+ *      before the optimizer.
+ * \return NULL in case of error.
+ */
+ibex_optimizer* ibex_optimizer_new(ibex_system* sys, double rel_eps_f, double abs_eps_f, double timeout);
+
+/**
+ * \ingroup capi
+ * \brief Delete an optimizer.
+ */
+void ibex_optimizer_free(ibex_optimizer* o);
+
+/**
+ * \ingroup capi
+ * \brief Run the optimizer.
+ *
+ * \param lb, ub - nb_var bounds (initial box). If NULL, the box of
+ *                 the system is used.
+ *
+ * \return the status (value of ibex::Optimizer::Status), or #IBEX_ERROR.
+ */
+int ibex_optimizer_optimize(ibex_optimizer* o, const double* lb, const double* ub);
+
+/**
+ * \ingroup capi
+ * \brief Lower bound of the minimum found by the last run.
+ */
+double ibex_optimizer_uplo(const ibex_optimizer* o);
+
+/**
+ * \ingroup capi
+ * \brief Upper bound of the minimum found by the last run.
+ */
+double ibex_optimizer_loup(const ibex_optimizer* o);
+
+/**
+ * \ingroup capi
+ * \brief Point (or box) where the loup is reached.
+ *
+ * \param lb, ub - nb_var bounds (output).
+ */
+void ibex_optimizer_loup_point(const ibex_optimizer* o, double* lb, double* ub);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IBEX_OPTIM_C_API_H__ */
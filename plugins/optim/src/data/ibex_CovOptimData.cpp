@@ -153,6 +153,7 @@ ifstream* CovOptimData::read(const char* filename, CovOptimData& cov, std::stack
 		case 3: cov.data->_optim_optimizer_status = (unsigned int) Optimizer::UNBOUNDED_OBJ;     break;
 		case 4: cov.data->_optim_optimizer_status = (unsigned int) Optimizer::TIME_OUT;     		break;
 		case 5: cov.data->_optim_optimizer_status = (unsigned int) Optimizer::UNREACHED_PREC;    break;
+		case 6: cov.data->_optim_optimizer_status = (unsigned int) Optimizer::INTERRUPTED;       break;
 		default: ibex_error("[CovOptimData]: invalid optimizer status.");
 		}
 
@@ -0,0 +1,79 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LoupFinderLocalSearch.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_LoupFinderLocalSearch.h"
+
+using namespace std;
+
+namespace ibex {
+
+LoupFinderLocalSearch::LoupFinderLocalSearch(const System& sys, int max_iter) : sys(sys), max_iter(max_iter), finder(NULL) {
+
+}
+
+LoupFinderLocalSearch::LoupFinderLocalSearch(const System& sys, LoupFinder& finder, int max_iter) : sys(sys), max_iter(max_iter), finder(&finder) {
+
+}
+
+void LoupFinderLocalSearch::add_property(const IntervalVector& init_box, BoxProperties& prop) {
+	if (finder) finder->add_property(init_box,prop);
+}
+
+std::pair<IntervalVector, double> LoupFinderLocalSearch::find(const IntervalVector& box, const IntervalVector& old_loup_point, double old_loup) {
+
+	pair<IntervalVector,double> p=make_pair(old_loup_point, old_loup);
+
+	bool found=false;
+
+	if (finder) {
+		try {
+			p=finder->find(box,p.first,p.second);
+			found=true;
+		} catch(NotFound&) { }
+	}
+
+	return local_search(box,p,found);
+}
+
+std::pair<IntervalVector, double> LoupFinderLocalSearch::find(const IntervalVector& box, const IntervalVector& old_loup_point, double old_loup, BoxProperties& prop) {
+
+	pair<IntervalVector,double> p=make_pair(old_loup_point, old_loup);
+
+	bool found=false;
+
+	if (finder) {
+		try {
+			p=finder->find(box,p.first,p.second,prop);
+			found=true;
+		} catch(NotFound&) { }
+	}
+
+	return local_search(box,p,found);
+}
+
+std::pair<IntervalVector, double> LoupFinderLocalSearch::local_search(const IntervalVector& box, const std::pair<IntervalVector, double>& p, bool found) {
+
+	if (!box.is_unbounded()) {
+		Vector x0=found? p.first.mid() : box.mid();
+		Vector x(box.size());
+
+		ConstrainedLocalSearch solver(sys,box);
+		solver.minimize(x0,x,ConstrainedLocalSearch::default_eps,max_iter);
+
+		double loup=p.second;
+		if (check(sys,x,loup,false))
+			return make_pair(x,loup);
+	}
+
+	if (found)
+		return p;
+	else
+		throw NotFound();
+}
+
+} /* namespace ibex */
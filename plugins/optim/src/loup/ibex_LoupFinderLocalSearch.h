@@ -0,0 +1,101 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LoupFinderLocalSearch.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_LOUP_FINDER_LOCAL_SEARCH_H__
+#define __IBEX_LOUP_FINDER_LOCAL_SEARCH_H__
+
+#include "ibex_LoupFinder.h"
+#include "ibex_ConstrainedLocalSearch.h"
+
+namespace ibex {
+
+/**
+ * \ingroup optim
+ *
+ * \brief Upper-bounding algorithm based on a local NLP solver.
+ *
+ * The algorithm runs a constrained local solver (see ConstrainedLocalSearch)
+ * inside the box and checks the feasibility of the point found.
+ *
+ * If another loup finder is given, it is run first and the local solver
+ * starts from its candidate point (the local solver is then a "polishing"
+ * step). Otherwise, the local solver starts from the midpoint of the box.
+ *
+ * Like LoupFinderDefault, the finder works on a relaxed system (equalities
+ * are not certified). Feasibility of equalities can then be certified
+ * by LoupFinderCertify.
+ */
+class LoupFinderLocalSearch : public LoupFinder {
+public:
+
+	/**
+	 * \brief Create the algorithm for a given system.
+	 *
+	 * \param sys      - The NLP problem.
+	 * \param max_iter - maximal number of outer iterations of the local solver.
+	 */
+	LoupFinderLocalSearch(const System& sys, int max_iter=ConstrainedLocalSearch::default_max_iter);
+
+	/**
+	 * \brief Create the algorithm for a given system.
+	 *
+	 * \param sys      - The NLP problem.
+	 * \param finder   - loup finder providing the starting points.
+	 * \param max_iter - maximal number of outer iterations of the local solver.
+	 */
+	LoupFinderLocalSearch(const System& sys, LoupFinder& finder, int max_iter=ConstrainedLocalSearch::default_max_iter);
+
+	/**
+	 * \brief Find a new loup in a given box.
+	 *
+	 * \see comments in LoupFinder.
+	 */
+	virtual std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup);
+
+	/**
+	 * \brief Find a new loup in a given box.
+	 *
+	 * \see comments in LoupFinder.
+	 */
+	virtual std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop);
+
+	/**
+	 * \brief Add properties required by the other loup finder.
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop);
+
+	/**
+	 * \brief The NLP problem.
+	 */
+	const System& sys;
+
+	/**
+	 * \brief Maximal number of outer iterations of the local solver.
+	 */
+	const int max_iter;
+
+protected:
+
+	/**
+	 * \brief Run the local solver and check the resulting point.
+	 *
+	 * \param p     - the current loup point and loup, or the candidate
+	 *                found by #finder if \a found is true.
+	 * \param found - true if #finder has found a candidate.
+	 */
+	std::pair<IntervalVector, double> local_search(const IntervalVector& box, const std::pair<IntervalVector, double>& p, bool found);
+
+	/**
+	 * \brief Loup finder providing starting points (NULL if none).
+	 */
+	LoupFinder* finder;
+};
+
+} /* namespace ibex */
+
+#endif /* __IBEX_LOUP_FINDER_LOCAL_SEARCH_H__ */
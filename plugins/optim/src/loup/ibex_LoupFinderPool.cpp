@@ -0,0 +1,202 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LoupFinderPool.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_LoupFinderPool.h"
+#include "ibex_Random.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Bound of the seeds of the random generators of the
+ * threads (the cost of RNG::srand is linear in the seed).
+ */
+const uint32_t max_seed = 1024;
+
+}
+
+LoupFinderPool::LoupFinderPool(const Array<LoupFinder>& _finders, int capacity) :
+		nb_threads(_finders.size()), capacity(capacity),
+		best_point(1), best_loup(POS_INFINITY), improved(false), stopped(true), nb_active(0),
+		_nb_submitted(0), _nb_processed(0), _nb_found(0) {
+
+	if (nb_threads==0)
+		ibex_error("[LoupFinderPool] at least one loup finder is required");
+
+	if (capacity<1)
+		ibex_error("[LoupFinderPool] capacity must be positive");
+
+	for (int i=0; i<nb_threads; i++)
+		finders.push_back(&_finders[i]);
+}
+
+LoupFinderPool::~LoupFinderPool() {
+	stop();
+}
+
+void LoupFinderPool::start(const IntervalVector& loup_point, double loup) {
+	stop();
+
+	queue.clear();
+	best_point = loup_point;
+	best_loup = loup;
+	improved = false;
+	stopped = false;
+	nb_active = 0;
+	error = exception_ptr();
+	_nb_submitted = _nb_processed = _nb_found = 0;
+
+	// the generators of the threads are thread-local (see RNG):
+	// they are seeded from the one of the calling thread.
+	for (int i=0; i<nb_threads; i++)
+		threads.push_back(thread(&LoupFinderPool::run, this, i, (int) (RNG::rand() % max_seed)));
+}
+
+void LoupFinderPool::submit(const IntervalVector& box, double priority) {
+	{
+		lock_guard<std::mutex> lock(mtx);
+
+		if (stopped || priority>best_loup) return;
+
+		_nb_submitted++;
+		queue.insert(make_pair(priority,box));
+
+		if ((int) queue.size()>capacity)
+			queue.erase(--queue.end()); // drop the least promising box
+	}
+	task_cond.notify_one();
+}
+
+bool LoupFinderPool::poll(IntervalVector& loup_point, double& loup) {
+	lock_guard<std::mutex> lock(mtx);
+
+	if (error) {
+		exception_ptr e=error;
+		error = exception_ptr();
+		rethrow_exception(e);
+	}
+
+	if (!improved) return false;
+
+	improved = false;
+
+	if (best_loup<loup) {
+		loup_point = best_point;
+		loup = best_loup;
+		return true;
+	} else
+		return false;
+}
+
+void LoupFinderPool::wait() {
+	unique_lock<std::mutex> lock(mtx);
+	idle_cond.wait(lock, [this] { return stopped || (queue.empty() && nb_active==0); });
+}
+
+void LoupFinderPool::stop() {
+	if (threads.empty()) return;
+
+	{
+		lock_guard<std::mutex> lock(mtx);
+		stopped = true;
+		queue.clear();
+	}
+	task_cond.notify_all();
+
+	for (vector<thread>::iterator it=threads.begin(); it!=threads.end(); it++)
+		it->join();
+
+	threads.clear();
+}
+
+bool LoupFinderPool::rigorous() const {
+	for (vector<LoupFinder*>::const_iterator it=finders.begin(); it!=finders.end(); it++)
+		if (!(*it)->rigorous()) return false;
+	return true;
+}
+
+unsigned long LoupFinderPool::nb_submitted() const {
+	lock_guard<std::mutex> lock(mtx);
+	return _nb_submitted;
+}
+
+unsigned long LoupFinderPool::nb_processed() const {
+	lock_guard<std::mutex> lock(mtx);
+	return _nb_processed;
+}
+
+unsigned long LoupFinderPool::nb_found() const {
+	lock_guard<std::mutex> lock(mtx);
+	return _nb_found;
+}
+
+void LoupFinderPool::run(int i, int seed) {
+	RNG::srand(seed);
+
+	unique_lock<std::mutex> lock(mtx);
+
+	while (true) {
+		task_cond.wait(lock, [this] { return stopped || !queue.empty(); });
+
+		if (stopped) break;
+
+		multimap<double,IntervalVector>::iterator it=queue.begin();
+		double priority=it->first;
+		IntervalVector box(it->second);
+		queue.erase(it);
+
+		if (priority>best_loup) {
+			// the box cannot contain a better loup anymore
+			idle_cond.notify_all();
+			continue;
+		}
+
+		IntervalVector loup_point(best_point);
+		double loup=best_loup;
+		nb_active++;
+
+		lock.unlock();
+
+		IntervalVector new_point(box.size());
+		double new_loup=POS_INFINITY;
+		bool found=false;
+		exception_ptr e;
+
+		try {
+			pair<IntervalVector,double> p=finders[i]->find(box,loup_point,loup);
+			new_point = p.first;
+			new_loup = p.second;
+			found = true;
+		} catch(LoupFinder::NotFound&) {
+		} catch(...) {
+			e = current_exception();
+		}
+
+		lock.lock();
+
+		nb_active--;
+		_nb_processed++;
+
+		// another thread may have found a better loup in the meantime
+		if (found && new_loup<best_loup) {
+			best_point = new_point;
+			best_loup = new_loup;
+			improved = true;
+			_nb_found++;
+		}
+
+		if (e && !error) error = e;
+
+		idle_cond.notify_all();
+	}
+}
+
+} /* namespace ibex */
@@ -0,0 +1,186 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LoupFinderPool.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_LOUP_FINDER_POOL_H__
+#define __IBEX_LOUP_FINDER_POOL_H__
+
+#include "ibex_LoupFinder.h"
+#include "ibex_Array.h"
+
+#include <map>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+namespace ibex {
+
+/**
+ * \ingroup optim
+ *
+ * \brief Asynchronous upper bounding.
+ *
+ * A pool of threads, each running its own loup finder on the
+ * boxes submitted by the optimizer. The best loup found is
+ * retrieved by the optimizer with #poll(), so that the search
+ * never waits for the upper bounding.
+ *
+ * Boxes are processed by increasing lower bound of the objective
+ * (most promising first). The number of pending boxes is bounded:
+ * when the queue is full, the least promising box is dropped.
+ *
+ * The random generators of the threads (used by some loup finders)
+ * are seeded from the one of the thread that calls #start(), so that
+ * the results depend on the seed set by RNG::srand().
+ *
+ * See Optimizer::set_async_upper_bounding().
+ */
+class LoupFinderPool {
+public:
+
+	/**
+	 * \brief Create the pool.
+	 *
+	 * \param finders  - one loup finder per thread. As they run
+	 *                   concurrently, they must not share any data
+	 *                   (e.g., they can be built on copies of the system).
+	 * \param capacity - maximal number of pending boxes.
+	 */
+	LoupFinderPool(const Array<LoupFinder>& finders, int capacity=default_capacity);
+
+	/**
+	 * \brief Delete this (stop the threads).
+	 */
+	~LoupFinderPool();
+
+	/**
+	 * \brief Launch the threads.
+	 *
+	 * \param loup_point - the current loup point (or empty box if none)
+	 * \param loup       - the current loup.
+	 */
+	void start(const IntervalVector& loup_point, double loup);
+
+	/**
+	 * \brief Submit a box to upper bounding.
+	 *
+	 * \param box      - the box (in the original space)
+	 * \param priority - a lower bound of the objective in the box.
+	 *                   The box is ignored if the priority is greater than
+	 *                   the best loup found so far.
+	 */
+	void submit(const IntervalVector& box, double priority);
+
+	/**
+	 * \brief Retrieve the best loup found so far.
+	 *
+	 * \param loup_point - (input/output) current loup point.
+	 * \param loup       - (input/output) current loup.
+	 * \return           true if the loup has been improved.
+	 * \throws           any exception (other than LoupFinder::NotFound)
+	 *                   raised by a loup finder.
+	 */
+	bool poll(IntervalVector& loup_point, double& loup);
+
+	/**
+	 * \brief Wait until all the submitted boxes are processed.
+	 */
+	void wait();
+
+	/**
+	 * \brief Discard the pending boxes and stop the threads.
+	 *
+	 * Searches in progress are not interrupted (the call blocks until
+	 * they are over). Nothing happens if the pool is not started.
+	 */
+	void stop();
+
+	/**
+	 * \brief True if all the loup finders are rigorous.
+	 */
+	bool rigorous() const;
+
+	/**
+	 * \brief Number of boxes submitted since the last call to start().
+	 */
+	unsigned long nb_submitted() const;
+
+	/**
+	 * \brief Number of boxes processed since the last call to start().
+	 */
+	unsigned long nb_processed() const;
+
+	/**
+	 * \brief Number of loups found since the last call to start().
+	 */
+	unsigned long nb_found() const;
+
+	/** Default capacity: 64 boxes. */
+	static constexpr int default_capacity = 64;
+
+	/** Number of threads. */
+	const int nb_threads;
+
+	/** Maximal number of pending boxes. */
+	const int capacity;
+
+protected:
+
+	/**
+	 * Main loop of the thread i.
+	 *
+	 * The random generator of the thread (see RNG) is
+	 * first initialized with \a seed.
+	 */
+	void run(int i, int seed);
+
+	/** The loup finders. */
+	std::vector<LoupFinder*> finders;
+
+	/** The threads. */
+	std::vector<std::thread> threads;
+
+	/** Pending boxes, sorted by priority. */
+	std::multimap<double,IntervalVector> queue;
+
+	/** Protects all the data below. */
+	mutable std::mutex mtx;
+
+	/** Notified when a box is submitted or the pool is stopped. */
+	std::condition_variable task_cond;
+
+	/** Notified when a thread becomes idle. */
+	std::condition_variable idle_cond;
+
+	/** Best loup point found. */
+	IntervalVector best_point;
+
+	/** Best loup found. */
+	double best_loup;
+
+	/** True if the best loup has not been polled yet. */
+	bool improved;
+
+	/** True if the threads must stop. */
+	bool stopped;
+
+	/** Number of threads currently searching. */
+	int nb_active;
+
+	/** First exception raised by a loup finder. */
+	std::exception_ptr error;
+
+	unsigned long _nb_submitted;
+	unsigned long _nb_processed;
+	unsigned long _nb_found;
+};
+
+} /* namespace ibex */
+
+#endif /* __IBEX_LOUP_FINDER_POOL_H__ */
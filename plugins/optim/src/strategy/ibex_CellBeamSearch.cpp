@@ -49,6 +49,12 @@ void CellBeamSearch::contract(double new_loup) {
 	}
 }
 
+// the cells of the current and future buffers are kept
+void CellBeamSearch::shrink(unsigned int n, std::vector<Cell*>& cells) {
+	unsigned int beam=currentbuffer.size()+futurebuffer.size();
+	Heap<Cell>::shrink(n>beam? n-beam : 0, cells);
+}
+
 void CellBeamSearch::push(Cell* cell) {
 	futurebuffer.push(cell);
 }
@@ -69,6 +75,12 @@ Cell* CellBeamSearch::pop() {
 	else return CellHeap::pop();
 }
 
+void CellBeamSearch::pop_beam(vector<Cell*>& cells) {
+	cells.push_back(pop());
+	while (!currentbuffer.empty())
+		cells.push_back(currentbuffer.pop());
+}
+
 // emptying the futurebuffer : buffersize-1 cells are put into
 // the currentbuffer , the remaining into the global heap
 void CellBeamSearch::move_buffers() {
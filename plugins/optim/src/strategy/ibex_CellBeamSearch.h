@@ -68,6 +68,18 @@ public :
 	 */
 	virtual Cell* pop();
 
+	/**
+	 * \brief Pop the whole beam.
+	 *
+	 * Pop the next cell (see pop()) and all the cells remaining in
+	 * the current buffer. At most #beamsize cells are popped, in the
+	 * order they would have been popped by pop().
+	 *
+	 * The cells in the beam are independent: they can be handled
+	 * concurrently (see Optimizer::set_parallel_beam()).
+	 */
+	void pop_beam(std::vector<Cell*>& cells);
+
 	/** \brief Return the next cell (but does not pop it).*/
 	virtual Cell* top() const;
 
@@ -77,6 +89,9 @@ public :
 	/** \brief Remove the cells with a LB greater than new_loup */
 	virtual void contract (double new_loup);
 
+	/** \brief Remove cells from the global buffer so that n cells at most remain (if possible). */
+	virtual void shrink(unsigned int n, std::vector<Cell*>& cells);
+
 	/** \brief The default value for the maximum beam size */
 	static constexpr unsigned int default_beamsize = 1;
 
@@ -12,6 +12,8 @@
 
 #include "ibex_CellBuffer.h"
 
+#include <vector>
+
 namespace ibex {
 
 /**
@@ -43,8 +45,26 @@ public:
 	 */
 	virtual void contract(double loup)=0;
 
+	/**
+	 * \brief Shrink the buffer
+	 *
+	 * Removes the least promising cells (with the greatest
+	 * lower bound of the objective) so that \a n cells at most
+	 * remain, and appends them to \a cells (they are not deleted).
+	 *
+	 * Used by the optimizer to bound the number of cells in
+	 * memory (see Optimizer::max_cells). By default, raises an error.
+	 */
+	virtual void shrink(unsigned int n, std::vector<Cell*>& cells);
+
 };
 
+/*================================== inline implementations ========================================*/
+
+inline void CellBufferOptim::shrink(unsigned int n, std::vector<Cell*>& cells) {
+	ibex_error("[CellBufferOptim] this buffer cannot be shrunk");
+}
+
 } /* namespace ibex */
 
 #endif /* __IBEX_CELL_BUFFER_OPTIM_H__ */
@@ -99,9 +99,22 @@ public:
 	 * Removes (and deletes) from the heap all the cells
 	 * with a cost (according to the cost function of the
 	 * first heap) greater than \a loup.
+	 *
+	 * The removal and the update of the loup-dependent
+	 * costs of the second heap are lazy (see DoubleHeap),
+	 * except for the criterion C7 (the second heap is
+	 * entirely re-sorted).
 	 */
 	virtual void contract(double loup);
 
+	/**
+	 * \brief Shrink the heap
+	 *
+	 * Removes the cells with the greatest cost (according to the cost
+	 * function of the first heap) so that \a n cells at most remain.
+	 */
+	virtual void shrink(unsigned int n, std::vector<Cell*>& cells);
+
 	/**
 	 * \brief Cost function of the first heap
 	 */
@@ -126,6 +139,10 @@ inline CellDoubleHeap::CellDoubleHeap(const ExtendedSystem& sys, int crit2_pr, C
 		DoubleHeap<Cell>(*new CellCostVarLB(sys, sys.goal_var()), false,
 				*CellCostFunc::get_cost(sys, crit2, sys.goal_var()), true /* TODO: give right value */, crit2_pr),
 		sys(sys) {
+
+	// C7 may decrease when the loup decreases (if the
+	// lower bound of the objective is negative)
+	lazy_cost2 = crit2!=CellCostFunc::C7;
 }
 
 inline CellDoubleHeap::~CellDoubleHeap() {
@@ -143,10 +160,17 @@ inline void CellDoubleHeap::contract(double new_loup) {
 		heap1->sort();
 	}
 
+	// the costs of the second heap are recalculated
+	// lazily if possible (the criteria C3 and C5 only
+	// increase when the loup decreases, see #lazy_cost2).
 	cost2().set_loup(new_loup);
 	DoubleHeap<Cell>::contract(new_loup);
 }
 
+inline void CellDoubleHeap::shrink(unsigned int n, std::vector<Cell*>& cells) {
+	DoubleHeap<Cell>::shrink(n,cells);
+}
+
 inline CellCostFunc& CellDoubleHeap::cost1()      { return (CellCostFunc&) heap1->costf; }
 
 inline CellCostFunc& CellDoubleHeap::cost2()      { return (CellCostFunc&) heap2->costf; }
@@ -40,6 +40,8 @@ double CellHeap::minimum() const         { return Heap<Cell>::minimum(); }
 
 void CellHeap::contract(double new_loup) { Heap<Cell>::contract(new_loup); }
 
+void CellHeap::shrink(unsigned int n, std::vector<Cell*>& cells) { Heap<Cell>::shrink(n,cells); }
+
 CellCostFunc& CellHeap::cost()           { return (CellCostFunc&) costf; }
 
 std::ostream& CellHeap::print(std::ostream& os) const {
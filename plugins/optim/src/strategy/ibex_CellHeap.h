@@ -80,6 +80,14 @@ public:
 	 */
 	virtual void contract(double loup);
 
+	/**
+	 * \brief Shrink the heap
+	 *
+	 * Removes the cells with the greatest cost so that
+	 * \a n cells at most remain (see CellBufferOptim).
+	 */
+	virtual void shrink(unsigned int n, std::vector<Cell*>& cells);
+
 	/**
 	 * \brief Cost function of the  heap
 	 */
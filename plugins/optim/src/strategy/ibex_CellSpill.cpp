@@ -0,0 +1,178 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellSpill.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CellSpill.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// the file is not compacted below this number of dead boxes
+const unsigned long min_compact=1024;
+
+struct LBComparator {
+
+	LBComparator(int goal_var) : goal_var(goal_var) { }
+
+	bool operator()(const Cell* c1, const Cell* c2) const {
+		return c1->box[goal_var].lb() < c2->box[goal_var].lb();
+	}
+
+	int goal_var;
+};
+
+} // end anonymous namespace
+
+CellSpill::CellSpill(int n, int goal_var) : n(n), goal_var(goal_var), file(NULL), _file_size(0),
+		bound(POS_INFINITY), _minimum(POS_INFINITY), _size(0), _nb_written(0), _nb_read(0), record(2*n) {
+
+}
+
+CellSpill::~CellSpill() {
+	if (file) fclose(file); // a temporary file is removed when closed
+}
+
+void CellSpill::write(vector<Cell*>& cells) {
+
+	if (cells.empty()) return;
+
+	if (!file) {
+		file=tmpfile();
+		if (!file) ibex_error("[CellSpill] cannot create temporary file");
+	}
+
+	sort(cells.begin(), cells.end(), LBComparator(goal_var));
+
+	fseek(file, 0, SEEK_END);
+
+	Batch batch;
+	batch.offset=ftell(file);
+	batch.pos=0;
+
+	for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++) {
+		const IntervalVector& box=(*it)->box;
+		for (int i=0; i<n; i++) {
+			record[2*i]  =box[i].lb();
+			record[2*i+1]=box[i].ub();
+		}
+		if (fwrite(&record[0], sizeof(double), 2*n, file)!=(size_t) 2*n)
+			ibex_error("[CellSpill] cannot write temporary file");
+
+		batch.lb.push_back(box[goal_var].lb());
+		delete *it;
+	}
+
+	_size += cells.size();
+	_file_size += cells.size();
+	_nb_written += cells.size();
+	cells.clear();
+
+	batches.push_back(batch);
+	update();
+}
+
+IntervalVector CellSpill::read() {
+	assert(!empty());
+
+	// the batch with the lowest head
+	vector<Batch>::iterator best=batches.begin();
+	for (vector<Batch>::iterator it=batches.begin(); it!=batches.end(); it++) {
+		if (it->lb[it->pos] < best->lb[best->pos])
+			best=it;
+	}
+
+	fseek(file, best->offset + (long) best->pos*2*n*sizeof(double), SEEK_SET);
+	if (fread(&record[0], sizeof(double), 2*n, file)!=(size_t) 2*n)
+		ibex_error("[CellSpill] cannot read temporary file");
+
+	IntervalVector box(n);
+	for (int i=0; i<n; i++)
+		box[i]=Interval(record[2*i],record[2*i+1]);
+
+	best->pos++;
+	_size--;
+	_nb_read++;
+	update();
+
+	return box;
+}
+
+void CellSpill::contract(double loup) {
+	if (loup<bound) {
+		bound=loup;
+		update();
+	}
+}
+
+void CellSpill::flush() {
+	batches.clear();
+	_size=0;
+	bound=POS_INFINITY;
+	update();
+}
+
+void CellSpill::update() {
+
+	_minimum=POS_INFINITY;
+
+	for (vector<Batch>::iterator it=batches.begin(); it!=batches.end(); ) {
+		// a batch is sorted: if the head is discarded, so is the rest.
+		if (it->pos==it->lb.size() || it->lb[it->pos] > bound) {
+			_size -= it->lb.size()-it->pos;
+			it=batches.erase(it);
+		} else {
+			if (it->lb[it->pos] < _minimum) _minimum=it->lb[it->pos];
+			it++;
+		}
+	}
+
+	// no more boxes: the file is removed (a new one is created at the next write)
+	if (batches.empty() && file) {
+		fclose(file);
+		file=NULL;
+		_file_size=0;
+	}
+	// more dead boxes than live ones: the space is reclaimed
+	else if (_file_size-_size >= std::max(min_compact,(unsigned long) _size))
+		compact();
+}
+
+void CellSpill::compact() {
+
+	FILE* new_file=tmpfile();
+	if (!new_file) ibex_error("[CellSpill] cannot create temporary file");
+
+	long offset=0;
+
+	for (vector<Batch>::iterator it=batches.begin(); it!=batches.end(); it++) {
+		fseek(file, it->offset + (long) it->pos*2*n*sizeof(double), SEEK_SET);
+
+		for (unsigned int k=it->pos; k<it->lb.size(); k++) {
+			if (fread(&record[0], sizeof(double), 2*n, file)!=(size_t) 2*n)
+				ibex_error("[CellSpill] cannot read temporary file");
+			if (fwrite(&record[0], sizeof(double), 2*n, new_file)!=(size_t) 2*n)
+				ibex_error("[CellSpill] cannot write temporary file");
+		}
+
+		it->lb.erase(it->lb.begin(), it->lb.begin()+it->pos);
+		it->pos=0;
+		it->offset=offset;
+		offset += (long) it->lb.size()*2*n*sizeof(double);
+	}
+
+	fclose(file);
+	file=new_file;
+	_file_size=_size;
+}
+
+} /* namespace ibex */
@@ -0,0 +1,187 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellSpill.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_SPILL_H__
+#define __IBEX_CELL_SPILL_H__
+
+#include "ibex_Cell.h"
+
+#include <vector>
+#include <cstdio>
+
+namespace ibex {
+
+/**
+ * \ingroup optim
+ *
+ * \brief Disk storage of cells (for memory-bounded optimization).
+ *
+ * Cells removed from the buffer of the optimizer are written in
+ * a temporary binary file (only their box, 2 doubles per variable)
+ * and read back later, by increasing lower bound of the objective.
+ *
+ * Cells are written by batches, each batch being sorted. Reading
+ * merges the batches so that the box returned is always the one with
+ * the lowest objective lower bound among the boxes in the file.
+ *
+ * The space of the boxes read or discarded is reclaimed by rewriting
+ * the file when they take up more than half of it.
+ *
+ * The properties of the cells are not stored: they have to be
+ * rebuilt when the cells are reloaded (see Optimizer::max_cells).
+ *
+ * The file is created at the first write and is removed when
+ * this object is deleted.
+ */
+class CellSpill {
+public:
+
+	/**
+	 * \brief Create an empty storage.
+	 *
+	 * \param n        - size of the boxes (extended space)
+	 * \param goal_var - index of the objective variable
+	 */
+	CellSpill(int n, int goal_var);
+
+	/**
+	 * \brief Delete this (and the file).
+	 */
+	~CellSpill();
+
+	/**
+	 * \brief Write cells.
+	 *
+	 * The cells are *deleted* and \a cells is cleared.
+	 */
+	void write(std::vector<Cell*>& cells);
+
+	/**
+	 * \brief Remove the box with the lowest objective lower bound
+	 *        and return it.
+	 */
+	IntervalVector read();
+
+	/**
+	 * \brief Contract the storage.
+	 *
+	 * Discard all the boxes with an objective lower bound
+	 * greater than \a loup.
+	 */
+	void contract(double loup);
+
+	/**
+	 * \brief Discard all the boxes.
+	 */
+	void flush();
+
+	/** \brief Return true if no box is stored. */
+	bool empty() const;
+
+	/** \brief Return the number of boxes stored. */
+	unsigned int size() const;
+
+	/**
+	 * \brief Return the lowest objective lower bound
+	 *        (+oo if empty).
+	 */
+	double minimum() const;
+
+	/** \brief Total number of cells written. */
+	unsigned long nb_written() const;
+
+	/** \brief Total number of boxes read. */
+	unsigned long nb_read() const;
+
+	/**
+	 * \brief Number of boxes in the file, including
+	 *        the boxes read or discarded not reclaimed yet.
+	 */
+	unsigned long file_size() const;
+
+	/** Size of the boxes. */
+	const int n;
+
+	/** Index of the objective variable. */
+	const int goal_var;
+
+protected:
+
+	/*
+	 * A sorted sequence of boxes in the file.
+	 */
+	struct Batch {
+		long offset;            // position in the file
+		std::vector<double> lb; // objective lower bounds (sorted)
+		unsigned int pos;       // next box to read
+	};
+
+	/*
+	 * Update the minimum and discard exhausted batches.
+	 */
+	void update();
+
+	/*
+	 * Rewrite the remaining boxes of the batches in a new file.
+	 */
+	void compact();
+
+	/* the file (NULL if not created yet). */
+	FILE* file;
+
+	/* number of boxes in the file (see file_size()). */
+	unsigned long _file_size;
+
+	/* the batches with remaining boxes. */
+	std::vector<Batch> batches;
+
+	/* boxes with an objective lower bound greater than this bound are discarded. */
+	double bound;
+
+	/* current minimum. */
+	double _minimum;
+
+	/* current size. */
+	unsigned int _size;
+
+	unsigned long _nb_written;
+	unsigned long _nb_read;
+
+	/* buffer for one box (lower and upper bounds). */
+	std::vector<double> record;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline bool CellSpill::empty() const {
+	return _size==0;
+}
+
+inline unsigned int CellSpill::size() const {
+	return _size;
+}
+
+inline double CellSpill::minimum() const {
+	return _minimum;
+}
+
+inline unsigned long CellSpill::nb_written() const {
+	return _nb_written;
+}
+
+inline unsigned long CellSpill::nb_read() const {
+	return _nb_read;
+}
+
+inline unsigned long CellSpill::file_size() const {
+	return _file_size;
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_CELL_SPILL_H__ */
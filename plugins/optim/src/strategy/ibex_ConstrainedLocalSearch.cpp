@@ -0,0 +1,212 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ConstrainedLocalSearch.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_ConstrainedLocalSearch.h"
+
+#include <vector>
+#include <math.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * The augmented Lagrangian of a system:
+ *
+ *   f(x) + sum_{eq}   [ lambda_j*c_j(x) + mu/2*c_j(x)^2 ]
+ *        + sum_{ineq} [ max(0,lambda_j+mu*c_j(x))^2 - lambda_j^2 ] / (2*mu)
+ *
+ * where c_j(x)<=0 (resp. c_j(x)=0) is the jth inequality (resp. equality).
+ * Evaluated at points only: the result is a degenerated interval
+ * (empty if the point is outside of the definition domain).
+ */
+class AugmentedLagrangian : public Fnc {
+public:
+	AugmentedLagrangian(const System& sys, double margin) : Fnc(sys.nb_var,1), sys(sys), margin(margin),
+			m(sys.nb_ctr>0? sys.f_ctrs.image_dim() : 0), lambda(m,0.0), mu(initial_mu) { }
+
+	/*
+	 * Compute c(x). Return false if x is outside of the definition domain.
+	 */
+	bool constraints(const IntervalVector& x, vector<double>& c) const {
+		if (m==0) return true;
+
+		IntervalVector gx=sys.f_ctrs.eval_vector(x);
+		if (gx.is_empty() || gx.is_unbounded()) return false;
+
+		for (int j=0; j<m; j++) {
+			switch (sys.ops[j]) {
+			case LT:
+			case LEQ: c[j] = gx[j].mid() + margin; break;
+			case GEQ:
+			case GT:  c[j] = -gx[j].mid() + margin; break;
+			default:  c[j] = gx[j].mid(); // EQ
+			}
+		}
+		return true;
+	}
+
+	/*
+	 * Coefficient of grad c_j in the gradient of the Lagrangian.
+	 */
+	double weight(int j, double cj) const {
+		if (sys.ops[j]==EQ)
+			return lambda[j]+mu*cj;
+		else
+			return std::max(0.0, lambda[j]+mu*cj);
+	}
+
+	virtual Interval eval(const IntervalVector& x) const {
+		Interval fx=sys.goal->eval(x);
+		if (fx.is_empty() || fx.is_unbounded()) return Interval::empty_set();
+
+		vector<double> c(m);
+		if (!constraints(x,c)) return Interval::empty_set();
+
+		double phi=fx.mid();
+		for (int j=0; j<m; j++) {
+			if (sys.ops[j]==EQ)
+				phi += lambda[j]*c[j] + 0.5*mu*c[j]*c[j];
+			else {
+				double t=weight(j,c[j]);
+				phi += (t*t-lambda[j]*lambda[j])/(2*mu);
+			}
+		}
+		return Interval(phi);
+	}
+
+	virtual void gradient(const IntervalVector& x, IntervalVector& g) const {
+		IntervalVector gf=sys.goal->gradient(x);
+		vector<double> c(m);
+
+		if (gf.is_empty() || gf.is_unbounded() || !constraints(x,c)) {
+			g.set_empty();
+			return;
+		}
+
+		Vector grad=gf.mid();
+
+		// only the rows of active or violated constraints are calculated
+		BitSet rows(BitSet::empty(m>0? m : 1));
+		for (int j=0; j<m; j++)
+			if (weight(j,c[j])!=0) rows.add(j);
+
+		if (!rows.empty()) {
+			IntervalMatrix J=sys.f_ctrs.jacobian(x,rows);
+			if (J.is_empty() || J.is_unbounded()) {
+				g.set_empty();
+				return;
+			}
+			int k=0;
+			for (BitSet::const_iterator it=rows.begin(); it!=rows.end(); ++it, k++) {
+				int j=it;
+				double w=weight(j,c[j]);
+				if (sys.ops[j]==GEQ || sys.ops[j]==GT) w=-w;
+				grad += w*J[k].mid();
+			}
+		}
+		g=grad;
+	}
+
+	/*
+	 * Violation of the constraints (and of complementarity, for
+	 * inequalities) at a point where c is the value of the constraints.
+	 */
+	double violation(const vector<double>& c) const {
+		double v=0;
+		for (int j=0; j<m; j++) {
+			double vj= sys.ops[j]==EQ ? fabs(c[j]) : fabs(std::max(c[j], -lambda[j]/mu));
+			if (vj>v) v=vj;
+		}
+		return v;
+	}
+
+	void update_multipliers(const vector<double>& c) {
+		for (int j=0; j<m; j++)
+			lambda[j]=weight(j,c[j]);
+	}
+
+	static constexpr double initial_mu = 10;
+	static constexpr double max_mu = 1e8;
+
+	const System& sys;
+	const double margin;
+	const int m;
+	vector<double> lambda;
+	double mu;
+};
+
+}
+
+ConstrainedLocalSearch::ConstrainedLocalSearch(const System& sys, const IntervalVector& box, double margin) :
+		sys(sys), margin(margin), box(box), niter(0) {
+
+	if (!sys.goal)
+		ibex_error("[ConstrainedLocalSearch] the system has no goal");
+}
+
+ConstrainedLocalSearch::ReturnCode ConstrainedLocalSearch::minimize(const Vector& x0, Vector& x_min, double eps, int max_iter) {
+
+	AugmentedLagrangian L(sys, margin);
+	UnconstrainedLocalSearch inner(L, box);
+
+	x_min = x0;
+	for (int i=0; i<x_min.size(); i++) {
+		if (x_min[i]<box[i].lb()) x_min[i]=box[i].lb();
+		if (x_min[i]>box[i].ub()) x_min[i]=box[i].ub();
+	}
+
+	if (L.m==0) {
+		// unconstrained: the inner problem is the problem itself
+		niter=1;
+		return inner.minimize(x_min, x_min, eps, max_inner_iter);
+	}
+
+	// omega: tolerance of the inner problem
+	// eta:   tolerance on the constraints violation
+	double omega=1/L.mu;
+	double eta=1/::pow(L.mu,0.1);
+
+	vector<double> c(L.m);
+
+	for (niter=0; niter<max_iter; niter++) {
+
+		if (inner.minimize(x_min, x_min, std::max(omega,eps), max_inner_iter)==UnconstrainedLocalSearch::INVALID_POINT)
+			return UnconstrainedLocalSearch::INVALID_POINT;
+
+		if (!L.constraints(x_min,c))
+			return UnconstrainedLocalSearch::INVALID_POINT;
+
+		double v=L.violation(c);
+
+		if (v<=eta) {
+			if (v<=eps && omega<=eps)
+				return UnconstrainedLocalSearch::SUCCESS;
+
+			// the constraints are sufficiently satisfied:
+			// update the multipliers and tighten the tolerances
+			L.update_multipliers(c);
+			eta=eta/::pow(L.mu,0.9);
+			omega=omega/L.mu;
+		} else {
+			// increase the penalty
+			if (L.mu<AugmentedLagrangian::max_mu) L.mu*=10;
+			eta=1/::pow(L.mu,0.1);
+			omega=1/L.mu;
+		}
+
+		if (eta<eps) eta=eps;
+		if (omega<eps) omega=eps;
+	}
+
+	return UnconstrainedLocalSearch::TOO_MANY_ITER;
+}
+
+} // end namespace
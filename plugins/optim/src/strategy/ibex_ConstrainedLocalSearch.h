@@ -0,0 +1,118 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ConstrainedLocalSearch.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CONSTRAINED_LOCAL_SEARCH_H__
+#define __IBEX_CONSTRAINED_LOCAL_SEARCH_H__
+
+#include "ibex_UnconstrainedLocalSearch.h"
+#include "ibex_System.h"
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Local optimizer for constrained problems (augmented Lagrangian).
+ *
+ * Minimizes the goal of a system subject to its constraints and
+ * to boundary constraints (a bounding box).
+ *
+ * The constraints are handled by a Powell-Hestenes-Rockafellar
+ * augmented Lagrangian: each outer iteration minimizes the augmented
+ * Lagrangian w.r.t. the bounding box with UnconstrainedLocalSearch
+ * and then updates either the multipliers or the penalty parameter
+ * (see Nocedal & Wright, Numerical Optimization, Framework 17.3).
+ *
+ * All evaluations are made at points (degenerated boxes). Only the
+ * rows of the Jacobian matrix corresponding to active or violated
+ * constraints are computed.
+ *
+ * The result is a local minimum that satisfies the constraints up to
+ * the precision, which is not rigorous; see LoupFinderLocalSearch.
+ */
+class ConstrainedLocalSearch {
+public:
+
+	typedef UnconstrainedLocalSearch::ReturnCode ReturnCode;
+
+	/**
+	 * \brief Build the local optimizer.
+	 *
+	 * \param sys    - the system (goal and constraints)
+	 * \param box    - the bounding box (boundary constraints)
+	 * \param margin - the inequalities g(x)<=0 are enforced as
+	 *                 g(x)<=-margin (to favour strictly feasible points).
+	 */
+	ConstrainedLocalSearch(const System& sys, const IntervalVector& box, double margin=default_margin);
+
+	/**
+	 * \brief Run the optimization.
+	 *
+	 * \return - SUCCESS if a local minimum is found, TOO_MANY_ITER if
+	 *           the number of outer iterations has exceeded max_iter
+	 *           and INVALID_POINT if an iterate is outside of the definition
+	 *           domain of the functions. x_min contains the last point found.
+	 *
+	 * \param x0       - initial point (projected onto the bounding box)
+	 * \param x_min    - final point
+	 * \param eps      - precision on the constraints violation and on
+	 *                   the projected gradient of the last inner problem.
+	 * \param max_iter - maximal number of outer iterations.
+	 */
+	ReturnCode minimize(const Vector& x0, Vector& x_min, double eps=default_eps, int max_iter=default_max_iter);
+
+	/**
+	 * \brief Get the number of outer iterations of the last minimization.
+	 */
+	int nb_iter() const;
+
+	/**
+	 * \brief Set the bounding box.
+	 */
+	void set_box(const IntervalVector& box);
+
+	/** Default precision: 1e-8. */
+	static constexpr double default_eps = 1e-08;
+
+	/** Default number of outer iterations: 10. */
+	static constexpr int default_max_iter = 10;
+
+	/** Default margin for inequalities: 1e-9. */
+	static constexpr double default_margin = 1e-09;
+
+	/** Maximal number of iterations of each inner minimization: 50. */
+	static constexpr int max_inner_iter = 50;
+
+	/**
+	 * \brief The system.
+	 */
+	const System& sys;
+
+	/**
+	 * \brief Margin for inequalities.
+	 */
+	const double margin;
+
+private:
+	IntervalVector box; // bounding box
+	int niter;          // number of outer iterations
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline int ConstrainedLocalSearch::nb_iter() const {
+	return niter;
+}
+
+inline void ConstrainedLocalSearch::set_box(const IntervalVector& box1) {
+	box = box1;
+}
+
+} // end namespace
+
+#endif /* __IBEX_CONSTRAINED_LOCAL_SEARCH_H__ */
@@ -20,6 +20,7 @@
 #include "ibex_LSmear.h"
 #include "ibex_LoupFinderDefault.h"
 #include "ibex_LoupFinderCertify.h"
+#include "ibex_LoupFinderLocalSearch.h"
 #include "ibex_Array.h"
 #include "ibex_Random.h"
 #include "ibex_CellBeamSearch.h"
@@ -49,6 +50,10 @@ DefaultOptimizerConfig::DefaultOptimizerConfig(const System& sys) : sys(sys), kk
 	// by defaut, we apply KKT for unconstrained problems
 	set_kkt(sys.nb_ctr==0);
 	set_random_seed(default_random_seed);
+	set_local_search(default_local_search);
+	set_nb_loup_threads(default_nb_loup_threads);
+	set_beam_width(CellBeamSearch::default_beamsize);
+	set_nb_beam_threads(default_nb_beam_threads);
 }
 
 // note:deprecated.
@@ -64,6 +69,10 @@ DefaultOptimizerConfig::DefaultOptimizerConfig(const System& sys, double rel_eps
 	set_kkt(kkt);
 	set_random_seed(random_seed);
 	set_eps_x(eps_x);
+	set_local_search(default_local_search);
+	set_nb_loup_threads(default_nb_loup_threads);
+	set_beam_width(CellBeamSearch::default_beamsize);
+	set_nb_beam_threads(default_nb_beam_threads);
 }
 
 DefaultOptimizerConfig::~DefaultOptimizerConfig() {
@@ -120,16 +129,34 @@ void DefaultOptimizerConfig::set_random_seed(double _random_seed) {
 	RNG::srand(random_seed);
 }
 
+void DefaultOptimizerConfig::set_local_search(bool _local_search) {
+	local_search = _local_search;
+}
+
+void DefaultOptimizerConfig::set_nb_loup_threads(int _nb_loup_threads) {
+	nb_loup_threads = _nb_loup_threads;
+}
+
+void DefaultOptimizerConfig::set_beam_width(unsigned int _beam_width) {
+	beam_width = _beam_width;
+}
+
+void DefaultOptimizerConfig::set_nb_beam_threads(int _nb_beam_threads) {
+	nb_beam_threads = _nb_beam_threads;
+}
+
 // The two next functions are necessary because we need
 // the normalized and extended system to build
 // arguments of the base class constructor (ctc, bsc, loup finder, etc.)
-// and we don't know which argument is evaluated first
+// and we don't know which argument is evaluated first.
+// Note: the normalized system shares the constraints left unchanged
+// with the original system (which outlives this object).
 
 NormalizedSystem& DefaultOptimizerConfig::get_norm_sys() {
 	if (found(NORMALIZED_SYSTEM_TAG)) {
 		return get<NormalizedSystem>(NORMALIZED_SYSTEM_TAG);
 	} else {
-		return rec(new NormalizedSystem(sys,eps_h), NORMALIZED_SYSTEM_TAG);
+		return rec(new NormalizedSystem(sys,eps_h,false,true), NORMALIZED_SYSTEM_TAG);
 	}
 }
 
@@ -149,8 +176,10 @@ Ctc& DefaultOptimizerConfig::get_ctc() {
 	if (found(CTC_TAG)) // in practice, get_ctc() is only called once by Optimizer.
 		return get<Ctc>(CTC_TAG);
 
-	const ExtendedSystem& ext_sys = get_ext_sys();
+	return rec(new_ctc(get_ext_sys(), get_norm_sys()), CTC_TAG);
+}
 
+Ctc* DefaultOptimizerConfig::new_ctc(const ExtendedSystem& ext_sys, const NormalizedSystem& norm_sys) {
 	Array<Ctc> ctc_list(kkt? 4 : 3);
 
 	// first contractor on ext_sys : incremental HC4 (propag ratio=0.01)
@@ -169,10 +198,10 @@ Ctc& DefaultOptimizerConfig::get_ctc() {
 	}
 
 	if (kkt) {
-		ctc_list.set_ref(3, rec(new CtcKuhnTucker(get_norm_sys(),true)));
-		//ctc_list.set_ref(3, rec(new CtcKuhnTuckerLP(get_norm_sys(sys,eps_h),true)));
+		ctc_list.set_ref(3, rec(new CtcKuhnTucker(norm_sys,true)));
+		//ctc_list.set_ref(3, rec(new CtcKuhnTuckerLP(norm_sys,true)));
 	}
-	return rec(new CtcCompo(ctc_list), CTC_TAG);
+	return new CtcCompo(ctc_list);
 }
 
 
@@ -190,10 +219,19 @@ LoupFinder& DefaultOptimizerConfig::get_loup_finder() {
 	if (found(LOUP_FINDER_TAG)) // in practice, get_loup_finder() is only called once by Optimizer.
 			return get<LoupFinder>(LOUP_FINDER_TAG);
 
-	const NormalizedSystem& norm_sys = get_norm_sys();
+	return rec(new_loup_finder(sys, get_norm_sys()), LOUP_FINDER_TAG);
+}
+
+LoupFinder* DefaultOptimizerConfig::new_loup_finder(const System& sys, const NormalizedSystem& norm_sys) {
+	LoupFinder* finder = new LoupFinderDefault(norm_sys, inHC4);
 
-	return rec(rigor? (LoupFinder*) new LoupFinderCertify(sys,rec(new LoupFinderDefault(norm_sys, inHC4))) :
-			(LoupFinder*) new LoupFinderDefault(norm_sys, inHC4), LOUP_FINDER_TAG);
+	if (local_search)
+		finder = new LoupFinderLocalSearch(norm_sys, rec(finder));
+
+	if (rigor)
+		finder = new LoupFinderCertify(sys, rec(finder));
+
+	return finder;
 }
 
 CellBufferOptim& DefaultOptimizerConfig::get_cell_buffer() {
@@ -206,11 +244,49 @@ CellBufferOptim& DefaultOptimizerConfig::get_cell_buffer() {
 	return (CellBufferOptim&) rec (new  CellBeamSearch (
 			(CellHeap&) rec (new CellHeap (ext_sys)),
 			(CellHeap&) rec (new CellHeap (ext_sys)),
-			ext_sys), CELL_BUFFER_TAG);
+			ext_sys, beam_width), CELL_BUFFER_TAG);
 }
 
 int DefaultOptimizerConfig::goal_var() {
 	return get_ext_sys().goal_var();
 }
 
+Array<LoupFinder> DefaultOptimizerConfig::get_async_loup_finders() {
+	Array<LoupFinder> finders(nb_loup_threads>0? nb_loup_threads : 0);
+
+	// Each thread has its own copy of the system (functions are not thread-safe).
+	for (int i=0; i<nb_loup_threads; i++) {
+		const System& sys_copy = rec(new System(sys,System::COPY));
+		const NormalizedSystem& norm_sys = rec(new NormalizedSystem(sys_copy,eps_h,false,true));
+
+		finders.set_ref(i, rec(new_loup_finder(sys_copy, norm_sys)));
+	}
+
+	return finders;
+}
+
+void DefaultOptimizerConfig::build_beam_workers() {
+	if (nb_beam_threads<=1 || beam_ctcs.size()>0) return;
+
+	// Each thread has its own copy of the system (functions are not thread-safe).
+	for (int i=1; i<nb_beam_threads; i++) {
+		const System& sys_copy = rec(new System(sys,System::COPY));
+		const ExtendedSystem& ext_sys = rec(new ExtendedSystem(sys_copy,eps_h));
+		const NormalizedSystem& norm_sys = rec(new NormalizedSystem(sys_copy,eps_h,false,true));
+
+		beam_ctcs.add(rec(new_ctc(ext_sys, norm_sys)));
+		beam_finders.add(rec(new_loup_finder(sys_copy, norm_sys)));
+	}
+}
+
+Array<Ctc> DefaultOptimizerConfig::get_beam_ctcs() {
+	build_beam_workers();
+	return beam_ctcs;
+}
+
+Array<LoupFinder> DefaultOptimizerConfig::get_beam_loup_finders() {
+	build_beam_workers();
+	return beam_finders;
+}
+
 } /* namespace ibex */
@@ -98,6 +98,44 @@ public:
 	 */
 	void set_random_seed(double random_seed);
 
+	/**
+	 * \brief Activate/deactivate the local solver in upper bounding.
+	 *
+	 * If true, the candidate points of the default loup finder are
+	 * improved by a constrained local solver (see LoupFinderLocalSearch).
+	 * By default: #default_local_search.
+	 */
+	void set_local_search(bool local_search);
+
+	/**
+	 * \brief Set the number of threads of the asynchronous upper bounding.
+	 *
+	 * If positive, the upper bounding is run asynchronously by
+	 * this number of threads, each one with its own copy of the
+	 * system (see Optimizer::set_async_upper_bounding).
+	 * By default: #default_nb_loup_threads (synchronous upper bounding).
+	 */
+	void set_nb_loup_threads(int nb_loup_threads);
+
+	/**
+	 * \brief Set the beam size of the buffer.
+	 *
+	 * Maximal number of cells in the current beam of the
+	 * beam search (see CellBeamSearch).
+	 * By default: #CellBeamSearch::default_beamsize.
+	 */
+	void set_beam_width(unsigned int beam_width);
+
+	/**
+	 * \brief Set the number of threads of the parallel beam search.
+	 *
+	 * If greater than 1, the children of the whole beam are contracted
+	 * and bounded by this number of threads, each additional thread
+	 * having its own copy of the system (see Optimizer::set_parallel_beam).
+	 * By default: #default_nb_beam_threads (sequential search).
+	 */
+	void set_nb_beam_threads(int nb_beam_threads);
+
 	/** \see #set_eps_h(). */
 	double get_eps_h();
 
@@ -113,6 +151,18 @@ public:
 	/** \see #set_random_seed(). */
 	double get_random_seed();
 
+	/** \see #set_local_search(). */
+	bool with_local_search();
+
+	/** \see #set_nb_loup_threads(). */
+	int get_nb_loup_threads();
+
+	/** \see #set_beam_width(). */
+	unsigned int get_beam_width();
+
+	/** \see #set_nb_beam_threads(). */
+	int get_nb_beam_threads();
+
 	/** Default random seed: 1.0. */
 	static constexpr double default_random_seed = 1.0;
 
@@ -122,6 +172,15 @@ public:
 	/** Default inHC4 mode: true (enabled). */
 	static constexpr bool default_inHC4 = true;
 
+	/** Default local search mode: false (disabled). */
+	static constexpr bool default_local_search = false;
+
+	/** Default number of asynchronous upper bounding threads: 0 (disabled). */
+	static constexpr int default_nb_loup_threads = 0;
+
+	/** Default number of parallel beam search threads: 0 (disabled). */
+	static constexpr int default_nb_beam_threads = 0;
+
 	/** Default fix-point ratio for contraction based on linear relaxation. */
 	static constexpr double default_relax_ratio = 0.2;
 
@@ -142,6 +201,12 @@ protected:
 	virtual CellBufferOptim& get_cell_buffer();
 
 	virtual int goal_var();
+
+	virtual Array<LoupFinder> get_async_loup_finders();
+
+	virtual Array<Ctc> get_beam_ctcs();
+
+	virtual Array<LoupFinder> get_beam_loup_finders();
 	// ============================================================================
 
 	/**
@@ -156,6 +221,25 @@ protected:
 	 */
 	ExtendedSystem& get_ext_sys();
 
+	/**
+	 * Build a loup finder for the system \a sys, \a norm_sys
+	 * being its normalized version (the result is not recorded).
+	 */
+	LoupFinder* new_loup_finder(const System& sys, const NormalizedSystem& norm_sys);
+
+	/**
+	 * Build a contractor for the extended system \a ext_sys,
+	 * \a norm_sys being the normalized version of the same
+	 * system (only used with KKT).
+	 */
+	Ctc* new_ctc(const ExtendedSystem& ext_sys, const NormalizedSystem& norm_sys);
+
+	/*
+	 * Build the contractors and loup finders of the
+	 * parallel beam search (on copies of the system).
+	 */
+	void build_beam_workers();
+
 	const System& sys;
 
 	double eps_h;
@@ -163,6 +247,12 @@ protected:
 	bool inHC4;
 	bool kkt;
 	double random_seed;
+	bool local_search;
+	int nb_loup_threads;
+	unsigned int beam_width;
+	int nb_beam_threads;
+	Array<Ctc> beam_ctcs;
+	Array<LoupFinder> beam_finders;
 };
 
 
@@ -176,6 +266,14 @@ inline bool DefaultOptimizerConfig::with_kkt() { return kkt; }
 
 inline double DefaultOptimizerConfig::get_random_seed() { return random_seed; }
 
+inline bool DefaultOptimizerConfig::with_local_search() { return local_search; }
+
+inline int DefaultOptimizerConfig::get_nb_loup_threads() { return nb_loup_threads; }
+
+inline unsigned int DefaultOptimizerConfig::get_beam_width() { return beam_width; }
+
+inline int DefaultOptimizerConfig::get_nb_beam_threads() { return nb_beam_threads; }
+
 } /* namespace ibex */
 
 #endif /* __IBEX_DEFAULT_OPTIMIZER_CONFIG_H__ */
@@ -77,7 +77,8 @@ Vector LineSearch::endpoint() {
 			x2[i] += alpha1*d[i];
 			// check we do not touch a face we are not supposed to touch
 			//  cout << " [endpoint] test contains " << x2[i] << " in " << box[i] << endl;
-			assert(box[i].interior_contains(x2[i]));
+			// note: with a tiny step, x2[i] may be rounded to the bound x[i] starts from
+			assert(box[i].interior_contains(x2[i]) || x2[i]==x[i]);
 		}
 	}
 	assert(box.contains(x2));
@@ -13,15 +13,49 @@
 #include "ibex_NoBisectableVariableException.h"
 #include "ibex_BxpOptimData.h"
 #include "ibex_CovOptimData.h"
+#include "ibex_LoupFinderPool.h"
+#include "ibex_CellSpill.h"
+#include "ibex_CellBeamSearch.h"
+#include "ibex_Random.h"
 
 #include <float.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <iomanip>
+#include <future>
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+/*
+ * Adds the wall-clock time elapsed in the current scope
+ * to a counter, if profiling is enabled.
+ */
+class ScopeTimer {
+public:
+	ScopeTimer(double& total) : total(total), start(CtcProfile::enabled? CtcProfile::wall_time() : 0) { }
+
+	~ScopeTimer() {
+		if (CtcProfile::enabled) total += CtcProfile::wall_time()-start;
+	}
+
+private:
+	double& total;
+	const double start;
+};
+
+/*
+ * Bound of the seeds of the random generators of the
+ * parallel beam search threads (the cost of RNG::srand
+ * is linear in the seed).
+ */
+const uint32_t max_beam_seed = 1024;
+
+}
+
 /*
  * TODO: redundant with ExtendedSystem.
  */
@@ -47,11 +81,11 @@ Optimizer::Optimizer(int n, Ctc& ctc, Bsc& bsc, LoupFinder& finder,
                 						n(n), goal_var(goal_var),
 										ctc(ctc), bsc(bsc), loup_finder(finder), buffer(buffer),
 										eps_x(eps_x), rel_eps_f(rel_eps_f), abs_eps_f(abs_eps_f),
-										trace(0), timeout(-1), extended_COV(true), anticipated_upper_bounding(true),
-										status(SUCCESS),
+										trace(0), timeout(-1), extended_COV(true), anticipated_upper_bounding(true), max_cells(0),
+										listener(NULL), cancellation(NULL), status(SUCCESS),
 										uplo(NEG_INFINITY), uplo_of_epsboxes(POS_INFINITY), loup(POS_INFINITY),
-										loup_point(IntervalVector::empty(n)), initial_loup(POS_INFINITY), loup_changed(false),
-										time(0), nb_cells(0), cov(NULL) {
+										loup_point(IntervalVector::empty(n)), search_box(IntervalVector::empty(n)), initial_loup(POS_INFINITY), loup_changed(false),
+										time(0), first_loup_time(-1), nb_cells(0), next_milestone(1), interrupted(false), buffer_time(0), pool(NULL), spill(NULL), beam(NULL), beam_pool(NULL), cov(NULL) {
 
 	if (trace) cout.precision(12);
 }
@@ -71,17 +105,76 @@ Optimizer::Optimizer(OptimizerConfig& config) :
 		timeout     (config.get_timeout()),
 		extended_COV(config.with_extended_cov()),
 		anticipated_upper_bounding(config.with_anticipated_upper_bounding()),
+		max_cells   (config.get_max_cells()),
+		listener    (NULL),
+		cancellation(NULL),
 		status(SUCCESS),
 		uplo(NEG_INFINITY), uplo_of_epsboxes(POS_INFINITY), loup(POS_INFINITY),
-		loup_point(IntervalVector::empty(n)), initial_loup(POS_INFINITY), loup_changed(false),
-		time(0), nb_cells(0), cov(NULL) {
+		loup_point(IntervalVector::empty(n)), search_box(IntervalVector::empty(n)), initial_loup(POS_INFINITY), loup_changed(false),
+		time(0), first_loup_time(-1), nb_cells(0), next_milestone(1), interrupted(false), buffer_time(0), pool(NULL), spill(NULL), beam(NULL), beam_pool(NULL), cov(NULL) {
+
+	Array<LoupFinder> finders=config.get_async_loup_finders();
+	if (finders.size()>0)
+		set_async_upper_bounding(finders);
 
+	Array<Ctc> beam_ctcs=config.get_beam_ctcs();
+	Array<LoupFinder> beam_finders=config.get_beam_loup_finders();
+	if (beam_ctcs.size()>0)
+		set_parallel_beam(beam_ctcs, beam_finders);
 }
 
 Optimizer::~Optimizer() {
+	if (pool) delete pool;
+	if (spill) delete spill;
+	if (beam_pool) delete beam_pool;
 	if (cov) delete cov;
 }
 
+void Optimizer::set_async_upper_bounding(const Array<LoupFinder>& finders) {
+	if (pool) {
+		delete pool;
+		pool = NULL;
+	}
+
+	if (finders.size()==0) return;
+
+	if (beam)
+		ibex_error("[Optimizer] asynchronous upper bounding is not compatible with the parallel beam search");
+
+	for (int i=0; i<finders.size(); i++)
+		if (loup_finder.rigorous() && !finders[i].rigorous())
+			ibex_error("[Optimizer] asynchronous loup finders must be rigorous (see LoupFinderCertify)");
+
+	pool = new LoupFinderPool(finders);
+}
+
+void Optimizer::set_parallel_beam(const Array<Ctc>& ctcs, const Array<LoupFinder>& finders) {
+	if (ctcs.size()!=finders.size())
+		ibex_error("[Optimizer] parallel beam search: one contractor and one loup finder are required per thread");
+
+	if (pool)
+		ibex_error("[Optimizer] parallel beam search is not compatible with asynchronous upper bounding");
+
+	beam = dynamic_cast<CellBeamSearch*>(&buffer);
+	if (!beam)
+		ibex_error("[Optimizer] parallel beam search requires a CellBeamSearch buffer");
+
+	beam_ctcs.clear();
+	beam_finders.clear();
+
+	for (int i=0; i<ctcs.size(); i++) {
+		if (ctcs[i].nb_var!=ctc.nb_var)
+			ibex_error("[Optimizer] parallel beam search: bad number of variables for a contractor");
+		if (loup_finder.rigorous() && !finders[i].rigorous())
+			ibex_error("[Optimizer] parallel beam search: loup finders must be rigorous (see LoupFinderCertify)");
+		beam_ctcs.push_back(&ctcs[i]);
+		beam_finders.push_back(&finders[i]);
+	}
+
+	if (beam_pool) delete beam_pool;
+	beam_pool = new ThreadPool(beam_ctcs.size()+1);
+}
+
 // compute the value ymax (decreasing the loup with the precision)
 // the heap and the current box are contracted with y <= ymax
 double Optimizer::compute_ymax() {
@@ -124,6 +217,17 @@ bool Optimizer::update_loup(const IntervalVector& box, BoxProperties& prop) {
 	}
 }
 
+bool Optimizer::poll_loup() {
+	if (!pool->poll(loup_point, loup))
+		return false;
+
+	if (trace) {
+		cout << "                    ";
+		cout << "\033[32m loup= " << loup << "\033[0m" << endl;
+	}
+	return true;
+}
+
 //bool Optimizer::update_entailed_ctr(const IntervalVector& box) {
 //	for (int j=0; j<m; j++) {
 //		if (entailed->normalized(j)) {
@@ -141,8 +245,14 @@ bool Optimizer::update_loup(const IntervalVector& box, BoxProperties& prop) {
 void Optimizer::update_uplo() {
 	double new_uplo=POS_INFINITY;
 
-	if (! buffer.empty()) {
-		new_uplo= buffer.minimum();
+	// the cells on disk count
+	bool spilled=spill && !spill->empty();
+
+	if (! buffer.empty() || spilled) {
+		if (! buffer.empty())
+			new_uplo= buffer.minimum();
+		if (spilled && spill->minimum() < new_uplo)
+			new_uplo= spill->minimum();
 		if (new_uplo > loup && uplo_of_epsboxes > loup) {
 			cout << " loup = " << loup << " new_uplo=" << new_uplo <<  " uplo_of_epsboxes=" << uplo_of_epsboxes << endl;
 			ibex_error("optimizer: new_uplo>loup (please report bug)");
@@ -163,7 +273,7 @@ void Optimizer::update_uplo() {
 		}
 		else uplo = uplo_of_epsboxes;
 	}
-	else if (buffer.empty() && loup != POS_INFINITY) {
+	else if (loup != POS_INFINITY) {
 		// empty buffer : new uplo is set to ymax (loup - precision) if a loup has been found
 		new_uplo=compute_ymax(); // not new_uplo=loup, because constraint y <= ymax was enforced
 		//    cout << " new uplo buffer empty " << new_uplo << " uplo " << uplo << endl;
@@ -192,6 +302,60 @@ void Optimizer::update_uplo_of_epsboxes(double ymin) {
 	}
 }
 
+void Optimizer::spill_cells() {
+	vector<Cell*> cells;
+	{
+		ScopeTimer t(buffer_time);
+		buffer.shrink(max_cells/2, cells);
+	}
+	spill->write(cells);
+}
+
+void Optimizer::reload_cells() {
+
+	if (spill->empty()) return;
+
+	// the cells with a lower bound less than the best cell of
+	// the buffer are reloaded (half of max_cells at most)
+	double threshold=buffer.empty()? POS_INFINITY : buffer.minimum();
+
+	for (unsigned int k=0; k<max_cells/2 || k==0; k++) {
+
+		if (spill->empty() || spill->minimum() >= threshold) break;
+
+		Cell* cell=new Cell(spill->read());
+
+		// the properties have to be rebuilt (see start(const CovOptimData&,...))
+		bsc.add_property(cell->box, cell->prop);
+		ctc.add_property(cell->box, cell->prop);
+		loup_finder.add_property(cell->box, cell->prop);
+		{
+			ScopeTimer t(buffer_time);
+			buffer.add_property(cell->box, cell->prop);
+			buffer.push(cell);
+		}
+	}
+}
+
+void Optimizer::notify(double old_loup, double old_uplo, size_t old_nb_cells) {
+
+	if (loup < old_loup)
+		listener->loup_updated(*this);
+
+	if (uplo > old_uplo)
+		listener->uplo_updated(*this);
+
+	if (nb_cells/listener->period > old_nb_cells/listener->period)
+		listener->cells_handled(*this);
+
+	unsigned int size=buffer.size();
+	if (size >= next_milestone) {
+		listener->buffer_milestone(*this, size);
+		while (next_milestone <= size && next_milestone < UINT_MAX/2)
+			next_milestone *= 2;
+	}
+}
+
 void Optimizer::handle_cell(Cell& c) {
 
 	contract_and_bound(c);
@@ -199,11 +363,12 @@ void Optimizer::handle_cell(Cell& c) {
 	if (c.box.is_empty()) {
 		delete &c;
 	} else {
+		ScopeTimer t(buffer_time);
 		buffer.push(&c);
 	}
 }
 
-void Optimizer::contract_and_bound(Cell& c) {
+bool Optimizer::contract_cell(Cell& c, Ctc& contractor) {
 
 	/*======================== contract y with y<=loup ========================*/
 	Interval& y=c.box[goal_var];
@@ -218,7 +383,7 @@ void Optimizer::contract_and_bound(Cell& c) {
 
 	if (y.is_empty()) {
 		c.box.set_empty();
-		return;
+		return false;
 	} else {
 		c.prop.update(BoxEvent(c.box,BoxEvent::CONTRACT,BitSet::singleton(n+1,goal_var)));
 	}
@@ -228,20 +393,27 @@ void Optimizer::contract_and_bound(Cell& c) {
 	//cout << " [contract]  y before=" << y << endl;
 
 	ContractContext context(c.prop);
+	context.cancellation = cancellation;
 	if (c.bisected_var!=-1) {
 		context.impact.clear();
 		context.impact.add(c.bisected_var);
 		context.impact.add(goal_var);
 	}
 
-	ctc.contract(c.box, context);
+	contractor.profiled_contract(c.box, context);
 	//cout << c.prop << endl;
-	if (c.box.is_empty()) return;
 
 	//cout << " [contract]  x after=" << c.box << endl;
 	//cout << " [contract]  y after=" << y << endl;
 	/*====================================================================*/
 
+	return !c.box.is_empty();
+}
+
+void Optimizer::contract_and_bound(Cell& c) {
+
+	if (!contract_cell(c, ctc)) return;
+
 	/*========================= update loup =============================*/
 
 	IntervalVector tmp_box(n);
@@ -249,7 +421,20 @@ void Optimizer::contract_and_bound(Cell& c) {
 
 	c.prop.update(BoxEvent(c.box,BoxEvent::CHANGE));
 
-	bool loup_ch=update_loup(tmp_box, c.prop);
+	bool loup_ch;
+
+	if (pool) {
+		pool->submit(tmp_box, c.box[goal_var].lb());
+		loup_ch=poll_loup();
+	} else
+		loup_ch=update_loup(tmp_box, c.prop);
+
+	bound_cell(c, tmp_box, loup_ch);
+}
+
+void Optimizer::bound_cell(Cell& c, IntervalVector& tmp_box, bool loup_ch) {
+
+	Interval& y=c.box[goal_var];
 
 	// update of the upper bound of y in case of a new loup found
 	if (loup_ch) {
@@ -290,6 +475,124 @@ void Optimizer::contract_and_bound(Cell& c) {
 	}
 }
 
+void Optimizer::contract_and_bound_beam(vector<Cell*>& cells, size_t first, size_t step,
+		Ctc& contractor, LoupFinder& finder, vector<pair<IntervalVector,double> >& found, int seed) {
+
+	if (seed>=0) RNG::srand(seed);
+
+	for (size_t i=first; i<cells.size(); i+=step) {
+		Cell& c=*cells[i];
+
+		if (!contract_cell(c, contractor)) continue;
+
+		IntervalVector box(n);
+		read_ext_box(c.box,box);
+
+		c.prop.update(BoxEvent(c.box,BoxEvent::CHANGE));
+
+		// the loup is only read (it is updated after all the threads are done)
+		try {
+			found[i]=finder.find(box,loup_point,loup,c.prop);
+		} catch(LoupFinder::NotFound&) { }
+	}
+}
+
+void Optimizer::handle_beam() {
+
+	vector<Cell*> cells;
+	{
+		ScopeTimer t(buffer_time);
+		beam->pop_beam(cells);
+	}
+
+	/*======================== bisect the whole beam ========================*/
+	vector<Cell*> children;
+	for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++) {
+		Cell* c=*it;
+		if (trace >= 2) cout << " current box " << c->box << endl;
+		try {
+			pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
+			children.push_back(new_cells.first);
+			children.push_back(new_cells.second);
+			nb_cells+=2;
+		} catch (NoBisectableVariableException& ) {
+			update_uplo_of_epsboxes((c->box)[goal_var].lb());
+		}
+		delete c;
+	}
+
+	/*=================== contract and bound the children ===================*/
+	size_t nb_threads=beam_ctcs.size()+1;
+	vector<pair<IntervalVector,double> > found(children.size(), make_pair(IntervalVector::empty(n), POS_INFINITY));
+
+	// The random generator is thread-local: the generator is reseeded for
+	// each slice of children, from the one of the main thread (reproducibility).
+	vector<int> seeds(nb_threads, -1);
+	for (size_t k=1; k<nb_threads; k++)
+		seeds[k] = RNG::rand() % max_beam_seed;
+
+	// the slice k is handled by any thread j of the pool, with the j-th copies
+	vector<future<void> > slices;
+	for (size_t k=1; k<nb_threads && k<children.size(); k++)
+		slices.push_back(beam_pool->submit([this,k,nb_threads,&children,&found,&seeds](int j) {
+			contract_and_bound_beam(children, k, nb_threads, *beam_ctcs[j-1], *beam_finders[j-1], found, seeds[k]);
+		}));
+
+	exception_ptr error;
+
+	try {
+		contract_and_bound_beam(children, 0, nb_threads, ctc, loup_finder, found, seeds[0]);
+	} catch(...) {
+		error = current_exception();
+	}
+
+	for (vector<future<void> >::iterator it=slices.begin(); it!=slices.end(); it++) {
+		try {
+			it->get();
+		} catch(...) {
+			if (!error) error = current_exception();
+		}
+	}
+
+	if (error) {
+		for (vector<Cell*>::iterator it=children.begin(); it!=children.end(); it++)
+			delete *it;
+		rethrow_exception(error);
+	}
+
+	/*=========== merge the results (in the order of the children) ===========*/
+	bool loup_ch=false;
+	for (size_t i=0; i<children.size(); i++) {
+		if (found[i].second < loup) {
+			loup_point = found[i].first;
+			loup = found[i].second;
+			loup_ch = true;
+
+			if (trace) {
+				cout << "                    ";
+				cout << "\033[32m loup= " << loup << "\033[0m" << endl;
+			}
+		}
+	}
+
+	for (vector<Cell*>::iterator it=children.begin(); it!=children.end(); it++) {
+		Cell& c=**it;
+
+		if (!c.box.is_empty()) {
+			IntervalVector tmp_box(n);
+			read_ext_box(c.box,tmp_box);
+			bound_cell(c, tmp_box, loup_ch);
+		}
+
+		if (c.box.is_empty()) {
+			delete &c;
+		} else {
+			ScopeTimer t(buffer_time);
+			buffer.push(&c);
+		}
+	}
+}
+
 Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
 	start(init_box, obj_init_bound);
 	return optimize();
@@ -307,7 +610,48 @@ Optimizer::Status Optimizer::optimize(const char* cov_file, double obj_init_boun
 	return optimize();
 }
 
-void Optimizer::start(const IntervalVector& init_box, double obj_init_bound) {
+Optimizer::Status Optimizer::reoptimize(const IntervalVector& init_box, double obj_init_bound) {
+
+	if (!cov) return optimize(init_box, obj_init_bound);
+
+	// The boxes discarded by the previous run are either infeasible,
+	// dominated by its loup or too small to be bisected (eps-boxes). The
+	// lower bound of the eps-boxes is carried over by the data (see
+	// start(const CovOptimData&,...)). So, if the loup point is still in
+	// the box, the pending boxes and this bound cover the minimizers of
+	// the new problem.
+	bool warm = loup<initial_loup && loup<=obj_init_bound
+			&& !search_box.is_empty() && init_box.is_subset(search_box)
+			&& loup_point.is_subset(init_box);
+
+	// start(...) replaces the data
+	CovOptimData* previous=cov;
+	cov=NULL;
+
+	if (warm) {
+		start(*previous, init_box, obj_init_bound);
+		cov->data->_optim_time = 0;
+		cov->data->_optim_nb_cells = 0;
+	} else if (loup<initial_loup) {
+		IntervalVector candidate=loup_point;
+		start(init_box, obj_init_bound, &candidate);
+	} else
+		start(init_box, obj_init_bound);
+
+	delete previous;
+
+	return optimize();
+}
+
+Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, const CovOptimData& previous, double obj_init_bound) {
+	if (previous.loup()<POS_INFINITY)
+		start(init_box, obj_init_bound, &previous.loup_point());
+	else
+		start(init_box, obj_init_bound);
+	return optimize();
+}
+
+void Optimizer::start(const IntervalVector& init_box, double obj_init_bound, const IntervalVector* candidate) {
 
 	loup=obj_init_bound;
 
@@ -319,6 +663,7 @@ void Optimizer::start(const IntervalVector& init_box, double obj_init_bound) {
 	uplo_of_epsboxes=POS_INFINITY;
 
 	nb_cells=0;
+	buffer_time=0;
 
 	buffer.flush();
 
@@ -344,17 +689,39 @@ void Optimizer::start(const IntervalVector& init_box, double obj_init_bound) {
 	initial_loup=obj_init_bound;
 
 	loup_point = init_box; //.set_empty();
+	search_box = init_box;
 	time=0;
 
+	if (spill) delete spill;
+	spill = max_cells>0 ? new CellSpill(n+1, goal_var) : NULL;
+
 	if (cov) delete cov;
 	cov = new CovOptimData(extended_COV? n+1 : n, extended_COV);
 	cov->data->_optim_time = 0;
 	cov->data->_optim_nb_cells = 0;
 
+	// a point known a priori (e.g., from a previous run)
+	if (candidate && !candidate->is_empty() && candidate->is_subset(init_box)) {
+		try {
+			pair<IntervalVector,double> p=loup_finder.find(*candidate,loup_point,loup);
+			loup_point = p.first;
+			loup = p.second;
+		} catch(LoupFinder::NotFound&) { }
+	}
+
+	if (pool) pool->start(loup_point, loup);
+
 	handle_cell(*root);
 }
 
 void Optimizer::start(const CovOptimData& data, double obj_init_bound) {
+	start(data, IntervalVector(n), obj_init_bound);
+
+	// the initial box of the run that produced the data is unknown
+	search_box.set_empty();
+}
+
+void Optimizer::start(const CovOptimData& data, const IntervalVector& init_box, double obj_init_bound) {
 
 	loup=obj_init_bound;
 
@@ -365,20 +732,29 @@ void Optimizer::start(const CovOptimData& data, double obj_init_bound) {
 	uplo=data.uplo();
 	loup=data.loup();
 	loup_point=data.loup_point();
-	uplo_of_epsboxes=POS_INFINITY;
+	// the eps-boxes of the previous run are not in the data
+	uplo_of_epsboxes=data.uplo_of_epsboxes();
 
 	nb_cells=0;
+	buffer_time=0;
 
 	buffer.flush();
 
 	for (size_t i=loup_point.is_empty()? 0 : 1; i<data.size(); i++) {
 
 		IntervalVector box(n+1);
+		IntervalVector x(n);
 
-		if (data.is_extended_space())
+		if (data.is_extended_space()) {
 			box = data[i];
-		else {
-			write_ext_box(data[i], box);
+			read_ext_box(box, x);
+			x &= init_box;
+			if (x.is_empty()) continue;
+			write_ext_box(x, box);
+		} else {
+			x = data[i] & init_box;
+			if (x.is_empty()) continue;
+			write_ext_box(x, box);
 			box[goal_var] = Interval(uplo,loup);
 			ctc.contract(box);
 			if (box.is_empty()) continue;
@@ -404,43 +780,81 @@ void Optimizer::start(const CovOptimData& data, double obj_init_bound) {
 	loup_changed=false;
 	initial_loup=obj_init_bound;
 
+	search_box = init_box;
 	time=0;
 
+	if (spill) delete spill;
+	spill = max_cells>0 ? new CellSpill(n+1, goal_var) : NULL;
+
 	if (cov) delete cov;
 	cov = new CovOptimData(extended_COV? n+1 : n, extended_COV);
 	cov->data->_optim_time = data.time();
 	cov->data->_optim_nb_cells = data.nb_cells();
+
+	if (pool) pool->start(loup_point, loup);
 }
 
 Optimizer::Status Optimizer::optimize() {
 	Timer timer;
 	timer.start();
 
+	// the loup may have been found by handling the root cell
+	first_loup_time = loup<initial_loup ? 0 : -1;
+
+	next_milestone=1;
+	interrupted=false;
+
 	update_uplo();
 
+	if (listener) notify(initial_loup, NEG_INFINITY, 0);
+
+	// for the checks of the timeout
+	unsigned int nb_iter=0;
+
 	try {
-	     while (!buffer.empty()) {
-		  
+	     while (!interrupted && (!buffer.empty() || (spill && !spill->empty()))) {
+
+			double old_loup=loup;
+			double old_uplo=uplo;
+			size_t old_nb_cells=nb_cells;
+
+			if (spill) reload_cells();
+
 			loup_changed=false;
 			// for double heap , choose randomly the buffer : top  has to be called before pop
-			Cell *c = buffer.top(); 
-			if (trace >= 2) cout << " current box " << c->box << endl;
+			Cell *c=NULL;
+			if (!beam) {
+				{
+					ScopeTimer t(buffer_time);
+					c = buffer.top();
+				}
+				if (trace >= 2) cout << " current box " << c->box << endl;
+			}
 
 			try {
 
-				pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
-				buffer.pop();
-				delete c; // deletes the cell.
+				if (beam)
+					handle_beam();
+				else {
+					pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
+					{
+						ScopeTimer t(buffer_time);
+						buffer.pop();
+					}
+					delete c; // deletes the cell.
 
-				nb_cells+=2;  // counting the cells handled ( in previous versions nb_cells was the number of cells put into the buffer after being handled)
-                
-				handle_cell(*new_cells.first);
-				handle_cell(*new_cells.second);
+					nb_cells+=2;  // counting the cells handled ( in previous versions nb_cells was the number of cells put into the buffer after being handled)
+
+					handle_cell(*new_cells.first);
+					handle_cell(*new_cells.second);
+				}
 
 				if (uplo_of_epsboxes == NEG_INFINITY) {
 					break;
 				}
 				if (loup_changed) {
+					if (first_loup_time<0) first_loup_time = timer.get_time();
+
 					// In case of a new upper bound (loup_changed == true), all the boxes
 					// with a lower bound greater than (loup - goal_prec) are removed and deleted.
 					// Note: if contraction was before bisection, we could have the problem
@@ -449,7 +863,12 @@ Optimizer::Status Optimizer::optimize() {
 
 					double ymax=compute_ymax();
 
-					buffer.contract(ymax);
+					{
+						ScopeTimer t(buffer_time);
+						buffer.contract(ymax);
+					}
+
+					if (spill) spill->contract(ymax);
 				
 					//cout << " now buffer is contracted and min=" << buffer.minimum() << endl;
 
@@ -459,31 +878,68 @@ Optimizer::Status Optimizer::optimize() {
 						break;
 					}
 				}
+				if (spill && buffer.size() > max_cells)
+					spill_cells();
+
 				update_uplo();
 
 				if (!anticipated_upper_bounding) // useless to check precision on objective if 'true'
 					if (get_obj_rel_prec()<rel_eps_f || get_obj_abs_prec()<abs_eps_f)
 						break;
 
-				if (timeout>0) timer.check(timeout); // TODO: not reentrant, JN: done
-				time = timer.get_time();
+				// amortized (the CPU time is read by a system call)
+				if (timeout>0 && nb_iter++ % time_check_period==0) {
+					time = timer.get_time();
+					if (time>=timeout) throw TimeOutException();
+				}
 
 			}
 			catch (NoBisectableVariableException& ) {
 				update_uplo_of_epsboxes((c->box)[goal_var].lb());
-				buffer.pop();
+				{
+					ScopeTimer t(buffer_time);
+					buffer.pop();
+				}
 				delete c; // deletes the cell.
 				update_uplo(); // the heap has changed -> recalculate the uplo (eg: if not in best-first search)
 
 			}
+
+			if (listener) {
+				time = timer.get_time();
+				notify(old_loup, old_uplo, old_nb_cells);
+			}
+
+			if (cancellation && cancellation->poll()) {
+				if (cancellation->expired()) throw TimeOutException();
+				interrupted = true;
+			}
+		}
+
+		if (pool) {
+			// the last boxes submitted may still contain a better loup
+			if (buffer.empty() && (!spill || spill->empty())) pool->wait();
+			pool->stop();
+			double old_loup=loup;
+			double old_uplo=uplo;
+			if (poll_loup()) {
+				if (first_loup_time<0) first_loup_time = timer.get_time();
+				update_uplo();
+				if (listener) {
+					time = timer.get_time();
+					notify(old_loup, old_uplo, nb_cells);
+				}
+			}
 		}
 
 	 	timer.stop();
 	 	time = timer.get_time();
 
+	 	if (interrupted && (!buffer.empty() || (spill && !spill->empty())))
+	 		status = INTERRUPTED;
 		// No solution found and optimization stopped with empty buffer
 		// before the required precision is reached => means infeasible problem
-	 	if (uplo_of_epsboxes == NEG_INFINITY)
+	 	else if (uplo_of_epsboxes == NEG_INFINITY)
 	 		status = UNBOUNDED_OBJ;
 	 	else if (uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && abs_eps_f==0 && rel_eps_f==0)))
 	 		status = INFEASIBLE;
@@ -495,8 +951,16 @@ Optimizer::Status Optimizer::optimize() {
 	 		status = SUCCESS;
 	}
 	catch (TimeOutException& ) {
+		if (pool) {
+			pool->stop();
+			poll_loup();
+		}
 		status = TIME_OUT;
 	}
+	catch (...) {
+		if (pool) pool->stop();
+		throw;
+	}
 
 	/* TODO: cannot retrieve variable names here. */
 	for (int i=0; i<(extended_COV ? n+1 : n); i++)
@@ -535,6 +999,18 @@ Optimizer::Status Optimizer::optimize() {
 		delete buffer.pop();
 	}
 
+	if (spill) {
+		while (!spill->empty()) {
+			IntervalVector box=spill->read();
+			if (extended_COV)
+				cov->add(box);
+			else {
+				read_ext_box(box,tmp);
+				cov->add(tmp);
+			}
+		}
+	}
+
 	return status;
 }
 
@@ -586,11 +1062,17 @@ void Optimizer::report() {
 		cout << red() << " possibly unbounded objective (f*=-oo)" << endl;
 		break;
 	case TIME_OUT: 
-		cout << red() << " time limit " << timeout << "s. reached " << endl;
+		if (cancellation && cancellation->expired())
+			cout << red() << " deadline reached " << endl;
+		else
+			cout << red() << " time limit " << timeout << "s. reached " << endl;
 		break;
 	case UNREACHED_PREC: 
 		cout << red() << " unreached precision" << endl;
 		break;
+	case INTERRUPTED:
+		cout << red() << " optimization interrupted" << endl;
+		break;
 	}
 	cout << white() <<  endl;
 
@@ -605,7 +1087,7 @@ void Optimizer::report() {
 		if (loup==initial_loup)
 			cout << " x* =\t--\n\t(no feasible point found)" << endl;
 		else {
-			if (loup_finder.rigorous())
+			if (pool? pool->rigorous() : loup_finder.rigorous())
 				cout << " x* in\t" << loup_point << endl;
 			else
 				cout << " x* =\t" << loup_point.lb() << endl;
@@ -630,10 +1112,29 @@ void Optimizer::report() {
 	if (cov->time()!=time)
 		cout << " [total=" << cov->time() << "]";
 	cout << endl;
+	if (first_loup_time>=0)
+		cout << " time to first loup:\t\t" << first_loup_time << "s" << endl;
 	cout << " number of cells:\t\t" << nb_cells;
 	if (cov->nb_cells()!=nb_cells)
 		cout << " [total=" << cov->nb_cells() << "]";
-	cout << endl << endl;
+	cout << endl;
+	if (pool) {
+		cout << " async. upper bounding:\t\t" << pool->nb_found() << " loup(s) found in "
+			 << pool->nb_processed() << " boxes (" << pool->nb_submitted() << " submitted, "
+			 << pool->nb_threads << " threads)" << endl;
+	}
+	if (beam) {
+		cout << " parallel beam search:\t\t" << beam_ctcs.size()+1 << " threads" << endl;
+	}
+	if (spill && spill->nb_written()>0) {
+		cout << " cells stored on disk:		" << spill->nb_written() << " (" << spill->nb_read()
+			 << " reloaded)" << endl;
+	}
+	cout << endl;
+	if (CtcProfile::enabled) {
+		cout << " time spent in the buffer:\t" << buffer_time << "s" << endl << endl;
+		CtcProfile::report(cout);
+	}
 }
 
 
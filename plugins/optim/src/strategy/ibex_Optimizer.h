@@ -13,9 +13,18 @@
 
 #include "ibex_OptimizerConfig.h"
 #include "ibex_CovOptimData.h"
+#include "ibex_OptimizerListener.h"
+#include "ibex_Cancellation.h"
+#include "ibex_ThreadPool.h"
+
+#include <vector>
 
 namespace ibex {
 
+class LoupFinderPool;
+class CellSpill;
+class CellBeamSearch;
+
 /**
  * \defgroup optim IbexOpt
  */
@@ -49,7 +58,7 @@ public:
 	 *
 	 * See comments for optimize(...) below.
 	 */
-	typedef enum {SUCCESS, INFEASIBLE, NO_FEASIBLE_FOUND, UNBOUNDED_OBJ, TIME_OUT, UNREACHED_PREC} Status;
+	typedef enum {SUCCESS, INFEASIBLE, NO_FEASIBLE_FOUND, UNBOUNDED_OBJ, TIME_OUT, UNREACHED_PREC, INTERRUPTED} Status;
 
 	/**
 	 *  \brief Create an optimizer.
@@ -119,6 +128,9 @@ public:
 	 *                             (which can be too stringent). This results in tiny boxes that can neither be contracted nor
 	 *                             used as new loup candidates. Finally, the eps_x parameter may be too large.
 	 *
+	 *         INTERRUPTED         if the search has been stopped by interrupt() or by the cancellation
+	 *                             token (see #cancellation).
+	 *
 	 */
 	Status optimize(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
 
@@ -140,6 +152,103 @@ public:
 	 */
 	Status optimize(const char* cov_file, double obj_init_bound=POS_INFINITY);
 
+	/**
+	 * \brief Optimize again, on a new box.
+	 *
+	 * Solve the same problem (same objective and constraints) on
+	 * \a init_box, typically after the bounds of the variables have been
+	 * tightened. The search is warm-started from the result of the previous
+	 * run (see get_data()) when this is safe, that is, when \a init_box is
+	 * included in the initial box of the previous run and contains the loup
+	 * point found by this run (and \a obj_init_bound is not less than the loup):
+	 * the loup is kept and the search starts from the pending boxes intersected
+	 * with \a init_box. Otherwise, the search starts from \a init_box, the previous
+	 * loup point being the first candidate of the upper bounding.
+	 *
+	 * The time and the number of cells of the result only count this run.
+	 *
+	 * See above for comments on return values.
+	 */
+	Status reoptimize(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
+
+	/**
+	 * \brief Optimize, with a candidate point from a previous run.
+	 *
+	 * Same as optimize(init_box, obj_init_bound) but the loup point of
+	 * \a previous is the first candidate of the upper bounding. The previous
+	 * run may have another objective or other bounds, but the same constraints
+	 * (e.g., it may come from another optimizer). Since its pending boxes do not
+	 * cover the minimizers of this problem, only its loup point is used.
+	 *
+	 * See above for comments on return values.
+	 */
+	Status optimize(const IntervalVector& init_box, const CovOptimData& previous, double obj_init_bound=POS_INFINITY);
+
+	/**
+	 * \brief Enable asynchronous upper bounding.
+	 *
+	 * In this mode, #loup_finder is not called anymore. Each box
+	 * handled by the optimizer is submitted instead to a pool of threads
+	 * (see LoupFinderPool) and the loups they find are retrieved
+	 * without waiting. The search is therefore never blocked by the
+	 * upper bounding. Once the buffer is empty, the optimizer waits
+	 * for the pending boxes before computing the status.
+	 *
+	 * \param finders - one loup finder per thread. As they run concurrently,
+	 *                  they must not share any data with the other operators
+	 *                  (e.g., they can be built on copies of the system).
+	 *                  If #loup_finder is rigorous, they must be rigorous as
+	 *                  well (e.g., instances of LoupFinderCertify).
+	 *                  An empty array switches back to synchronous mode.
+	 *
+	 * \note The result depends on thread scheduling and is not reproducible.
+	 *       CPU time (and timeout) also includes the time of the threads.
+	 */
+	void set_async_upper_bounding(const Array<LoupFinder>& finders);
+
+	/**
+	 * \brief Enable the parallel beam search.
+	 *
+	 * The buffer must be a CellBeamSearch. In this mode, all the cells
+	 * of the beam (see CellBeamSearch::pop_beam()) are bisected at once
+	 * and the children are contracted and bounded concurrently: the
+	 * children are split into as many slices as threads (child i being
+	 * in slice i modulo the number of threads) and the slices are handled
+	 * by threads created once, by this call. Then, in one sequential step,
+	 * the loups found are merged (in the order of the children) and the
+	 * children are pushed into the future beam.
+	 *
+	 * Since the loup is only updated at the end of each step, the children
+	 * are contracted with the loup known at the beginning of the step.
+	 * The result does not depend on thread scheduling: it is deterministic
+	 * for a given number of threads, beam size and random seed (the random
+	 * generators are seeded for each slice from the one of the caller).
+	 *
+	 * \param ctcs    - copies of #ctc, one for each additional thread
+	 * \param finders - copies of #loup_finder, one for each additional thread.
+	 *                  As they run concurrently with #ctc and #loup_finder,
+	 *                  they must not share any data with them (e.g., they can be
+	 *                  built on copies of the system).
+	 *                  Empty arrays with a beam search buffer give the same
+	 *                  algorithm with a single thread.
+	 *
+	 * \note Not compatible with the asynchronous upper bounding.
+	 */
+	void set_parallel_beam(const Array<Ctc>& ctcs, const Array<LoupFinder>& finders);
+
+	/**
+	 * \brief Stop the optimization.
+	 *
+	 * The current call to optimize(...) returns INTERRUPTED once the
+	 * current iteration is over. The loup, the uplo and the remaining
+	 * cells are available as usual (see #get_data()), so that the
+	 * optimization can be continued later.
+	 *
+	 * This function is meant to be called by a listener callback
+	 * (see #listener).
+	 */
+	void interrupt();
+
 	/* =========================== Output ============================= */
 
 	/**
@@ -150,6 +259,8 @@ public:
 	 *     <li> the best feasible point found
 	 *     <li> total running time
 	 *     <li> total number of cells (~boxes) created during the exploration
+	 *     <li> the statistics of the contractors and the time spent in the buffer,
+	 *          if profiling is enabled (see CtcProfile)
 	 * </ul>
 	 */
 	void report();
@@ -196,6 +307,15 @@ public:
 	 */
 	double get_time() const;
 
+	/**
+	 * \brief Get the time to first loup.
+	 *
+	 * \return the CPU time spent by the last call to optimize(...)
+	 *         before the first loup was found (measured at the end of the
+	 *         iteration where it was found), or -1 if no loup was found.
+	 */
+	double get_first_loup_time() const;
+
 	/**
 	 * \brief Get the number of cells.
 	 *
@@ -203,6 +323,16 @@ public:
 	 */
 	size_t get_nb_cells() const;
 
+	/**
+	 * \brief Get the time spent in the cell buffer.
+	 *
+	 * \return the wall-clock time spent by the last call to optimize(...)
+	 *         in pushing, selecting and popping cells and in contracting
+	 *         the buffer w.r.t. the loup. Only measured if profiling is
+	 *         enabled (see CtcProfile), 0 otherwise.
+	 */
+	double get_buffer_time() const;
+
 	/**
 	 * \brief Get the relative precision on the objective obtained after last execution.
 	 */
@@ -285,9 +415,15 @@ public:
 	 * Maximum CPU time used by the strategy.
 	 * This parameter allows to bound time consumption.
 	 * The value can be fixed by the user.
+	 *
+	 * Reading the CPU time is a system call: the time is checked every
+	 * #time_check_period iterations only.
 	 */
 	double timeout;
 
+	/** Number of iterations between two checks of the #timeout: 64. */
+	static constexpr unsigned int time_check_period = 64;
+
 	/**
 	 * \brief Whether the output has to be in the extended space.
 	 *
@@ -312,17 +448,68 @@ public:
 	 */
 	bool anticipated_upper_bounding; // TODO: should be set in OptimizerConfig
 
+	/**
+	 * \brief Maximal number of cells in memory.
+	 *
+	 * When the buffer exceeds this number, the least promising
+	 * cells (with the greatest lower bound of the objective) are
+	 * moved to a temporary file until half of the cells remain.
+	 * They are reloaded (with new properties) when the buffer is empty
+	 * or when the best cell is in the file. The uplo takes into
+	 * account the cells in the file.
+	 *
+	 * The buffer must support CellBufferOptim::shrink().
+	 *
+	 * Default value: 0 (no limit).
+	 */
+	unsigned int max_cells;
+
+	/**
+	 * \brief Listener.
+	 *
+	 * If not NULL, the listener is notified of loup and uplo
+	 * improvements, of the number of cells handled and of the growth of
+	 * the buffer, at the end of each iteration (see OptimizerListener).
+	 * The time returned by #get_time() is updated before the call.
+	 *
+	 * The callbacks can stop the search (see #interrupt()) or change
+	 * the #timeout.
+	 *
+	 * Default value: NULL.
+	 */
+	OptimizerListener* listener;
+
+	/**
+	 * \brief Cancellation token.
+	 *
+	 * If not NULL, the token is polled at each iteration and passed
+	 * to the contractor (see ContractContext::cancellation). Once the
+	 * token is cancelled, the optimization stops with status INTERRUPTED,
+	 * or TIME_OUT if the deadline of the token is reached. Contrary to
+	 * #timeout (CPU time of the process), the deadline is a wall-clock time.
+	 *
+	 * Default value: NULL.
+	 */
+	Cancellation* cancellation;
+
 protected:
 	/*
 	 * \brief Initialize the optimizer from a single box.
+	 *
+	 * \param candidate - if not NULL, first candidate point of the upper bounding.
 	 */
-	void start(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
+	void start(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY, const IntervalVector* candidate=NULL);
 
 	/*
 	 * \brief Initialize the optimizer from a COV input file.
 	 */
 	void start(const CovOptimData& cov, double obj_init_bound=POS_INFINITY);
 
+	/*
+	 * \brief Initialize the optimizer from a COV, restricted to a box.
+	 */
+	void start(const CovOptimData& cov, const IntervalVector& init_box, double obj_init_bound);
+
 	/**
 	 * \brief Run the optimizer (once started).
 	 */
@@ -352,6 +539,40 @@ protected:
 	 */
 	void contract_and_bound(Cell& c);
 
+	/**
+	 * \brief First part of contract_and_bound: contract the cell box
+	 *        w.r.t. the loup and with the contractor \a ctc.
+	 *
+	 * Does not modify the optimizer (can be run concurrently).
+	 *
+	 * \return false if the box is empty.
+	 */
+	bool contract_cell(Cell& c, Ctc& ctc);
+
+	/**
+	 * \brief Last part of contract_and_bound, once upper bounding is done.
+	 *
+	 * \param box     - the box of the cell in the original space.
+	 * \param loup_ch - whether the loup has changed.
+	 */
+	void bound_cell(Cell& c, IntervalVector& box, bool loup_ch);
+
+	/**
+	 * \brief Handle the whole beam (see set_parallel_beam).
+	 */
+	void handle_beam();
+
+	/**
+	 * \brief Contract and search for loup in the cells of index
+	 *        first, first+step, first+2*step, etc. (run by one thread).
+	 *
+	 * \param found - the loup point and value found for each cell (if any).
+	 * \param seed  - seed of the random generator of the thread (-1: unchanged).
+	 */
+	void contract_and_bound_beam(std::vector<Cell*>& cells, size_t first, size_t step,
+			Ctc& ctc, LoupFinder& finder,
+			std::vector<std::pair<IntervalVector,double> >& found, int seed);
+
 	/**
 	 * \brief Update the entailed constraint for the current box
 	 *
@@ -374,6 +595,13 @@ protected:
 	 */
 	bool update_loup(const IntervalVector& box, BoxProperties& prop);
 
+	/**
+	 * \brief Retrieve the loup found by the asynchronous upper bounding.
+	 *
+	 * \return true if the loup has been updated.
+	 */
+	bool poll_loup();
+
 	/**
 	 * \brief Computes and returns  the value ymax (the loup decreased with the precision)
 	 * the heap and the current box are actually contracted with y <= ymax
@@ -381,6 +609,28 @@ protected:
 	 */
 	double compute_ymax ();
 
+	/**
+	 * \brief Move the least promising cells of the buffer to
+	 *        the disk (see #max_cells).
+	 */
+	void spill_cells();
+
+	/**
+	 * \brief Move the best cells from the disk to the buffer,
+	 *        if the buffer is empty or if the best cell is on the disk
+	 *        (see #max_cells).
+	 */
+	void reload_cells();
+
+	/**
+	 * \brief Call the listener.
+	 *
+	 * \param old_loup     - the loup before the current iteration
+	 * \param old_uplo     - the uplo before the current iteration
+	 * \param old_nb_cells - the number of cells before the current iteration
+	 */
+	void notify(double old_loup, double old_uplo, size_t old_nb_cells);
+
 	/**
 	 * \brief Check time is not out.
 	 */
@@ -432,6 +682,12 @@ private:
 	 */
 	IntervalVector loup_point;
 
+	/**
+	 * The initial box of the current optimization
+	 * (empty if unknown, e.g., when continuing from a COV).
+	 */
+	IntervalVector search_box;
+
 	/**
 	 * \brief The bound on the objective given by the user, +oo otherwise.
 	 *
@@ -446,13 +702,43 @@ private:
 	/* CPU running time of the current optimization. */
 	double time;
 
+	/* CPU time to first loup (-1 if none). */
+	double first_loup_time;
+
 	/** Number of cells pushed into the heap (which passed through the contractors) */
 	size_t nb_cells;
 
+	/** Next buffer size notified to the listener. */
+	unsigned int next_milestone;
+
+	/** True if interrupt() has been called. */
+	bool interrupted;
+
+	/** Wall-clock time spent in the buffer (if profiling is enabled). */
+	double buffer_time;
+
+	/** Asynchronous upper bounding (NULL if disabled). */
+	LoupFinderPool* pool;
+
+	/** Cells on the disk (NULL if max_cells==0). */
+	CellSpill* spill;
+
+	/** Beam search buffer (NULL if the parallel beam search is disabled). */
+	CellBeamSearch* beam;
+
+	/** Contractors and loup finders of the additional threads of the parallel beam search. */
+	std::vector<Ctc*> beam_ctcs;
+	std::vector<LoupFinder*> beam_finders;
+
+	/** Threads of the parallel beam search (NULL if disabled). */
+	ThreadPool* beam_pool;
+
 	/** Result. */
 	CovOptimData* cov;
 };
 
+inline void Optimizer::interrupt() { interrupted = true; }
+
 inline Optimizer::Status Optimizer::get_status() const { return status; }
 
 inline double Optimizer::get_uplo() const { return uplo; }
@@ -463,8 +749,12 @@ inline const IntervalVector& Optimizer::get_loup_point() const { return loup_poi
 
 inline double Optimizer::get_time() const { return time; }
 
+inline double Optimizer::get_first_loup_time() const { return first_loup_time; }
+
 inline size_t Optimizer::get_nb_cells() const { return nb_cells; }
 
+inline double Optimizer::get_buffer_time() const { return buffer_time; }
+
 inline double Optimizer::get_obj_rel_prec() const {
 	if (loup==POS_INFINITY)
 		return POS_INFINITY;
@@ -14,6 +14,7 @@
 #include "ibex_Ctc.h"
 #include "ibex_Bsc.h"
 #include "ibex_LoupFinder.h"
+#include "ibex_Array.h"
 #include "ibex_CellBufferOptim.h"
 
 namespace ibex {
@@ -114,6 +115,16 @@ public:
 	 */
 	void set_anticipated_upper_bounding(bool antipated_upper_bounding);
 
+	/**
+	 * \brief Set the maximal number of cells in memory.
+	 *
+	 * Beyond this number, cells are temporarily stored on disk.
+	 * See Optimizer::max_cells.
+	 *
+	 * Default value: 0 (no limit).
+	 */
+	void set_max_cells(unsigned int max_cells);
+
 	/** see #set_rel_eps_f(). */
 	double get_rel_eps_f() const;
 
@@ -135,6 +146,9 @@ public:
 	/** see #set_anticipated_upper_bounding(). */
 	bool with_anticipated_upper_bounding() const;
 
+	/** see #set_max_cells(). */
+	unsigned int get_max_cells() const;
+
 	/** Default goal relative precision: 1e-3. */
 	static constexpr double default_rel_eps_f = 1e-03;
 
@@ -156,6 +170,9 @@ public:
 	/** Default anticipated upper bounding : true (enabled). */
 	static constexpr bool default_anticipated_UB = true;
 
+	/** Default maximal number of cells in memory: 0 (no limit). */
+	static constexpr unsigned int default_max_cells = 0;
+
 protected:
 
 	friend class Optimizer;
@@ -175,6 +192,23 @@ protected:
 	virtual CellBufferOptim& get_cell_buffer()=0;
 
 	virtual int goal_var()=0;
+
+	/*
+	 * Loup finders of the asynchronous upper bounding
+	 * (see Optimizer::set_async_upper_bounding).
+	 * By default: none (synchronous upper bounding).
+	 */
+	virtual Array<LoupFinder> get_async_loup_finders();
+
+	/*
+	 * Contractors and loup finders of the additional threads
+	 * of the parallel beam search (see Optimizer::set_parallel_beam).
+	 * Both arrays must have the same size.
+	 * By default: none (parallel beam search disabled).
+	 */
+	virtual Array<Ctc> get_beam_ctcs();
+
+	virtual Array<LoupFinder> get_beam_loup_finders();
 	// ============================================================================
 
 	double rel_eps_f;
@@ -184,6 +218,7 @@ protected:
 	double timeout;
 	bool extended_COV;
 	bool anticipated_UB;
+	unsigned int max_cells;
 };
 
 inline OptimizerConfig::OptimizerConfig() {
@@ -194,6 +229,7 @@ inline OptimizerConfig::OptimizerConfig() {
 	timeout        = OptimizerConfig::default_timeout;
 	extended_COV   = OptimizerConfig::default_extended_cov;
 	anticipated_UB = OptimizerConfig::default_anticipated_UB;
+	max_cells      = OptimizerConfig::default_max_cells;
 }
 
 inline void OptimizerConfig::set_rel_eps_f(double _rel_eps_f)     { rel_eps_f = _rel_eps_f; }
@@ -210,6 +246,8 @@ inline void OptimizerConfig::set_extended_cov(bool _extended_COV) { extended_COV
 
 inline void OptimizerConfig::set_anticipated_upper_bounding(bool _antipated_UB) { anticipated_UB = _antipated_UB; }
 
+inline void OptimizerConfig::set_max_cells(unsigned int _max_cells) { max_cells = _max_cells; }
+
 inline double OptimizerConfig::get_rel_eps_f() const                 { return rel_eps_f; }
 
 inline double OptimizerConfig::get_abs_eps_f() const                 { return abs_eps_f; }
@@ -224,6 +262,14 @@ inline bool OptimizerConfig::with_extended_cov()  const              { return ex
 
 inline bool OptimizerConfig::with_anticipated_upper_bounding() const { return anticipated_UB; }
 
+inline unsigned int OptimizerConfig::get_max_cells() const         { return max_cells; }
+
+inline Array<LoupFinder> OptimizerConfig::get_async_loup_finders()   { return Array<LoupFinder>(); }
+
+inline Array<Ctc> OptimizerConfig::get_beam_ctcs()                   { return Array<Ctc>(); }
+
+inline Array<LoupFinder> OptimizerConfig::get_beam_loup_finders()    { return Array<LoupFinder>(); }
+
 } /* namespace ibex */
 
 #endif /* __IBEX_OPTIMIZER_CONFIG_H__ */
@@ -0,0 +1,89 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_OptimizerListener.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_OPTIMIZER_LISTENER_H__
+#define __IBEX_OPTIMIZER_LISTENER_H__
+
+namespace ibex {
+
+class Optimizer;
+
+/**
+ * \ingroup optim
+ *
+ * \brief Observer of an optimizer.
+ *
+ * The callbacks are called by the optimizer during the search (see
+ * Optimizer::listener). They do nothing by default. A callback can
+ * query the optimizer (e.g., Optimizer::get_loup(), Optimizer::get_uplo(),
+ * Optimizer::get_loup_point(), Optimizer::get_nb_cells() or
+ * Optimizer::get_time()), change its timeout or stop the search with
+ * Optimizer::interrupt().
+ */
+class OptimizerListener {
+public:
+
+	/**
+	 * \brief Create the listener.
+	 *
+	 * \param period - number of cells between two calls to #cells_handled().
+	 */
+	OptimizerListener(unsigned int period=default_period);
+
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~OptimizerListener();
+
+	/**
+	 * \brief Called when the loup is improved.
+	 */
+	virtual void loup_updated(Optimizer& optimizer);
+
+	/**
+	 * \brief Called when the uplo is improved.
+	 */
+	virtual void uplo_updated(Optimizer& optimizer);
+
+	/**
+	 * \brief Called every #period cells.
+	 */
+	virtual void cells_handled(Optimizer& optimizer);
+
+	/**
+	 * \brief Called each time the size of the buffer reaches
+	 *        a new power of two.
+	 */
+	virtual void buffer_milestone(Optimizer& optimizer, unsigned int size);
+
+	/**
+	 * \brief Number of cells between two calls to #cells_handled().
+	 */
+	const unsigned int period;
+
+	/** Default period: 1000 cells. */
+	static constexpr unsigned int default_period = 1000;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline OptimizerListener::OptimizerListener(unsigned int period) : period(period>0? period : 1) { }
+
+inline OptimizerListener::~OptimizerListener() { }
+
+inline void OptimizerListener::loup_updated(Optimizer&) { }
+
+inline void OptimizerListener::uplo_updated(Optimizer&) { }
+
+inline void OptimizerListener::cells_handled(Optimizer&) { }
+
+inline void OptimizerListener::buffer_milestone(Optimizer&, unsigned int) { }
+
+} // end namespace ibex
+
+#endif // __IBEX_OPTIMIZER_LISTENER_H__
@@ -14,7 +14,7 @@ using namespace std;
 
 namespace ibex {
 
-UnconstrainedLocalSearch::UnconstrainedLocalSearch(const Function& f, const IntervalVector& box) :
+UnconstrainedLocalSearch::UnconstrainedLocalSearch(const Fnc& f, const IntervalVector& box) :
 						f(f), box(box), n(f.nb_var()),
 						eps(0), sigma(0),  /* TMP init */
 						niter(0),	data(n) {
@@ -49,10 +49,11 @@ public:
 	/**
 	 * \brief Build the local optimizer.
 	 *
-	 * \param f   - the function to minimize
+	 * \param f   - the function to minimize. Only #Fnc::eval and
+	 *              #Fnc::gradient are called (at degenerated boxes).
 	 * \param box - the bounding box (boundary constraints)
 	 */
-	UnconstrainedLocalSearch(const Function& f, const IntervalVector& box);
+	UnconstrainedLocalSearch(const Fnc& f, const IntervalVector& box);
 
 	/**
 	 * \brief Run the optimization.
@@ -93,7 +94,7 @@ private:
 	 */
 	class InvalidPointException { };
 
-	const Function& f;  // function
+	const Fnc& f;       // function
 	IntervalVector box; // bounding box;
 	int n;              // number of variables
 
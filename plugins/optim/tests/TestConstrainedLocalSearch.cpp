@@ -0,0 +1,84 @@
+//============================================================================
+//                                  I B E X
+// File        : TestConstrainedLocalSearch.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "TestConstrainedLocalSearch.h"
+#include "ibex_ConstrainedLocalSearch.h"
+#include "ibex_LoupFinderLocalSearch.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestConstrainedLocalSearch::unconstrained() {
+	Variable x;
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_goal(sqr(x)+3*x+2);
+	System sys(fac);
+
+	ConstrainedLocalSearch o(sys,IntervalVector(1,Interval(-10,10)));
+	Vector x0(1), x_min(1);
+	CPPUNIT_ASSERT(o.minimize(x0,x_min)==UnconstrainedLocalSearch::SUCCESS);
+	CPPUNIT_ASSERT(fabs(x_min[0]+1.5)<1e-6);
+}
+
+// min x^2+y^2 s.t. x+y>=1
+void TestConstrainedLocalSearch::inequality() {
+	Variable x,y;
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x+y>=1);
+	fac.add_goal(sqr(x)+sqr(y));
+	System sys(fac);
+
+	ConstrainedLocalSearch o(sys,IntervalVector(2,Interval(-10,10)));
+	Vector x0(2), x_min(2);
+	o.minimize(x0,x_min);
+	CPPUNIT_ASSERT(fabs(x_min[0]-0.5)<1e-6);
+	CPPUNIT_ASSERT(fabs(x_min[1]-0.5)<1e-6);
+	// the inequality is strictly satisfied (margin)
+	CPPUNIT_ASSERT(x_min[0]+x_min[1]>1);
+}
+
+// min x+y s.t. x^2+y^2=2 (solution: (-1,-1))
+void TestConstrainedLocalSearch::equality() {
+	Variable x,y;
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)+sqr(y)=2);
+	fac.add_goal(x+y);
+	System sys(fac);
+
+	ConstrainedLocalSearch o(sys,IntervalVector(2,Interval(-10,10)));
+	Vector x0(2,-0.5), x_min(2);
+	o.minimize(x0,x_min);
+	CPPUNIT_ASSERT(fabs(x_min[0]+1)<1e-6);
+	CPPUNIT_ASSERT(fabs(x_min[1]+1)<1e-6);
+}
+
+void TestConstrainedLocalSearch::loup_finder() {
+	Variable x,y;
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x+y>=1);
+	fac.add_goal(sqr(x)+sqr(y));
+	System sys(fac);
+
+	LoupFinderLocalSearch finder(sys);
+	IntervalVector box(2,Interval(-10,10));
+	pair<IntervalVector,double> p=finder.find(box,box.mid(),POS_INFINITY);
+
+	CPPUNIT_ASSERT(sys.is_inner(p.first));
+	CPPUNIT_ASSERT(fabs(p.second-0.5)<1e-6);
+}
+
+} // end namespace ibex
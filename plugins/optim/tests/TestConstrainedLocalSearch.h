@@ -0,0 +1,38 @@
+//============================================================================
+//                                  I B E X
+// File        : TestConstrainedLocalSearch.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __TEST_CONSTRAINED_LOCAL_SEARCH_H__
+#define __TEST_CONSTRAINED_LOCAL_SEARCH_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestConstrainedLocalSearch : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestConstrainedLocalSearch);
+		CPPUNIT_TEST(unconstrained);
+		CPPUNIT_TEST(inequality);
+		CPPUNIT_TEST(equality);
+		CPPUNIT_TEST(loup_finder);
+	CPPUNIT_TEST_SUITE_END();
+
+	void unconstrained();
+	void inequality();
+	void equality();
+	void loup_finder();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestConstrainedLocalSearch);
+
+} // end namespace ibex
+
+#endif // __TEST_CONSTRAINED_LOCAL_SEARCH_H__
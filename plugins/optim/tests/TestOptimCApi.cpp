@@ -0,0 +1,57 @@
+/* ============================================================================
+ * I B E X - C interface of the optimizer Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestOptimCApi.h"
+#include "ibex_OptimCApi.h"
+#include "ibex_Optimizer.h"
+
+#include <cstring>
+
+using namespace std;
+
+namespace ibex {
+
+void TestOptimCApi::optimize01() {
+	ibex_system* sys=ibex_system_load(SRCDIR_TESTS "/minibex/capi_optim.bch");
+	CPPUNIT_ASSERT(sys);
+
+	ibex_optimizer* o=ibex_optimizer_new(sys,1e-6,1e-7,-1);
+	CPPUNIT_ASSERT(o);
+
+	// minimum 2 at (2,-1) (projection of (1,-2) onto x+y=1)
+	CPPUNIT_ASSERT(ibex_optimizer_optimize(o,NULL,NULL)==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(ibex_optimizer_uplo(o)<=2+1e-6);
+	CPPUNIT_ASSERT(ibex_optimizer_loup(o)>=2-1e-6);
+	CPPUNIT_ASSERT(ibex_optimizer_loup(o)<=2*(1+1e-6));
+
+	double lb[2],ub[2];
+	ibex_optimizer_loup_point(o,lb,ub);
+	CPPUNIT_ASSERT(almost_eq(Interval(lb[0],ub[0]),Interval(2),1e-2));
+	CPPUNIT_ASSERT(almost_eq(Interval(lb[1],ub[1]),Interval(-1),1e-2));
+
+	// in a sub-box (the constraint is inactive): minimum 49 at (1,5)
+	double blb[]={ -10, 5 };
+	double bub[]={ 10, 10 };
+	CPPUNIT_ASSERT(ibex_optimizer_optimize(o,blb,bub)==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(ibex_optimizer_loup(o)>=49-1e-6);
+	CPPUNIT_ASSERT(ibex_optimizer_loup(o)<=49*(1+1e-6));
+
+	ibex_optimizer_free(o);
+	ibex_system_free(sys);
+}
+
+void TestOptimCApi::no_goal() {
+	ibex_system* sys=ibex_system_load(SRCDIR_TESTS "/minibex/capi.bch");
+	CPPUNIT_ASSERT(ibex_optimizer_new(sys,1e-6,1e-7,-1)==NULL);
+	CPPUNIT_ASSERT(strlen(ibex_last_error())>0);
+	ibex_system_free(sys);
+}
+
+} // end namespace
@@ -0,0 +1,40 @@
+/* ============================================================================
+ * I B E X - C interface of the optimizer Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_OPTIM_C_API_H__
+#define __TEST_OPTIM_C_API_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestOptimCApi : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestOptimCApi);
+#ifndef _IBEX_WITH_NOLP_
+	CPPUNIT_TEST(optimize01);
+#endif
+	CPPUNIT_TEST(no_goal);
+	CPPUNIT_TEST_SUITE_END();
+
+	void optimize01();
+
+	void no_goal();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestOptimCApi);
+
+} // end namespace
+
+#endif // __TEST_OPTIM_C_API_H__
@@ -14,6 +14,18 @@
 #include "ibex_Optimizer.h"
 #include "ibex_DefaultOptimizer.h"
 #include "ibex_SystemFactory.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_CtcFixPoint.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CellHeap.h"
+#include "ibex_CellDoubleHeap.h"
+#include "ibex_CellBeamSearch.h"
+#include "ibex_CellSpill.h"
+#include "ibex_LoupFinderInHC4.h"
+#include "ibex_LoupFinderPool.h"
+#include "ibex_Random.h"
+
+#include <thread>
 
 using namespace std;
 
@@ -118,4 +130,384 @@ void TestOptimizer::unconstrained() {
 	CPPUNIT_ASSERT(o.get_loup()>=0 && o.get_uplo()<=0);
 }
 
+void TestOptimizer::async_upper_bounding() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x+y>=1);
+	fac.add_goal(sqr(x)+sqr(y));
+	System sys(fac);
+
+	ExtendedSystem ext_sys(sys);
+	NormalizedSystem norm_sys(sys);
+	CtcHC4 hc4(ext_sys,0.01,true);
+	RoundRobin rr(0);
+	CellHeap buffer(ext_sys);
+	LoupFinderInHC4 finder(norm_sys);
+
+	// one copy of the system for each thread
+	System sys1(sys,System::COPY), sys2(sys,System::COPY);
+	NormalizedSystem norm_sys1(sys1), norm_sys2(sys2);
+	LoupFinderInHC4 finder1(norm_sys1), finder2(norm_sys2);
+
+	Optimizer o(2, hc4, rr, finder, buffer, ext_sys.goal_var());
+	o.set_async_upper_bounding(Array<LoupFinder>(finder1, finder2));
+
+	Optimizer::Status status=o.optimize(IntervalVector(2,Interval(-10,10)));
+
+	CPPUNIT_ASSERT(status==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()>=0.5 && o.get_uplo()<=0.5);
+	CPPUNIT_ASSERT(almost_eq(o.get_loup_point().mid(),Vector(2,0.5),0.01));
+
+	// the pool can be restarted
+	status=o.optimize(IntervalVector(2,Interval(-10,10)));
+	CPPUNIT_ASSERT(status==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()>=0.5 && o.get_uplo()<=0.5);
+}
+
+namespace {
+
+// records the first random number drawn by the thread
+class RandomLoupFinder : public LoupFinder {
+public:
+	RandomLoupFinder() : nb_calls(0), first(0) { }
+
+	pair<IntervalVector, double> find(const IntervalVector&, const IntervalVector&, double) {
+		if (nb_calls++==0) first=RNG::rand();
+		throw NotFound();
+	}
+
+	int nb_calls;
+	uint32_t first;
+};
+
+void draw(uint32_t* r) {
+	*r=RNG::rand();
+}
+
+}
+
+void TestOptimizer::async_seed() {
+	// first number drawn by a thread whose generator is not seeded
+	uint32_t unseeded;
+	thread t(draw, &unseeded);
+	t.join();
+
+	RNG::srand(1);
+
+	RandomLoupFinder finder1, finder2;
+	LoupFinderPool pool(Array<LoupFinder>(finder1, finder2));
+	pool.start(IntervalVector::empty(2), POS_INFINITY);
+	for (int i=0; i<10; i++)
+		pool.submit(IntervalVector(2,Interval(0,1)), 0);
+	pool.wait();
+	pool.stop();
+
+	CPPUNIT_ASSERT(finder1.nb_calls+finder2.nb_calls==10);
+	if (finder1.nb_calls>0) CPPUNIT_ASSERT(finder1.first!=unseeded);
+	if (finder2.nb_calls>0) CPPUNIT_ASSERT(finder2.first!=unseeded);
+}
+
+void TestOptimizer::max_cells() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x+y<=10);
+	// two global minimizers: (+/-sqrt(1.5),0); f*=-2.25
+	fac.add_goal(pow(x,4)-3*sqr(x)+sqr(y));
+	System sys(fac);
+
+	ExtendedSystem ext_sys(sys);
+	NormalizedSystem norm_sys(sys);
+	CtcHC4 hc4(ext_sys,0.01,true);
+	RoundRobin rr(0);
+	LoupFinderInHC4 finder(norm_sys);
+
+	CellHeap heap(ext_sys);
+	CellDoubleHeap double_heap(ext_sys);
+	CellBufferOptim* buffers[2] = { &heap, &double_heap };
+
+	for (int i=0; i<2; i++) {
+		Optimizer o(2, hc4, rr, finder, *buffers[i], ext_sys.goal_var(), 0, 1e-9, 1e-9);
+		o.max_cells=4;
+
+		Optimizer::Status status=o.optimize(IntervalVector(2,Interval(-10,10)));
+
+		CPPUNIT_ASSERT(status==Optimizer::SUCCESS);
+		CPPUNIT_ASSERT(o.get_loup()>=-2.25 && o.get_uplo()<=-2.25);
+		CPPUNIT_ASSERT(o.get_loup()-o.get_uplo()<=1e-6);
+	}
+}
+
+void TestOptimizer::cell_spill() {
+	CellSpill spill(2,1);
+	const int n=3000;
+
+	// boxes written by batches of 100 (in decreasing order of lower bound)
+	vector<Cell*> cells;
+	for (int i=n-1; i>=0; i--) {
+		IntervalVector box(2);
+		box[0]=Interval(-i,i);
+		box[1]=Interval(i,n);
+		cells.push_back(new Cell(box));
+		if (cells.size()==100) spill.write(cells);
+	}
+	CPPUNIT_ASSERT(spill.size()==n);
+	CPPUNIT_ASSERT(spill.file_size()==n);
+
+	for (int i=0; i<2500; i++) {
+		IntervalVector box=spill.read();
+		CPPUNIT_ASSERT(box[0]==Interval(-i,i));
+		CPPUNIT_ASSERT(box[1]==Interval(i,n));
+	}
+
+	// the space of the boxes read is reclaimed
+	CPPUNIT_ASSERT(spill.size()==500);
+	CPPUNIT_ASSERT(spill.file_size()<2*500+1024);
+
+	spill.contract(2800);
+	int i=2500;
+	while (!spill.empty()) {
+		IntervalVector box=spill.read();
+		CPPUNIT_ASSERT(box[0]==Interval(-i,i));
+		i++;
+	}
+	CPPUNIT_ASSERT(i==2801);
+	CPPUNIT_ASSERT(spill.file_size()==0);
+}
+
+namespace {
+
+class CountListener : public OptimizerListener {
+public:
+	CountListener(bool stop) : OptimizerListener(10), stop(stop),
+		nb_loup(0), nb_uplo(0), nb_cells(0), nb_milestones(0), last_milestone(0) { }
+
+	void loup_updated(Optimizer& o) {
+		nb_loup++;
+		if (stop) o.interrupt();
+	}
+
+	void uplo_updated(Optimizer&) { nb_uplo++; }
+
+	void cells_handled(Optimizer&) { nb_cells++; }
+
+	void buffer_milestone(Optimizer&, unsigned int size) {
+		nb_milestones++;
+		CPPUNIT_ASSERT(size>last_milestone);
+		last_milestone=size;
+	}
+
+	bool stop;
+	int nb_loup, nb_uplo, nb_cells, nb_milestones;
+	unsigned int last_milestone;
+};
+
+}
+
+void TestOptimizer::listener() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x+y<=10);
+	fac.add_goal(pow(x,4)-3*sqr(x)+sqr(y));
+	System sys(fac);
+
+	ExtendedSystem ext_sys(sys);
+	NormalizedSystem norm_sys(sys);
+	CtcHC4 hc4(ext_sys,0.01,true);
+	RoundRobin rr(0);
+	LoupFinderInHC4 finder(norm_sys);
+	CellHeap heap(ext_sys);
+
+	Optimizer o(2, hc4, rr, finder, heap, ext_sys.goal_var(), 0, 1e-9, 1e-9);
+
+	CountListener count(false);
+	o.listener=&count;
+	CPPUNIT_ASSERT(o.optimize(IntervalVector(2,Interval(-10,10)))==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(count.nb_loup>0);
+	CPPUNIT_ASSERT(count.nb_uplo>0);
+	CPPUNIT_ASSERT(count.nb_cells==(int) (o.get_nb_cells()/10));
+	CPPUNIT_ASSERT(count.nb_milestones>0);
+
+	CountListener stop(true);
+	o.listener=&stop;
+	CPPUNIT_ASSERT(o.optimize(IntervalVector(2,Interval(-10,10)))==Optimizer::INTERRUPTED);
+	CPPUNIT_ASSERT(stop.nb_loup==1);
+	CPPUNIT_ASSERT(o.get_loup()<POS_INFINITY);
+	CPPUNIT_ASSERT(o.get_data().size()>1); // remaining cells
+
+	// continue from the intermediate result
+	CovOptimData data(o.get_data(), true);
+	o.listener=NULL;
+	CPPUNIT_ASSERT(o.optimize(data)==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()>=-2.25 && o.get_uplo()<=-2.25);
+}
+
+void TestOptimizer::cancellation() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x+y<=10);
+	fac.add_goal(pow(x,4)-3*sqr(x)+sqr(y));
+	System sys(fac);
+
+	ExtendedSystem ext_sys(sys);
+	NormalizedSystem norm_sys(sys);
+	CtcHC4 hc4(ext_sys,0.01,true);
+	CtcFixPoint fp(hc4);
+	RoundRobin rr(0);
+	LoupFinderInHC4 finder(norm_sys);
+	CellHeap heap(ext_sys);
+
+	Optimizer o(2, fp, rr, finder, heap, ext_sys.goal_var(), 0, 1e-9, 1e-9);
+	IntervalVector box(2,Interval(-10,10));
+
+	Cancellation token;
+	o.cancellation=&token;
+
+	token.cancel();
+	CPPUNIT_ASSERT(o.optimize(box)==Optimizer::INTERRUPTED);
+	CPPUNIT_ASSERT(o.get_data().size()>1); // remaining cells
+
+	token.reset();
+	token.set_deadline(1e-9);
+	CPPUNIT_ASSERT(o.optimize(box)==Optimizer::TIME_OUT);
+
+	token.reset();
+	CPPUNIT_ASSERT(o.optimize(box)==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()>=-2.25 && o.get_uplo()<=-2.25);
+}
+
+void TestOptimizer::parallel_beam() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x+y<=10);
+	// two global minimizers: (+/-sqrt(1.5),0); f*=-2.25
+	fac.add_goal(pow(x,4)-3*sqr(x)+sqr(y));
+	System sys(fac);
+
+	ExtendedSystem ext_sys(sys);
+	NormalizedSystem norm_sys(sys);
+	CtcHC4 hc4(ext_sys,0.01,true);
+	RoundRobin rr(0);
+	CellHeap current(ext_sys), future(ext_sys);
+	CellBeamSearch buffer(current, future, ext_sys, 4);
+	LoupFinderInHC4 finder(norm_sys);
+
+	// one copy of the system for each additional thread
+	System sys1(sys,System::COPY), sys2(sys,System::COPY);
+	ExtendedSystem ext_sys1(sys1), ext_sys2(sys2);
+	NormalizedSystem norm_sys1(sys1), norm_sys2(sys2);
+	CtcHC4 hc4_1(ext_sys1,0.01,true), hc4_2(ext_sys2,0.01,true);
+	LoupFinderInHC4 finder1(norm_sys1), finder2(norm_sys2);
+
+	Optimizer o(2, hc4, rr, finder, buffer, ext_sys.goal_var());
+	o.set_parallel_beam(Array<Ctc>(hc4_1, hc4_2), Array<LoupFinder>(finder1, finder2));
+
+	IntervalVector box(2,Interval(-10,10));
+
+	RNG::srand(1);
+	CPPUNIT_ASSERT(o.optimize(box)==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()>=-2.25 && o.get_uplo()<=-2.25);
+
+	double loup=o.get_loup();
+	double uplo=o.get_uplo();
+	size_t nb_cells=o.get_nb_cells();
+
+	// same result with the same number of threads and seed
+	RNG::srand(1);
+	CPPUNIT_ASSERT(o.optimize(box)==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()==loup);
+	CPPUNIT_ASSERT(o.get_uplo()==uplo);
+	CPPUNIT_ASSERT(o.get_nb_cells()==nb_cells);
+
+	// profiling (thread-safe) does not change the result
+	CtcProfile::enabled=true;
+	RNG::srand(1);
+	CPPUNIT_ASSERT(o.optimize(box)==Optimizer::SUCCESS);
+	CtcProfile::enabled=false;
+	CtcProfile::clear();
+	CPPUNIT_ASSERT(o.get_loup()==loup);
+	CPPUNIT_ASSERT(o.get_nb_cells()==nb_cells);
+}
+
+void TestOptimizer::reoptimize() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x+y<=10);
+	// two global minimizers: (+/-sqrt(1.5),0); f*=-2.25
+	fac.add_goal(pow(x,4)-3*sqr(x)+sqr(y));
+	System sys(fac);
+
+	ExtendedSystem ext_sys(sys);
+	NormalizedSystem norm_sys(sys);
+	CtcHC4 hc4(ext_sys,0.01,true);
+	RoundRobin rr(0);
+	CellHeap buffer(ext_sys);
+	LoupFinderInHC4 finder(norm_sys);
+
+	Optimizer o(2, hc4, rr, finder, buffer, ext_sys.goal_var());
+
+	CPPUNIT_ASSERT(o.optimize(IntervalVector(2,Interval(-10,10)))==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()>=-2.25 && o.get_uplo()<=-2.25);
+	size_t nb_cells=o.get_nb_cells();
+
+	// the loup point is still in the box: warm start
+	CPPUNIT_ASSERT(o.reoptimize(IntervalVector(2,Interval(-5,5)))==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()>=-2.25 && o.get_uplo()<=-2.25);
+	CPPUNIT_ASSERT(o.get_nb_cells()<nb_cells);
+
+	// the minimizers are removed: new search (f*=-1.6875 at x=1.5)
+	double _box[][2]={{1.5,5},{-5,5}};
+	CPPUNIT_ASSERT(o.reoptimize(IntervalVector(2,_box))==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()>=-1.6875 && o.get_uplo()<=-1.6875);
+
+	// another objective (f*=-2.25 at (+/-sqrt(1.5),0.1)), the previous loup point being a candidate
+	SystemFactory fac2;
+	fac2.add_var(x);
+	fac2.add_var(y);
+	fac2.add_ctr(x+y<=10);
+	fac2.add_goal(pow(x,4)-3*sqr(x)+sqr(y-0.1));
+	System sys2(fac2);
+
+	ExtendedSystem ext_sys2(sys2);
+	NormalizedSystem norm_sys2(sys2);
+	CtcHC4 hc4_2(ext_sys2,0.01,true);
+	CellHeap buffer2(ext_sys2);
+	LoupFinderInHC4 finder2(norm_sys2);
+
+	Optimizer o2(2, hc4_2, rr, finder2, buffer2, ext_sys2.goal_var());
+	CPPUNIT_ASSERT(o2.optimize(IntervalVector(2,Interval(-10,10)), o.get_data())==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o2.get_loup()>=-2.25 && o2.get_uplo()<=-2.25);
+	// the loup is found at the root
+	CPPUNIT_ASSERT(o2.get_first_loup_time()==0);
+
+	// boxes of width <1 are not bisected: the minimum is in an eps-box
+	RoundRobin rr3(1);
+	Optimizer o3(2, hc4, rr3, finder, buffer, ext_sys.goal_var());
+	o3.optimize(IntervalVector(2,Interval(-10,10)));
+	double uplo_of_epsboxes=o3.get_data().uplo_of_epsboxes();
+	CPPUNIT_ASSERT(uplo_of_epsboxes<=-2.25);
+
+	// warm start: the eps-boxes are not lost
+	o3.reoptimize(IntervalVector(2,Interval(-5,5)));
+	CPPUNIT_ASSERT(o3.get_uplo()<=uplo_of_epsboxes);
+	CPPUNIT_ASSERT(o3.get_data().uplo_of_epsboxes()<=uplo_of_epsboxes);
+}
+
 } // end namespace
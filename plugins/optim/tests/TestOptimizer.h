@@ -32,6 +32,14 @@ public:
 	CPPUNIT_TEST(issue50_4);
 	CPPUNIT_TEST(unconstrained);
 #endif
+	CPPUNIT_TEST(async_upper_bounding);
+	CPPUNIT_TEST(async_seed);
+	CPPUNIT_TEST(max_cells);
+	CPPUNIT_TEST(cell_spill);
+	CPPUNIT_TEST(listener);
+	CPPUNIT_TEST(cancellation);
+	CPPUNIT_TEST(parallel_beam);
+	CPPUNIT_TEST(reoptimize);
 	CPPUNIT_TEST_SUITE_END();
 
 	// problem with vector variables
@@ -49,6 +57,28 @@ public:
 	void issue50_4();
 
 	void unconstrained(); // issue 333 and 335
+
+	// same result with upper bounding delegated to threads
+	void async_upper_bounding();
+
+	// the random generators of the upper bounding threads are seeded
+	void async_seed();
+
+	// bounded number of cells in memory (cells stored on disk)
+	void max_cells();
+	void cell_spill();
+
+	// notifications and interruption (then continuation)
+	void listener();
+
+	// cancellation token (stop flag and deadline)
+	void cancellation();
+
+	// beam contracted and bounded by several threads (deterministic result)
+	void parallel_beam();
+
+	// re-solve with tightened bounds or another objective (warm start)
+	void reoptimize();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestOptimizer);
@@ -107,6 +107,10 @@ public:
 	 * Removes (and deletes) from the heap all the cells
 	 * with a cost (according to the cost function of the
 	 * first heap) greater than \a loup.
+	 *
+	 * The removal and the update of the loup-dependent
+	 * costs of the second heap are lazy (see DoubleHeap),
+	 * except for the criterion C7.
 	 */
 	virtual void contract(double loup);
 
@@ -135,6 +139,9 @@ inline CellDoubleHeapSIP::CellDoubleHeapSIP(const SIPSystem& sys, int crit2_pr,
 		DoubleHeap<Cell>(*new CellCostVarLB(*(ExtendedSystem*)sys.ibex_system_, sys.ext_nb_var-1),
 				false, *CellCostFunc::get_cost(*(ExtendedSystem*)sys.ibex_system_, crit2, sys.ext_nb_var-1),
 				true /* TODO: give right value */, crit2_pr), sys(sys) {
+
+	// C7 may decrease when the loup decreases (see CellDoubleHeap)
+	lazy_cost2 = crit2!=CellCostFunc::C7;
 }
 
 inline CellDoubleHeapSIP::~CellDoubleHeapSIP() {
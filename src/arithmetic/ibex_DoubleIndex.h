@@ -59,6 +59,11 @@ public:
 	bool operator==(const DoubleIndex& idx) const;
 	bool operator!=(const DoubleIndex& idx) const;
 
+	/**
+	 * \brief Lexicographic order (dimension first), e.g., for maps.
+	 */
+	bool operator<(const DoubleIndex& idx) const;
+
 	/**
 	 * \brief True a domain with this index can be a reference
 	 */
@@ -163,6 +168,14 @@ inline bool DoubleIndex::operator==(const DoubleIndex& idx) const {
 	return dim==idx.dim && r1==idx.r1 && r2==idx.r2 && c1==idx.c1 && c2==idx.c2;
 }
 inline bool DoubleIndex::operator!=(const DoubleIndex& idx) const { return !(*this==idx); }
+inline bool DoubleIndex::operator<(const DoubleIndex& idx) const {
+	if (dim.nb_rows()!=idx.dim.nb_rows()) return dim.nb_rows()<idx.dim.nb_rows();
+	if (dim.nb_cols()!=idx.dim.nb_cols()) return dim.nb_cols()<idx.dim.nb_cols();
+	if (r1!=idx.r1) return r1<idx.r1;
+	if (r2!=idx.r2) return r2<idx.r2;
+	if (c1!=idx.c1) return c1<idx.c1;
+	return c2<idx.c2;
+}
 inline bool DoubleIndex::domain_ref() const { return all() || (one_row() && (all_cols() || one_col())); }
 
 } /* namespace ibex */
@@ -41,6 +41,7 @@ int main(int argc, char** argv) {
 			"description of the manifold with boxes in the COV (binary) format. See --format", {'o',"output"});
 	args::Flag format(parser, "format", "Give a description of the COV format used by IbexSolve", {"format"});
 	args::Flag bfs(parser, "bfs", "Perform breadth-first search (instead of depth-first search, by default)", {"bfs"});
+	args::Flag sparse(parser, "sparse", "Compile each constraint over its own variables only. Useful for large systems where each constraint involves few variables.", {"sparse"});
 	args::Flag trace(parser, "trace", "Activate trace. \"Solutions\" (output boxes) are displayed as and when they are found.", {"trace"});
 	args::ValueFlag<string> boundary_test_arg(parser, "true|full-rank|half-ball|false", "Boundary test strength. Possible values are:\n"
 			"\t\t* true:\talways satisfied. Set by default for under constrained problems (0<m<n).\n"
@@ -51,8 +52,13 @@ int main(int argc, char** argv) {
 	args::Flag sols(parser, "sols", "Display the \"solutions\" (output boxes) on the standard output.", {'s',"sols"});
 	args::ValueFlag<double> random_seed(parser, "float", _random_seed.str(), {"random-seed"});
 	args::Flag quiet(parser, "quiet", "Print no report on the standard output.",{'q',"quiet"});
+	args::ValueFlag<string> profile(parser, "filename", "Profile the contractors. Statistics are displayed in the report and written in JSON format in the given file.", {"profile"});
 	args::ValueFlag<string> forced_params(parser, "vars","Force some variables to be parameters in the parametric proofs, separated by '+'. Example: --forced-params=x+y",{"forced-params"});
-	args::Positional<std::string> filename(parser, "filename", "The name of the MINIBEX file.");
+	args::ValueFlag<int> cert_threads(parser, "int", "Number of threads certifying the candidate boxes asynchronously. Default value is 0 (each box is certified as soon as it is reached).", {"cert-threads"});
+	args::ValueFlag<int> build_threads(parser, "int", "Number of threads building the constraints (simplification and compilation) when the system is loaded. Default value is 1.", {"build-threads"});
+	args::ValueFlag<string> save_compiled(parser, "filename", "Save the system in binary (precompiled) format in the given file and exit. "
+			"This file can be given instead of the MINIBEX file in next runs, to skip parsing and simplification.", {"save-compiled"});
+	args::Positional<std::string> filename(parser, "filename", "The name of the MINIBEX file (or of a file generated with --save-compiled).");
 
 	try
 	{
@@ -93,9 +99,25 @@ int main(int argc, char** argv) {
 
 	try {
 
+		if (build_threads) {
+			if (build_threads.Get()<=0)
+				ibex_error("the number of build threads must be positive");
+			SystemFactory::default_nb_threads = build_threads.Get();
+		}
+
 		// Load a system of equations
 		System sys(filename.Get().c_str());
 
+		if (save_compiled) {
+			sys.save(save_compiled.Get().c_str());
+			if (!quiet)
+				cout << "  system saved in:\t" << save_compiled.Get() << endl;
+			return 0;
+		}
+
+		if (sparse)
+			sys.set_sparse();
+
 		string output_manifold_file; // manifold output file
 		bool overwitten=false;       // is it overwritten?
 		string manifold_copy;
@@ -113,6 +135,12 @@ int main(int argc, char** argv) {
 
 			if (bfs)
 				cout << "  bfs:\t\t\tON" << endl;
+
+			if (sparse)
+				cout << "  sparse:\t\tON" << endl;
+
+			if (build_threads)
+				cout << "  build:\t\t" << build_threads.Get() << " threads" << endl;
 		}
 
 		if (output_file) {
@@ -216,6 +244,18 @@ int main(int argc, char** argv) {
 			s.trace=trace.Get();
 		}
 
+		if (cert_threads) {
+			s.set_parallel_certification(cert_threads.Get());
+			if (!quiet)
+				cout << "  certification:\t" << cert_threads.Get() << " threads (asynchronous)" << endl;
+		}
+
+		if (profile) {
+			if (!quiet)
+				cout << "  profile:\t\t" << profile.Get() << endl;
+			CtcProfile::enabled=true;
+		}
+
 		if (!quiet) {
 			cout << "*****************************************************************" << endl << endl;
 		}
@@ -233,6 +273,11 @@ int main(int argc, char** argv) {
 
 		if (!quiet) s.report();
 
+		if (profile) {
+			ofstream json(profile.Get().c_str());
+			CtcProfile::to_json(json);
+		}
+
 		if (sols) cout << s.get_data() << endl;
 
 		s.get_data().save(output_manifold_file.c_str());
@@ -0,0 +1,411 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CApi.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CApiImpl.h"
+#include "ibex_Eval.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcNewton.h"
+#include "ibex_DefaultSolver.h"
+#include "ibex_SyntaxError.h"
+
+#include <sstream>
+#include <limits>
+
+using namespace std;
+using namespace ibex;
+
+struct ibex_ctc {
+	ibex_ctc(Ctc* ctc) : ctc(ctc), box(ctc->nb_var) { }
+	~ibex_ctc() { delete ctc; }
+
+	Ctc* ctc;
+	IntervalVector box; // allocated once
+};
+
+struct ibex_solver {
+	ibex_solver(ibex_system* sys, double eps_x_min, double eps_x_max) :
+		sys(sys), solver(*sys->sys, eps_x_min, eps_x_max), box(sys->sys->nb_var) { }
+
+	ibex_system* sys;
+	DefaultSolver solver;
+	IntervalVector box; // allocated once
+};
+
+namespace ibex {
+
+namespace capi {
+
+namespace {
+
+thread_local string last_error;
+
+inline void read(const double* lb, const double* ub, Interval& x) {
+	x=lb[0]<=ub[0]? Interval(lb[0],ub[0]) : Interval::empty_set();
+}
+
+inline void write(const Interval& x, double* lb, double* ub) {
+	if (x.is_empty()) {
+		lb[0]=numeric_limits<double>::infinity();
+		ub[0]=-numeric_limits<double>::infinity();
+	} else {
+		lb[0]=x.lb();
+		ub[0]=x.ub();
+	}
+}
+
+/*
+ * Write a box directly in the domains of the arguments.
+ */
+void write_args(const Function& f, Array<Domain>& args, const double* lb, const double* ub) {
+	int k=0;
+	for (int s=0; s<f.nb_arg(); s++) {
+		const Dim& dim=f.arg(s).dim;
+		switch (dim.type()) {
+		case Dim::SCALAR:
+			read(lb+k, ub+k, args[s].i());
+			k++;
+			break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR:
+			for (int j=0; j<dim.vec_size(); j++, k++)
+				read(lb+k, ub+k, args[s].v()[j]);
+			break;
+		default:
+			for (int i=0; i<dim.nb_rows(); i++)
+				for (int j=0; j<dim.nb_cols(); j++, k++)
+					read(lb+k, ub+k, args[s].m()[i][j]);
+		}
+	}
+}
+
+/*
+ * Read the image directly from the domain of the root node.
+ */
+void read_image(const Domain& y, double* lb, double* ub) {
+	if (y.is_empty()) {
+		for (int i=0; i<y.dim.size(); i++)
+			write(Interval::empty_set(), lb+i, ub+i);
+		return;
+	}
+
+	switch (y.dim.type()) {
+	case Dim::SCALAR:
+		write(y.i(), lb, ub);
+		break;
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR:
+		for (int i=0; i<y.v().size(); i++)
+			write(y.v()[i], lb+i, ub+i);
+		break;
+	default:
+		for (int i=0, k=0; i<y.dim.nb_rows(); i++)
+			for (int j=0; j<y.dim.nb_cols(); j++, k++)
+				write(y.m()[i][j], lb+k, ub+k);
+	}
+}
+
+} // end anonymous namespace
+
+void restore() {
+	// see the Java plugin
+#ifdef __gaol__
+	gaol::round_upward();
+#endif
+}
+
+int error(const string& msg) {
+	last_error=msg;
+	return IBEX_ERROR;
+}
+
+int handle_exception() {
+	try {
+		throw;
+	} catch(SyntaxError& e) {
+		ostringstream s;
+		s << e;
+		return error(s.str());
+	} catch(std::exception& e) {
+		return error(e.what());
+	} catch(Exception&) {
+		return error("exception raised by Ibex");
+	} catch(...) {
+		return error("unexpected error");
+	}
+}
+
+void read(const double* lb, const double* ub, IntervalVector& x) {
+	for (int i=0; i<x.size(); i++)
+		read(lb+i, ub+i, x[i]);
+}
+
+void write(const IntervalVector& x, double* lb, double* ub) {
+	if (x.is_empty()) {
+		for (int i=0; i<x.size(); i++)
+			write(Interval::empty_set(), lb+i, ub+i);
+	} else {
+		for (int i=0; i<x.size(); i++)
+			write(x[i], lb+i, ub+i);
+	}
+}
+
+} // end namespace capi
+
+} // end namespace ibex
+
+using namespace ibex::capi;
+
+ibex_function::ibex_function(const Function* f, bool owner) : f(f), owner(owner), n(f->nb_var()), m(f->image_dim()),
+		box(n), J(f->expr().dim.is_matrix()? 1 : m, n) {
+}
+
+ibex_function::~ibex_function() {
+	if (owner) delete f;
+}
+
+ibex_system::ibex_system(System* sys) : sys(sys), ctrs(&sys->f_ctrs, false),
+		goal(sys->goal? new ibex_function(sys->goal, false) : NULL) {
+}
+
+ibex_system::~ibex_system() {
+	delete goal;
+	delete sys;
+}
+
+extern "C" {
+
+const char* ibex_last_error(void) {
+	return ibex::capi::last_error.c_str();
+}
+
+/*================================== systems ========================================*/
+
+ibex_system* ibex_system_load(const char* filename) {
+	restore();
+	try {
+		return new ibex_system(new System(filename));
+	} catch(...) {
+		handle_exception();
+		return NULL;
+	}
+}
+
+void ibex_system_free(ibex_system* sys) {
+	delete sys;
+}
+
+int ibex_system_nb_var(const ibex_system* sys) {
+	return sys->sys->nb_var;
+}
+
+int ibex_system_nb_ctr(const ibex_system* sys) {
+	return sys->sys->nb_ctr;
+}
+
+void ibex_system_box(const ibex_system* sys, double* lb, double* ub) {
+	write(sys->sys->box, lb, ub);
+}
+
+ibex_function* ibex_system_ctrs(ibex_system* sys) {
+	return &sys->ctrs;
+}
+
+ibex_function* ibex_system_goal(ibex_system* sys) {
+	return sys->goal;
+}
+
+/*================================== functions ========================================*/
+
+ibex_function* ibex_function_load(const char* filename) {
+	restore();
+	try {
+		return new ibex_function(new Function(filename), true);
+	} catch(...) {
+		handle_exception();
+		return NULL;
+	}
+}
+
+void ibex_function_free(ibex_function* f) {
+	if (f && !f->owner) return; // belongs to a system
+	delete f;
+}
+
+int ibex_function_nb_var(const ibex_function* f) {
+	return f->n;
+}
+
+int ibex_function_image_dim(const ibex_function* f) {
+	return f->m;
+}
+
+int ibex_function_eval(ibex_function* f, int nb_box, const double* lb, const double* ub, double* ylb, double* yub) {
+	restore();
+	try {
+		Eval& eval=f->f->basic_evaluator();
+		for (int k=0; k<nb_box; k++) {
+			write_args(*f->f, eval.d.args, lb+k*f->n, ub+k*f->n);
+			read_image(eval.eval(), ylb+k*f->m, yub+k*f->m);
+		}
+		return 0;
+	} catch(...) {
+		return handle_exception();
+	}
+}
+
+int ibex_function_jacobian(ibex_function* f, int nb_box, const double* lb, const double* ub, double* Jlb, double* Jub) {
+	restore();
+
+	const Dim& dim=f->f->expr().dim;
+	if (dim.is_matrix())
+		return error("[ibex_function_jacobian] matrix-valued function");
+
+	int size=f->m*f->n;
+
+	try {
+		for (int k=0; k<nb_box; k++) {
+			read(lb+k*f->n, ub+k*f->n, f->box);
+			if (dim.is_scalar())
+				f->f->gradient(f->box, f->J[0]);
+			else
+				f->f->jacobian(f->box, f->J);
+			for (int i=0; i<f->m; i++)
+				write(f->J[i], Jlb+k*size+i*f->n, Jub+k*size+i*f->n);
+		}
+		return 0;
+	} catch(...) {
+		return handle_exception();
+	}
+}
+
+/*================================== contractors ========================================*/
+
+ibex_ctc* ibex_ctc_hc4(const ibex_system* sys) {
+	restore();
+	try {
+		return new ibex_ctc(new CtcHC4(*sys->sys));
+	} catch(...) {
+		handle_exception();
+		return NULL;
+	}
+}
+
+ibex_ctc* ibex_ctc_fwdbwd(const ibex_function* f, const double* ylb, const double* yub) {
+	restore();
+
+	if (f->f->expr().dim.is_matrix()) {
+		error("[ibex_ctc_fwdbwd] matrix-valued function");
+		return NULL;
+	}
+
+	try {
+		if (f->f->expr().dim.is_scalar()) {
+			Interval y;
+			read(ylb, yub, y);
+			return new ibex_ctc(new CtcFwdBwd(*f->f, y));
+		} else {
+			IntervalVector y(f->m);
+			read(ylb, yub, y);
+			return new ibex_ctc(new CtcFwdBwd(*f->f, y));
+		}
+	} catch(...) {
+		handle_exception();
+		return NULL;
+	}
+}
+
+ibex_ctc* ibex_ctc_newton(const ibex_function* f) {
+	restore();
+
+	if (!f->f->expr().dim.is_vector() || f->m!=f->n) {
+		error("[ibex_ctc_newton] the function must be square");
+		return NULL;
+	}
+
+	try {
+		return new ibex_ctc(new CtcNewton(*f->f));
+	} catch(...) {
+		handle_exception();
+		return NULL;
+	}
+}
+
+void ibex_ctc_free(ibex_ctc* c) {
+	delete c;
+}
+
+int ibex_ctc_contract(ibex_ctc* c, int nb_box, double* lb, double* ub, int* empty) {
+	restore();
+
+	int n=c->box.size();
+	int nb_empty=0;
+
+	try {
+		for (int k=0; k<nb_box; k++) {
+			read(lb+k*n, ub+k*n, c->box);
+			if (!c->box.is_empty()) c->ctc->contract(c->box);
+			write(c->box, lb+k*n, ub+k*n);
+			if (c->box.is_empty()) nb_empty++;
+			if (empty) empty[k]=c->box.is_empty();
+		}
+		return nb_empty;
+	} catch(...) {
+		return handle_exception();
+	}
+}
+
+/*================================== solver ========================================*/
+
+ibex_solver* ibex_solver_new(ibex_system* sys, double eps_x_min, double eps_x_max) {
+	restore();
+	try {
+		return new ibex_solver(sys, eps_x_min, eps_x_max);
+	} catch(...) {
+		handle_exception();
+		return NULL;
+	}
+}
+
+void ibex_solver_free(ibex_solver* s) {
+	delete s;
+}
+
+void ibex_solver_set_time_limit(ibex_solver* s, double time_limit) {
+	s->solver.time_limit=time_limit;
+}
+
+int ibex_solver_solve(ibex_solver* s, const double* lb, const double* ub) {
+	restore();
+	try {
+		if (lb)
+			read(lb, ub, s->box);
+		else
+			s->box=s->sys->sys->box;
+		return s->solver.solve(s->box);
+	} catch(...) {
+		return handle_exception();
+	}
+}
+
+int ibex_solver_nb_solution(const ibex_solver* s) {
+	return (int) s->solver.get_data().nb_solution();
+}
+
+int ibex_solver_nb_unknown(const ibex_solver* s) {
+	return (int) s->solver.get_data().nb_unknown();
+}
+
+void ibex_solver_solutions(const ibex_solver* s, double* lb, double* ub) {
+	const CovSolverData& data=s->solver.get_data();
+	int n=s->box.size();
+	for (size_t j=0; j<data.nb_solution(); j++)
+		write(data.solution(j), lb+j*n, ub+j*n);
+}
+
+} // end extern "C"
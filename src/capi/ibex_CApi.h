@@ -0,0 +1,267 @@
+/*============================================================================
+ *                                  I B E X
+ * File        : ibex_CApi.h
+ * Copyright   : IMT Atlantique (France)
+ * License     : See the LICENSE file
+ * Created     : Oct 19, 2026
+ *============================================================================*/
+
+#ifndef __IBEX_C_API_H__
+#define __IBEX_C_API_H__
+
+/**
+ * \defgroup capi C interface
+ *
+ * \brief Stable C interface, for embedding Ibex in other runtimes (FFI).
+ *
+ * All the objects are manipulated through opaque handles and all the
+ * boxes, interval vectors and interval matrices are passed as two
+ * arrays of doubles owned by the caller: the lower bounds and the
+ * upper bounds. A matrix is stored row by row. Nothing is allocated
+ * by a call that only reads or writes such buffers: the bounds are
+ * directly copied into the domains used by the algorithm (there is
+ * no intermediate IntervalVector), and the results are directly
+ * read from them.
+ *
+ * The functions that process boxes work by batches: the input and
+ * output buffers contain \a nb_box consecutive boxes (resp. vectors,
+ * matrices), so that a single call can amortize the cost of the FFI
+ * round-trip.
+ *
+ * An interval [lb,ub] with lb>ub is the empty set. An empty result is
+ * written as [+oo,-oo]. Infinite bounds are represented by the IEEE
+ * infinities.
+ *
+ * A function that can fail returns a negative value (see #IBEX_ERROR)
+ * or NULL, and the message is then given by #ibex_last_error.
+ *
+ * \note A handle must not be used by several threads simultaneously.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \ingroup capi \brief Returned by a function in case of error. */
+#define IBEX_ERROR -1
+
+/** \ingroup capi \brief System (see ibex::System). */
+typedef struct ibex_system ibex_system;
+
+/** \ingroup capi \brief Function (see ibex::Function). */
+typedef struct ibex_function ibex_function;
+
+/** \ingroup capi \brief Contractor (see ibex::Ctc). */
+typedef struct ibex_ctc ibex_ctc;
+
+/** \ingroup capi \brief Solver (see ibex::Solver). */
+typedef struct ibex_solver ibex_solver;
+
+/**
+ * \ingroup capi
+ * \brief Message of the last error that occurred in the calling thread.
+ */
+const char* ibex_last_error(void);
+
+/*================================== systems ========================================*/
+
+/**
+ * \ingroup capi
+ * \brief Load a system from a Minibex (or binary) file.
+ *
+ * \return NULL in case of error.
+ */
+ibex_system* ibex_system_load(const char* filename);
+
+/**
+ * \ingroup capi
+ * \brief Delete a system (and the functions obtained from it).
+ */
+void ibex_system_free(ibex_system* sys);
+
+/** \ingroup capi \brief Number of variables. */
+int ibex_system_nb_var(const ibex_system* sys);
+
+/** \ingroup capi \brief Number of constraints. */
+int ibex_system_nb_ctr(const ibex_system* sys);
+
+/**
+ * \ingroup capi
+ * \brief Initial box of the system (nb_var bounds).
+ */
+void ibex_system_box(const ibex_system* sys, double* lb, double* ub);
+
+/**
+ * \ingroup capi
+ * \brief Function of the constraints.
+ *
+ * The function belongs to the system.
+ */
+ibex_function* ibex_system_ctrs(ibex_system* sys);
+
+/**
+ * \ingroup capi
+ * \brief Goal function (NULL if the system has no goal).
+ *
+ * The function belongs to the system.
+ */
+ibex_function* ibex_system_goal(ibex_system* sys);
+
+/*================================== functions ========================================*/
+
+/**
+ * \ingroup capi
+ * \brief Load a function from a file.
+ *
+ * \return NULL in case of error.
+ */
+ibex_function* ibex_function_load(const char* filename);
+
+/**
+ * \ingroup capi
+ * \brief Delete a function loaded by #ibex_function_load.
+ */
+void ibex_function_free(ibex_function* f);
+
+/** \ingroup capi \brief Number of variables (size of an input box). */
+int ibex_function_nb_var(const ibex_function* f);
+
+/**
+ * \ingroup capi
+ * \brief Size of the image (1 for a real-valued function,
+ *        number of entries for a matrix-valued function).
+ */
+int ibex_function_image_dim(const ibex_function* f);
+
+/**
+ * \ingroup capi
+ * \brief Evaluate a function on a batch of boxes.
+ *
+ * \param lb, ub   - nb_box*nb_var bounds.
+ * \param ylb, yub - nb_box*image_dim bounds (output).
+ *
+ * \return 0 or #IBEX_ERROR.
+ */
+int ibex_function_eval(ibex_function* f, int nb_box, const double* lb, const double* ub, double* ylb, double* yub);
+
+/**
+ * \ingroup capi
+ * \brief Jacobian matrices of a function on a batch of boxes.
+ *
+ * For a real-valued function, this is the gradient.
+ *
+ * \param lb, ub   - nb_box*nb_var bounds.
+ * \param Jlb, Jub - nb_box*image_dim*nb_var bounds (output, row-major).
+ *
+ * \return 0 or #IBEX_ERROR (e.g., matrix-valued function).
+ */
+int ibex_function_jacobian(ibex_function* f, int nb_box, const double* lb, const double* ub, double* Jlb, double* Jub);
+
+/*================================== contractors ========================================*/
+
+/**
+ * \ingroup capi
+ * \brief HC4 contractor of the constraints of a system.
+ *
+ * \pre The system must not be deleted before the contractor.
+ * \return NULL in case of error.
+ */
+ibex_ctc* ibex_ctc_hc4(const ibex_system* sys);
+
+/**
+ * \ingroup capi
+ * \brief Forward-backward contractor of f(x) in [ylb,yub].
+ *
+ * \param ylb, yub - image_dim bounds.
+ * \pre The function must not be deleted before the contractor.
+ * \return NULL in case of error.
+ */
+ibex_ctc* ibex_ctc_fwdbwd(const ibex_function* f, const double* ylb, const double* yub);
+
+/**
+ * \ingroup capi
+ * \brief Interval Newton contractor of f(x)=0.
+ *
+ * \pre f must be square (nb_var=image_dim) and must not be
+ *      deleted before the contractor.
+ * \return NULL in case of error.
+ */
+ibex_ctc* ibex_ctc_newton(const ibex_function* f);
+
+/**
+ * \ingroup capi
+ * \brief Delete a contractor.
+ */
+void ibex_ctc_free(ibex_ctc* c);
+
+/**
+ * \ingroup capi
+ * \brief Contract a batch of boxes (in place).
+ *
+ * \param lb, ub - nb_box*nb_var bounds (input/output).
+ * \param empty  - if not NULL, nb_box flags (output) set to 1
+ *                 if the corresponding box is empty, 0 otherwise.
+ *
+ * \return the number of empty boxes, or #IBEX_ERROR.
+ */
+int ibex_ctc_contract(ibex_ctc* c, int nb_box, double* lb, double* ub, int* empty);
+
+/*================================== solver ========================================*/
+
+/**
+ * \ingroup capi
+ * \brief Default solver of a system (see ibex::DefaultSolver).
+ *
+ * \pre The system must not be deleted before the solver.
+ * \return NULL in case of error.
+ */
+ibex_solver* ibex_solver_new(ibex_system* sys, double eps_x_min, double eps_x_max);
+
+/**
+ * \ingroup capi
+ * \brief Delete a solver.
+ */
+void ibex_solver_free(ibex_solver* s);
+
+/**
+ * \ingroup capi
+ * \brief Set the time limit (in seconds, -1 for no limit).
+ */
+void ibex_solver_set_time_limit(ibex_solver* s, double time_limit);
+
+/**
+ * \ingroup capi
+ * \brief Run the solver.
+ *
+ * \param lb, ub - nb_var bounds (initial box). If NULL, the box of
+ *                 the system is used.
+ *
+ * \return the status (value of ibex::Solver::Status), or #IBEX_ERROR.
+ */
+int ibex_solver_solve(ibex_solver* s, const double* lb, const double* ub);
+
+/**
+ * \ingroup capi
+ * \brief Number of solutions found by the last run.
+ */
+int ibex_solver_nb_solution(const ibex_solver* s);
+
+/**
+ * \ingroup capi
+ * \brief Number of boxes of unknown status found by the last run.
+ */
+int ibex_solver_nb_unknown(const ibex_solver* s);
+
+/**
+ * \ingroup capi
+ * \brief Copy all the solutions of the last run.
+ *
+ * \param lb, ub - nb_solution*nb_var bounds (output).
+ */
+void ibex_solver_solutions(const ibex_solver* s, double* lb, double* ub);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IBEX_C_API_H__ */
@@ -0,0 +1,82 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CApiImpl.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_C_API_IMPL_H__
+#define __IBEX_C_API_IMPL_H__
+
+#include "ibex_CApi.h"
+#include "ibex_System.h"
+
+#include <string>
+
+/*
+ * Implementation of the handles of the C interface.
+ *
+ * This header is only included by the implementation of the C
+ * interface (and by the C interfaces of plugins).
+ */
+
+struct ibex_function {
+	ibex_function(const ibex::Function* f, bool owner);
+	~ibex_function();
+
+	const ibex::Function* f;
+	bool owner;
+	int n;                     // number of variables
+	int m;                     // image dimension
+	ibex::IntervalVector box;  // for the jacobian (allocated once)
+	ibex::IntervalMatrix J;    // for the jacobian (allocated once)
+};
+
+struct ibex_system {
+	ibex_system(ibex::System* sys);
+	~ibex_system();
+
+	ibex::System* sys;
+	ibex_function ctrs;
+	ibex_function* goal;
+};
+
+namespace ibex {
+
+namespace capi {
+
+/**
+ * \brief Restore the rounding mode of the interval library.
+ *
+ * Must be called at each entry point: the caller may have changed it.
+ */
+void restore();
+
+/**
+ * \brief Set the last error and return IBEX_ERROR.
+ */
+int error(const std::string& msg);
+
+/**
+ * \brief Set the last error from the current exception and return IBEX_ERROR.
+ *
+ * \pre Must be called in a catch block.
+ */
+int handle_exception();
+
+/**
+ * \brief Read a box from lower/upper bounds.
+ */
+void read(const double* lb, const double* ub, IntervalVector& x);
+
+/**
+ * \brief Write a box in lower/upper bounds.
+ */
+void write(const IntervalVector& x, double* lb, double* ub);
+
+} // end namespace capi
+
+} // end namespace ibex
+
+#endif // __IBEX_C_API_IMPL_H__
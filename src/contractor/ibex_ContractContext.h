@@ -12,6 +12,7 @@
 #include "ibex_Map.h"
 #include "ibex_BoxProperties.h"
 #include "ibex_BitSet.h"
+#include "ibex_Cancellation.h"
 
 namespace ibex {
 
@@ -76,6 +77,23 @@ public:
 	 */
 	BoxProperties& prop;
 
+	/**
+	 * \brief Cancellation token (NULL if none).
+	 *
+	 * Contractors with internal loops (fixpoint, propagation, shaving)
+	 * poll the token and stop early if it is cancelled. The box is
+	 * then less contracted but still valid. The token is shared
+	 * by the copies of this context.
+	 */
+	Cancellation* cancellation;
+
+	/**
+	 * \brief Return true if the contraction has to stop.
+	 *
+	 * See #cancellation.
+	 */
+	bool cancelled();
+
 protected:
 	const bool own_prop; // for cleanup
 };
@@ -84,11 +102,11 @@ protected:
  	 	 	 	 	 	 	 inline implementation
  ============================================================================*/
 
-inline ContractContext::ContractContext(BoxProperties& prop) : impact(BitSet::all(prop.box.size())), output_flags(prop.box.size()), prop(prop), own_prop(false) {
+inline ContractContext::ContractContext(BoxProperties& prop) : impact(BitSet::all(prop.box.size())), output_flags(prop.box.size()), prop(prop), cancellation(NULL), own_prop(false) {
 
 }
 
-inline ContractContext::ContractContext(const IntervalVector& box) : impact(BitSet::all(box.size())), output_flags(box.size()), prop(*new BoxProperties(box)), own_prop(true) {
+inline ContractContext::ContractContext(const IntervalVector& box) : impact(BitSet::all(box.size())), output_flags(box.size()), prop(*new BoxProperties(box)), cancellation(NULL), own_prop(true) {
 
 }
 
@@ -96,7 +114,7 @@ inline ContractContext::ContractContext(const ContractContext& c) : ContractCont
 
 }
 
-inline ContractContext::ContractContext(const IntervalVector& box, const ContractContext& c) : impact(c.impact), output_flags(c.output_flags), prop(*new BoxProperties(box, c.prop)), own_prop(true) {
+inline ContractContext::ContractContext(const IntervalVector& box, const ContractContext& c) : impact(c.impact), output_flags(c.output_flags), prop(*new BoxProperties(box, c.prop)), cancellation(c.cancellation), own_prop(true) {
 
 }
 
@@ -104,6 +122,10 @@ inline ContractContext::~ContractContext() {
 	if (own_prop) delete &prop;
 }
 
+inline bool ContractContext::cancelled() {
+	return cancellation && cancellation->poll();
+}
+
 } /* namespace ibex */
 
 #endif /* __IBEX_CONTRACT_CONTEXT_H__ */
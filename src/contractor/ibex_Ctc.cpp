@@ -14,8 +14,26 @@
 #include "ibex_SepCtcPair.h"
 #include "ibex_CtcIdentity.h"
 
+#include <typeinfo>
+
 namespace ibex {
 
+namespace {
+
+// decrease of the log-volume, restricted to the components
+// that are bounded and non-degenerated (before and after).
+double log_reduction(const Vector& init_diam, const IntervalVector& box) {
+	double r=0;
+	for (int j=0; j<box.size(); j++) {
+		double d=box[j].diam();
+		if (init_diam[j]<POS_INFINITY && d>0 && init_diam[j]>0)
+			r += ::log(init_diam[j]) - ::log(d);
+	}
+	return r;
+}
+
+}
+
 bool Ctc::check_nb_var_ctc_list (const Array<Ctc>& l)  {
 	int i=1, n=l[0].nb_var;
 	while (i<l.size() && l[i].nb_var==n) {
@@ -24,6 +42,24 @@ bool Ctc::check_nb_var_ctc_list (const Array<Ctc>& l)  {
 	return (i==l.size());
 }
 
+void Ctc::contract_and_record(IntervalVector& box, ContractContext& context) {
+	if (!profile) profile=CtcProfile::create(typeid(*this));
+
+	Vector init_diam=box.is_empty()? Vector::zeros(box.size()) : box.diam();
+	double start=CtcProfile::wall_time();
+
+	try {
+		contract(box,context);
+	} catch(...) {
+		profile->add_call(CtcProfile::wall_time()-start, false, 0);
+		throw;
+	}
+
+	double time=CtcProfile::wall_time()-start;
+	bool empty=box.is_empty();
+	profile->add_call(time, empty, empty? 0 : log_reduction(init_diam,box));
+}
+
 void Ctc::contract(Set& set, double eps) {
 	CtcIdentity id(nb_var);
 	SepCtcPair sep(id,*this);
@@ -19,6 +19,7 @@
 #include "ibex_Array.h"
 #include "ibex_ContractContext.h"
 #include "ibex_Set.h"
+#include "ibex_CtcProfile.h"
 
 namespace ibex {
 
@@ -86,6 +87,14 @@ public:
 	 */
 	virtual void contract(IntervalVector& box, ContractContext& context);
 
+	/**
+	 * \brief Contract a box with a context and record runtime statistics.
+	 *
+	 * Same as contract(box,context) if profiling is disabled (see CtcProfile::enabled).
+	 * This is how strategies and composite contractors should call their sub-contractors.
+	 */
+	void profiled_contract(IntervalVector& box, ContractContext& context);
+
 	/**
 	 * \brief Contraction with specified impact.
 	 *
@@ -138,11 +147,21 @@ public:
 	 */
 	BitSet* output;
 
+	/**
+	 * \brief Runtime statistics (NULL pointer if not profiled).
+	 *
+	 * \see #profiled_contract(IntervalVector&, ContractContext&).
+	 */
+	CtcProfile* profile;
+
 protected:
 	/**
 	 * \brief Check if the size of all the contractor of the list is the same.
 	 */
 	static bool check_nb_var_ctc_list (const Array<Ctc>& l);
+
+private:
+	void contract_and_record(IntervalVector& box, ContractContext& context);
 };
 
 
@@ -150,9 +169,9 @@ protected:
  	 	 	 	 	 	 	 inline implementation
   ============================================================================*/
 
-inline Ctc::Ctc(int n) : nb_var(n), input(NULL), output(NULL) { }
+inline Ctc::Ctc(int n) : nb_var(n), input(NULL), output(NULL), profile(NULL) { }
 
-inline Ctc::Ctc(const Array<Ctc>& l) : nb_var(l[0].nb_var), input(NULL), output(NULL) { }
+inline Ctc::Ctc(const Array<Ctc>& l) : nb_var(l[0].nb_var), input(NULL), output(NULL), profile(NULL) { }
 
 inline Ctc::~Ctc() { }
 
@@ -164,6 +183,13 @@ inline void Ctc::contract(IntervalVector& box, ContractContext& context) {
 	context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
 }
 
+inline void Ctc::profiled_contract(IntervalVector& box, ContractContext& context) {
+	if (CtcProfile::enabled)
+		contract_and_record(box,context);
+	else
+		contract(box,context);
+}
+
 inline void Ctc::contract(IntervalVector& box, const BitSet& impact) {
 	ContractContext context(box);
 	context.impact = impact;
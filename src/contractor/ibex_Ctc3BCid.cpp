@@ -11,13 +11,28 @@
 
 #include "ibex_Ctc3BCid.h"
 
+#include <exception>
+#include <future>
+
 using namespace std;
 namespace ibex {
 
+namespace {
+
+// the kth slice of x (among n slices of width w)
+Interval slice(const Interval& x, int k, int n, double w) {
+	double inf_k = x.lb() + k * w;
+	double sup_k = x.lb() + (k+1) * w;
+	if (sup_k > x.ub() || (k == n-1 && sup_k < x.ub())) sup_k = x.ub();
+	return Interval(inf_k, sup_k);
+}
+
+}
+
 Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
 									Ctc(ctc.nb_var), cid_vars(cid_vars), ctc(ctc), s3b(s3b), scid(scid),
 									vhandled(vhandled<=0? cid_vars.size():vhandled),
-									var_min_width(var_min_width), start_var(0) {
+									var_min_width(var_min_width), start_var(0), context(NULL), pool(NULL) {
 	assert(ctc.nb_var>0);
 	//	if (ctc.nb_var<=0)
 	//		ibex_error("Ctc3BCID : the contractor is non-dimensional, Please specify the dimension with: \n Ctc3BCid(int nb_var, const BoolMask& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width);");
@@ -27,7 +42,7 @@ Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, Ctc& ctc, int s3b, int scid, int vhan
 Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
                     				Ctc(ctc.nb_var), cid_vars(BitSet::all(nb_var)), ctc(ctc), s3b(s3b), scid(scid),
 									vhandled(vhandled<=0? nb_var : vhandled),
-									var_min_width(var_min_width), start_var(0), context(NULL) {
+									var_min_width(var_min_width), start_var(0), context(NULL), pool(NULL) {
 
 	assert(ctc.nb_var>0);
 	//	if (ctc.nb_var<=0)
@@ -35,7 +50,23 @@ Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_wid
 }
 
 Ctc3BCid::~Ctc3BCid() {
+	if (pool) delete pool;
+}
+
+void Ctc3BCid::set_parallel(const Array<Ctc>& ctcs) {
+	if (pool) {
+		delete pool;
+		pool=NULL;
+	}
+
+	workers.clear();
+	for (int i=0; i<ctcs.size(); i++) {
+		assert(ctcs[i].nb_var==nb_var);
+		workers.push_back(&ctcs[i]);
+	}
 
+	if (!workers.empty())
+		pool = new ThreadPool(workers.size()+1);
 }
 
 void Ctc3BCid::add_property(const IntervalVector& init_box, BoxProperties& map) {
@@ -72,6 +103,9 @@ void Ctc3BCid::contract(IntervalVector& box, ContractContext& context) {
 
 	for (int k=0; k<vhandled; k++) {                   // [gch] k counts the number of varCIDed variables [gch]
 
+		// stop early (the box is valid: the remaining variables are not handled)
+		if (context.cancelled()) break;
+
 		var=(start_var+k)%nb_var;
 
 		var3BCID(box, var);
@@ -177,6 +211,53 @@ void Ctc3BCid::update_and_contract(IntervalVector& box, int var) {
 	ctc.contract(box,sub_context);
 }
 
+void Ctc3BCid::update_and_contract(const IntervalVector& box, int var, const vector<Interval>& doms, vector<IntervalVector>& boxes) {
+
+	int n=doms.size();
+	assert(n<=(int) workers.size()+1);
+
+	boxes.assign(n, box);
+
+	// Contexts are built sequentially (copying properties is not thread-safe)
+	vector<ContractContext*> sub_contexts(n);
+	for (int i=0; i<n; i++) {
+		boxes[i][var] = doms[i];
+		sub_contexts[i] = new ContractContext(boxes[i], *context);
+		sub_contexts[i]->impact.clear();
+		sub_contexts[i]->impact.add(var);
+		sub_contexts[i]->prop.update(BoxEvent(boxes[i], BoxEvent::CONTRACT, BitSet::singleton(nb_var,var)));
+	}
+
+	// the thread k of the pool works with workers[k-1]
+	vector<future<void> > slices;
+	for (int i=1; i<n; i++)
+		slices.push_back(pool->submit([this,i,&boxes,&sub_contexts](int k) {
+			workers[k-1]->contract(boxes[i], *sub_contexts[i]);
+		}));
+
+	exception_ptr error;
+
+	try {
+		ctc.contract(boxes[0], *sub_contexts[0]);
+	} catch(...) {
+		error = current_exception();
+	}
+
+	// wait for all the slices (they use the contexts)
+	for (vector<future<void> >::iterator it=slices.begin(); it!=slices.end(); it++) {
+		try {
+			it->get();
+		} catch(...) {
+			if (!error) error = current_exception();
+		}
+	}
+
+	for (int i=0; i<n; i++)
+		delete sub_contexts[i];
+
+	if (error) rethrow_exception(error);
+}
+
 bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var, double wv, bool left) {
 
 	IntervalVector initbox = box;
@@ -270,6 +351,9 @@ bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var, double wv, bool l
 
 bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double w_DC, Interval& dom) {
 
+	if (!workers.empty())
+		return var3BCID_slices_par(box, var, locs3b, w_DC);
+
 	IntervalVector savebox(box);
 
 	// Reduce left bound by shaving:
@@ -382,10 +466,138 @@ bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double
 }
 
 
+bool Ctc3BCid::var3BCID_slices_par(IntervalVector& box, int var, int locs3b, double w_DC) {
+
+	// Same algorithm as var3BCID_slices: see comments therein.
+
+	IntervalVector savebox(box);
+	Interval x(savebox[var]);
+	int nb_threads=workers.size()+1;
+
+	vector<Interval> doms;
+	vector<IntervalVector> boxes;
+
+	// Reduce left bound by shaving:
+
+	bool stopLeft = false;
+	double leftBound = x.lb();
+	double rightBound = x.ub();
+	double leftCID=0.;
+
+	int k=0;
+
+	while (k < locs3b && ! stopLeft) {
+
+		doms.clear();
+		for (int i=k; i<locs3b && i<k+nb_threads; i++)
+			doms.push_back(slice(x, i, locs3b, w_DC));
+
+		update_and_contract(savebox, var, doms, boxes);
+
+		for (unsigned int i=0; i<doms.size() && !stopLeft; i++, k++) {
+			if (boxes[i].is_empty())
+				leftBound = doms[i].ub();
+			else {
+				stopLeft = true;
+				leftCID = doms[i].ub();
+				leftBound = boxes[i][var].lb();
+				box = boxes[i];
+			}
+		}
+	}
+
+	if (!stopLeft) {
+		box.set_empty();
+		return true;
+	} else if (k == locs3b) {
+		return true;
+	}
+
+	IntervalVector newbox (box);
+	int kLeft = k-1;
+
+	// Reduce right bound by shaving:
+
+	bool stopRight = false;
+	double lastInf_k=0.;
+
+	int k2 = locs3b - 1;
+
+	while (k2 > kLeft && ! stopRight) {
+
+		doms.clear();
+		for (int i=k2; i>kLeft && i>k2-nb_threads; i--)
+			doms.push_back(slice(x, i, locs3b, w_DC));
+
+		update_and_contract(savebox, var, doms, boxes);
+
+		for (unsigned int i=0; i<doms.size() && !stopRight; i++, k2--) {
+			if (boxes[i].is_empty())
+				rightBound = doms[i].ub();
+			else {
+				stopRight = true;
+				lastInf_k = doms[i].lb();
+				rightBound = boxes[i][var].ub();
+				box = boxes[i];
+			}
+		}
+	}
+
+	if (!stopRight) {
+		box = newbox;
+		return true;
+	}
+
+	int kRight = k2 +1;
+
+	if (kLeft + 1 == kRight) {
+		box = box | newbox;
+		return true;
+	}
+
+	newbox = newbox | box;
+	savebox[var]=Interval(leftCID, lastInf_k);
+
+	if(varCID(var,savebox,newbox)) {
+		box = newbox;
+	} else {
+		box = savebox;
+		box[var] = Interval(leftBound, rightBound);
+	}
+
+	return true;
+}
+
 bool Ctc3BCid::varCID(int var, IntervalVector &varcid_box, IntervalVector &var3Bcid_box) {
 
 	if(scid==0 || equalBoxes (var, varcid_box, var3Bcid_box)) return false;
 
+	if (!workers.empty()) {
+		// multi-threaded mode: slices are contracted by batches
+		// and added to the hull in the sequential order.
+		int nb_threads=workers.size()+1;
+		Interval x(varcid_box[var]);
+		double w_DC = x.diam() / scid;
+		vector<Interval> doms;
+		vector<IntervalVector> boxes;
+
+		for (int k = 0; k < scid; k += nb_threads) {
+			doms.clear();
+			for (int i=k; i<scid && i<k+nb_threads; i++)
+				doms.push_back(slice(x, i, scid, w_DC));
+
+			update_and_contract(varcid_box, var, doms, boxes);
+
+			for (unsigned int i=0; i<doms.size(); i++) {
+				if (boxes[i].is_empty()) continue;
+				var3Bcid_box |= boxes[i];
+				if(equalBoxes (var, varcid_box, var3Bcid_box))
+					return false;
+			}
+		}
+		return true;
+	}
+
 	IntervalVector box=varcid_box;
 	Interval& dom(box[var]);
 
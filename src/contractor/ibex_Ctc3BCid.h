@@ -14,6 +14,9 @@
 
 #include "ibex_Ctc.h"
 #include "ibex_BitSet.h"
+#include "ibex_ThreadPool.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -148,6 +151,24 @@ public:
       otherwise it is achieved in a linear way. **/
 	static constexpr int LimitCIDDichotomy = 16;
 
+	/**
+	 * \brief Enable the multi-threaded mode.
+	 *
+	 * In this mode, the slices of a variable are contracted concurrently, by
+	 * batches of ctcs.size()+1 slices. The result is the same as in the sequential
+	 * mode: the contracted slices are merged in the order of the sequential
+	 * algorithm (some contractions are just done in vain).
+	 * Only the "linear" shaving and the CID slices are parallelized; the
+	 * dichotomic shaving (see #LimitCIDDichotomy) remains sequential.
+	 * The threads are created by this call, and reused by all the
+	 * subsequent contractions.
+	 *
+	 * \param ctcs - Copies of the sub-contractor, one for each additional thread.
+	 *               As they run concurrently with #ctc, they must not share any data
+	 *               with it (e.g., they can be built on copies of the system).
+	 */
+	void set_parallel(const Array<Ctc>& ctcs);
+
 protected:
 	/**
 	 * Applies 3BCID contraction on the variable var.
@@ -221,6 +242,19 @@ protected:
 
 	void update_and_contract(IntervalVector& box, int var);
 
+	/**
+	 * Multi-threaded counterpart of #update_and_contract.
+	 *
+	 * Contracts the slices (box with box[var] replaced by doms[i]) concurrently
+	 * and stores the contracted slices in \a boxes.
+	 */
+	void update_and_contract(const IntervalVector& box, int var, const std::vector<Interval>& doms, std::vector<IntervalVector>& boxes);
+
+	/**
+	 * Multi-threaded version of #var3BCID_slices.
+	 */
+	bool var3BCID_slices_par(IntervalVector& box, int var, int locs3b, double w_DC);
+
 	/**
 	 * Returns true iff \a box1 and \a box2 are equal, excepting the current interval (\a var )
 	 */
@@ -249,6 +283,18 @@ protected:
 	 */
 	ContractContext* context;
 
+	/**
+	 * Sub-contractors of the additional threads
+	 * (empty in sequential mode).
+	 */
+	std::vector<Ctc*> workers;
+
+	/**
+	 * The additional threads, created once by #set_parallel()
+	 * (NULL in sequential mode).
+	 */
+	ThreadPool* pool;
+
 	virtual int limitCIDDichotomy();
 };
 
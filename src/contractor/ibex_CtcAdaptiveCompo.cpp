@@ -0,0 +1,119 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcAdaptiveCompo.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CtcAdaptiveCompo.h"
+
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// relative reduction of the geometric mean of the
+// diameters, on the bounded non-degenerated components.
+double gain(const Vector& init_diam, const IntervalVector& box) {
+	if (box.is_empty()) return 1;
+
+	double r=0;
+	int k=0;
+	for (int j=0; j<box.size(); j++) {
+		double d=box[j].diam();
+		if (init_diam[j]<POS_INFINITY && init_diam[j]>0) {
+			// a degenerated component counts as a reduction by a factor e
+			r += d>0 ? ::log(d) - ::log(init_diam[j]) : -1;
+			k++;
+		}
+	}
+	return k==0 ? 0 : 1-::exp(r/k);
+}
+
+// lower bound for time measures, avoids infinite rates
+const double min_time = 1e-9;
+
+}
+
+CtcAdaptiveCompo::CtcAdaptiveCompo(const Array<Ctc>& list, int period, double min_ratio) :
+		Ctc(list), list(list), period(period), min_ratio(min_ratio), decay(default_decay),
+		nb_calls(0), _rate(list.size(),0), _nb_applied(list.size(),0) {
+	assert(check_nb_var_ctc_list(list));
+}
+
+CtcAdaptiveCompo::CtcAdaptiveCompo(Ctc& c1, Ctc& c2, int period, double min_ratio) :
+		Ctc(c1.nb_var), list(Array<Ctc>(c1,c2)), period(period), min_ratio(min_ratio), decay(default_decay),
+		nb_calls(0), _rate(2,0), _nb_applied(2,0) {
+	assert(check_nb_var_ctc_list(list));
+}
+
+CtcAdaptiveCompo::CtcAdaptiveCompo(Ctc& c1, Ctc& c2, Ctc& c3, int period, double min_ratio) :
+		Ctc(c1.nb_var), list(Array<Ctc>(c1,c2,c3)), period(period), min_ratio(min_ratio), decay(default_decay),
+		nb_calls(0), _rate(3,0), _nb_applied(3,0) {
+	assert(check_nb_var_ctc_list(list));
+}
+
+void CtcAdaptiveCompo::add_property(const IntervalVector& init_box, BoxProperties& map) {
+	for (int i=0; i<list.size(); i++)
+		list[i].add_property(init_box, map);
+}
+
+bool CtcAdaptiveCompo::selected(int i, double best_rate) const {
+	return _nb_applied[i]==0
+			|| _rate[i]>=min_ratio*best_rate
+			|| _nb_applied[i]<=2*::log((double) nb_calls);
+}
+
+void CtcAdaptiveCompo::contract(IntervalVector& box) {
+	ContractContext context(box);
+	contract(box,context);
+}
+
+void CtcAdaptiveCompo::contract(IntervalVector& box, ContractContext& context) {
+
+	nb_calls++;
+
+	bool full = period>0 && nb_calls%period==0;
+
+	double best_rate=0;
+	for (int i=0; i<list.size(); i++)
+		if (_rate[i]>best_rate) best_rate=_rate[i];
+
+	BitSet input_impact = context.impact;
+
+	context.impact.fill(0,nb_var-1);
+
+	for (int i=0; i<list.size(); i++) {
+
+		if (!full && !selected(i,best_rate)) continue;
+
+		Vector init_diam=box.diam();
+		double start=CtcProfile::wall_time();
+
+		list[i].profiled_contract(box, context);
+
+		double time=CtcProfile::wall_time()-start;
+		double r=gain(init_diam,box)/(time<min_time? min_time : time);
+
+		_rate[i] = _nb_applied[i]==0 ? r : (1-decay)*_rate[i] + decay*r;
+		_nb_applied[i]++;
+
+		if (box.is_empty()) {
+			context.output_flags.clear();
+			context.output_flags.add(FIXPOINT);
+			context.impact = input_impact;
+			return;
+		}
+	}
+
+	// since sub-contractors may be skipped, no property holds
+	context.output_flags.clear();
+
+	context.impact = input_impact;
+}
+
+} // end namespace ibex
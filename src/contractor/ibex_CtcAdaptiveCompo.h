@@ -0,0 +1,134 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcAdaptiveCompo.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_ADAPTIVE_COMPO_H__
+#define __IBEX_CTC_ADAPTIVE_COMPO_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_Array.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ * \brief Adaptive composition of contractors
+ *
+ * Same as CtcCompo except that sub-contractors that turn out to be
+ * unproductive are only applied from time to time.
+ *
+ * The productivity of a sub-contractor is measured online by its
+ * "contraction rate", that is, the gain obtained per second, where the gain
+ * in [0,1] is the relative reduction of the (geometric mean of the) diameters
+ * of the box (1 if the box is emptied). The rate is smoothed by an
+ * exponential moving average.
+ *
+ * A sub-contractor is applied if:
+ * <ul>
+ * <li> it has never been applied so far, or
+ * <li> its rate is at least #min_ratio times the best rate, or
+ * <li> it has been applied less than 2*log(t) times, where t is the number of calls
+ *      to this contractor. This is the exploration term of the UCB1 bandit policy:
+ *      a throttled sub-contractor is still applied at a logarithmic rate, so that
+ *      its rate can be updated when the search evolves.
+ * </ul>
+ * Besides, every #period calls, all the sub-contractors are applied
+ * (which guarantees a minimal pruning power).
+ */
+class CtcAdaptiveCompo : public Ctc {
+public:
+	/**
+	 * \brief Build an adaptive composition.
+	 */
+	CtcAdaptiveCompo(const Array<Ctc>& list, int period=default_period, double min_ratio=default_min_ratio);
+
+	/**
+	 * \brief Adaptive composition of c1 and c2.
+	 */
+	CtcAdaptiveCompo(Ctc& c1, Ctc& c2, int period=default_period, double min_ratio=default_min_ratio);
+
+	/**
+	 * \brief Adaptive composition of c1, c2 and c3.
+	 */
+	CtcAdaptiveCompo(Ctc& c1, Ctc& c2, Ctc& c3, int period=default_period, double min_ratio=default_min_ratio);
+
+	/**
+	 * \brief Contract a box.
+	 */
+	void contract(IntervalVector& box);
+
+	/**
+	 * \brief Contract a box.
+	 */
+	virtual void contract(IntervalVector& box, ContractContext& context);
+
+	/**
+	 * \brief Add sub-contractors properties to the map
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
+
+	/**
+	 * \brief Current contraction rate of the ith sub-contractor.
+	 */
+	double rate(int i) const;
+
+	/**
+	 * \brief Number of times the ith sub-contractor has been applied.
+	 */
+	unsigned long nb_applied(int i) const;
+
+	/** The list of sub-contractors */
+	Array<Ctc> list;
+
+	/** All sub-contractors are applied every "period" calls. */
+	int period;
+
+	/** Rate below which (relatively to the best one) a sub-contractor is throttled. */
+	double min_ratio;
+
+	/** Weight of the last measure in the moving average of the rates. */
+	double decay;
+
+	/** Default period, set to 20. */
+	static constexpr int default_period = 20;
+
+	/** Default ratio, set to 0.01. */
+	static constexpr double default_min_ratio = 0.01;
+
+	/** Default weight of the last measure, set to 0.1. */
+	static constexpr double default_decay = 0.1;
+
+protected:
+	/**
+	 * \brief Whether the ith sub-contractor has to be applied.
+	 */
+	bool selected(int i, double best_rate) const;
+
+	/** Number of calls */
+	unsigned long nb_calls;
+
+	/** Contraction rates */
+	std::vector<double> _rate;
+
+	/** Number of applications */
+	std::vector<unsigned long> _nb_applied;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline double CtcAdaptiveCompo::rate(int i) const {
+	return _rate[i];
+}
+
+inline unsigned long CtcAdaptiveCompo::nb_applied(int i) const {
+	return _nb_applied[i];
+}
+
+} // end namespace ibex
+#endif // __IBEX_CTC_ADAPTIVE_COMPO_H__
@@ -194,7 +194,7 @@ void CtcCompo::contract(IntervalVector& box, ContractContext& context) {
 
 			context.output_flags.clear();
 
-			list[i].contract(box, context);
+			list[i].profiled_contract(box, context);
 
 			if (!context.output_flags[INACTIVE]) {
 				inactive=false;
@@ -202,7 +202,7 @@ void CtcCompo::contract(IntervalVector& box, ContractContext& context) {
 				// to calculate the output flags
 			}
 		} else {
-			list[i].contract(box, context);
+			list[i].profiled_contract(box, context);
 		}
 
 		if (box.is_empty()) {
@@ -37,11 +37,14 @@ void CtcFixPoint::contract(IntervalVector& box, ContractContext& context) {
 	BitSet& flags=context.output_flags;
 
 	do {
+		// stop early (the box is valid, the fixpoint is not reached)
+		if (context.cancelled()) break;
+
 		old_box=box;
 
 		flags.clear();
 
-		ctc.contract(box,context);
+		ctc.profiled_contract(box,context);
 
 		if (box.is_empty()) {
 			flags.add(FIXPOINT);
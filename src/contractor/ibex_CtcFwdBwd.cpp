@@ -73,6 +73,15 @@ CtcFwdBwd::~CtcFwdBwd() {
 void CtcFwdBwd::init() {
 	//	input = new BitSet(ctr.f.used_vars);  // used_vars is not a bitset anymore ...
 //	output = new BitSet(ctr.f.used_vars);
+	if (ctr.local) {
+		// sparse mode: the capacity of the bitsets only
+		// covers the range of the variables used.
+		const vector<int>& vars=ctr.f.used_vars;
+		input = new BitSet((int) vars.size(), &vars[0]);
+		output = new BitSet((int) vars.size(), &vars[0]);
+		return;
+	}
+
 	input = new BitSet(nb_var);
 	output = new BitSet(nb_var);
 	
@@ -129,8 +138,28 @@ void CtcFwdBwd::contract(IntervalVector& box, ContractContext& context) {
 		return;
 	}
 
+	bool inner;
+
 	//std::cout << " hc4 of " << f << "=" << d << " with box=" << box << std::endl;
-	if (ctr.f.backward(d,box)) {
+	if (ctr.local) {
+		// sparse mode: gather the variables of the constraint,
+		// contract with the local form and scatter the result.
+		const vector<int>& vars=ctr.f.used_vars;
+		IntervalVector x((int) vars.size());
+		for (size_t i=0; i<vars.size(); i++)
+			x[i]=box[vars[i]];
+
+		inner=ctr.local->f.backward(d,x);
+
+		if (x.is_empty())
+			box.set_empty();
+		else
+			for (size_t i=0; i<vars.size(); i++)
+				box[vars[i]]=x[i];
+	} else
+		inner=ctr.f.backward(d,box);
+
+	if (inner) {
 		if (p) p->set_inactive();
 		if (sp) sp->active_ctrs().remove(ctr_num);
 		context.output_flags.add(INACTIVE);
@@ -21,6 +21,9 @@ namespace ibex {
  * \ingroup contractor
  * \brief Forward-backward contractor (HC4Revise).
  *
+ * If the constraint has a local form (see NumConstraint::set_sparse()),
+ * the contraction is performed on the variables of the constraint
+ * only, so that its cost does not depend on the size of the box.
  */
 class CtcFwdBwd: public Ctc {
 
@@ -21,22 +21,20 @@ namespace ibex {
 CtcKuhnTucker::CtcKuhnTucker(const NormalizedSystem& sys, bool reject_unbounded) : Ctc(sys.nb_var+1 /* extended box expected*/), sys(sys), reject_unbounded(reject_unbounded) {
 	try {
 		df = new Function(*sys.goal,Function::DIFF);
-
-		if (sys.nb_ctr>0) {
-			dg = new Function*[sys.f_ctrs.image_dim()];
-
-			for (int i=0; i<sys.f_ctrs.image_dim(); i++) {
-				dg[i] = new Function(sys.f_ctrs[i], Function::DIFF);
-			}
-		} else {
-			dg = NULL;
-		}
-
 	} catch(Exception&) {
 		//TODO: replace with ExprDiffException.
 		// Currently, DimException is also sometimes raised.
 		cerr << "Warning: symbolic differentiation has failed ==> KKT contractor disabled" << endl;
 		df = NULL;
+	}
+
+	if (df && sys.nb_ctr>0) {
+		// the constraints are differentiated on demand (see contract)
+		dg = new Function*[sys.f_ctrs.image_dim()];
+
+		for (int i=0; i<sys.f_ctrs.image_dim(); i++)
+			dg[i] = NULL;
+	} else {
 		dg = NULL;
 	}
 }
@@ -45,14 +43,29 @@ CtcKuhnTucker::~CtcKuhnTucker() {
 	if (df) delete df;
 	if (dg!=NULL) {
 		for (int i=0; i<sys.f_ctrs.image_dim(); i++)
-			delete dg[i];
+			if (dg[i]) delete dg[i];
 		delete[] dg;
 	}
 }
 
+bool CtcKuhnTucker::diff_active_ctrs(const BitSet& active) {
+	try {
+		for (BitSet::const_iterator c=active.begin(); c!=active.end(); ++c) {
+			if (!dg[c])
+				dg[c] = new Function(sys.f_ctrs[c], Function::DIFF);
+		}
+		return true;
+	} catch(Exception&) {
+		cerr << "Warning: symbolic differentiation has failed ==> KKT contractor disabled" << endl;
+		delete df;
+		df = NULL;
+		return false;
+	}
+}
+
 void CtcKuhnTucker::contract(IntervalVector& box) {
 
-	assert(df!=NULL);
+	if (df==NULL) return; // symbolic differentiation has failed
 
 	if (box.is_empty()) return;
 
@@ -62,7 +75,11 @@ void CtcKuhnTucker::contract(IntervalVector& box) {
 
 	IntervalVector x=box.subvector(0,n-1);
 
-	FncKuhnTucker fkkt(sys,*df,dg,x);
+	BitSet active=sys.active_ctrs(x);
+
+	if (sys.nb_ctr>0 && !diff_active_ctrs(active)) return;
+
+	FncKuhnTucker fkkt(sys,*df,dg,x,active);
 
 	if (fkkt.nb_mult==1) { // <=> no active constraint
 		// for unconstrained optimization we benefit from a cheap
@@ -32,9 +32,11 @@ public:
 	 * an "extended" box in the "contract" function (in order to be uniform with
 	 * all other contractors in optimization).
 	 *
-	 * \warning: building this object is **costly** in both time and memory!
-	 *           (symbolic derivation of all constraints, because Ibex does not
-	 *           have automatic hessian computation).
+	 * \warning: this object is **costly** in both time and memory!
+	 *           (symbolic derivation of the constraints, because Ibex does not
+	 *           have automatic hessian computation). The objective is
+	 *           differentiated here but a constraint is only differentiated
+	 *           the first time it is active in a box given to #contract.
 	 *           Don't build this contractor on-the-fly.
 	 *
 	 * \warning: sys.box should be properly set before calling this constructor.
@@ -77,9 +79,19 @@ protected:
 
 	/**
 	 * \brief Symbolic gradient of constraints.
+	 *
+	 * dg[i] is NULL until the ith constraint is differentiated.
 	 */
 	Function** dg;
 
+	/**
+	 * \brief Differentiate the active constraints that are not yet.
+	 *
+	 * \return false if the symbolic differentiation has failed (the
+	 *         contractor is then disabled).
+	 */
+	bool diff_active_ctrs(const BitSet& active);
+
 	/**
 	 * \brief Whether unbounded boxes are rejected.
 	 *
@@ -15,9 +15,14 @@ using namespace std;
 namespace ibex {
 
 CtcKuhnTuckerLP::CtcKuhnTuckerLP(const NormalizedSystem& _sys, bool reject_unbounded) : Ctc(_sys.nb_var+1 /* extended box expected*/),
-		reject_unbounded(reject_unbounded) {
+		sys(_sys), built(false), kkt(NULL), ph(NULL), reject_unbounded(reject_unbounded), _lr(NULL) {
+
+}
+
+void CtcKuhnTuckerLP::build() {
+	built = true;
 	try {
-		kkt = new KuhnTuckerSystem(_sys, true);
+		kkt = new KuhnTuckerSystem(sys, true);
 		_lr = new LinearizerXTaylor(*kkt);
 		ph = new CtcPolytopeHull(*_lr); // note: I would prefer to use CtcLinearRelax directly.
 
@@ -27,7 +32,6 @@ CtcKuhnTuckerLP::CtcKuhnTuckerLP(const NormalizedSystem& _sys, bool reject_unbou
 		cerr << "Warning: symbolic differentiation has failed ==> KKT contractor disabled" << endl;
 		kkt = NULL;
 	}
-
 }
 
 CtcKuhnTuckerLP::~CtcKuhnTuckerLP() {
@@ -39,7 +43,11 @@ CtcKuhnTuckerLP::~CtcKuhnTuckerLP() {
 }
 
 void CtcKuhnTuckerLP::contract(IntervalVector& box) {
-	if (kkt==NULL || box.is_empty()) return;
+	if (box.is_empty()) return;
+
+	if (!built) build();
+
+	if (kkt==NULL) return;
 
 	if (reject_unbounded && box.is_unbounded()) return;
 
@@ -37,15 +37,17 @@ public:
 	 * an "extended" box in the "contract" function (in order to be uniform with
 	 * all other contractors in optimization).
 	 *
-	 * \warning: building this object is **costly** in both time and memory!
+	 * \warning: this object is **costly** in both time and memory!
 	 *           (symbolic derivation of all constraints, because Ibex does not
-	 *           have automatic hessian computation).
+	 *           have automatic hessian computation). The KKT system is only
+	 *           built at the first call to #contract.
 	 *           Don't build this contractor on-the-fly.
 	 *
 	 * \warning: sys.box should be properly set before calling this constructor.
 	 *           In particular, this field **should not change** once this
 	 *           contractor is built (the box gives rise to bound constraints
 	 *           that are set once for all and not dynamically updated).
+	 *           The system must outlive this contractor.
 	 *
 	 * \param reject_unbounded: If true, the contractor does nothing when called
 	 *        on an unbounded box. This is because minima points at infinity may
@@ -71,7 +73,23 @@ public:
 protected:
 
 	/**
-	 * \brief The KKT conditions
+	 * \brief Build the KKT conditions and the polytope hull contractor.
+	 */
+	void build();
+
+	/**
+	 * \brief The (normalized) NLP problem.
+	 */
+	const NormalizedSystem& sys;
+
+	/**
+	 * \brief Whether #build has been called.
+	 */
+	bool built;
+
+	/**
+	 * \brief The KKT conditions (NULL if not built or if the
+	 *        symbolic differentiation has failed).
 	 */
 	const KuhnTuckerSystem* kkt;
 
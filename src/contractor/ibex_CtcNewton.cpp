@@ -10,11 +10,13 @@
 
 #include "ibex_CtcNewton.h"
 #include "ibex_Exception.h"
+#include "ibex_Id.h"
 
 namespace ibex {
 
 CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), vars(NULL), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+		Ctc(f.nb_var()), f(f), vars(NULL), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio),
+		cache_id(-1), reuse_ratio(BxpNewtonCache::default_reuse_ratio), reuse_jacobian(false) {
 
 	if (f.nb_var()!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
@@ -22,7 +24,8 @@ CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
 }
 
 CtcNewton::CtcNewton(const Fnc& f, const VarSet& vars, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), vars(&vars), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+		Ctc(f.nb_var()), f(f), vars(&vars), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio),
+		cache_id(-1), reuse_ratio(BxpNewtonCache::default_reuse_ratio), reuse_jacobian(false) {
 
 	if (vars.nb_var!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
@@ -34,13 +37,35 @@ void CtcNewton::contract(IntervalVector& box) {
 	contract(box,context);
 }
 
+void CtcNewton::enable_cache(double reuse_ratio, bool reuse_jacobian) {
+	if (cache_id==-1) cache_id=next_id();
+	this->reuse_ratio = reuse_ratio;
+	this->reuse_jacobian = reuse_jacobian;
+}
+
+void CtcNewton::add_property(const IntervalVector& init_box, BoxProperties& map) {
+	if (cache_id!=-1 && !map[cache_id]) {
+		int n=vars? vars->nb_var : f.nb_var();
+		map.add(new BxpNewtonCache(cache_id, n, f.nb_var()-n, reuse_ratio, reuse_jacobian));
+	}
+}
+
 void CtcNewton::contract(IntervalVector& box, ContractContext& context) {
 	if (!(box.max_diam()<=ceil)) return;
 	else {
-		if (!vars)
-			newton(f,box,prec,gauss_seidel_ratio);
-		else
-			newton(f,*vars,box,prec,gauss_seidel_ratio);
+		BxpNewtonCache* cache=cache_id==-1? NULL : (BxpNewtonCache*) context.prop[cache_id];
+
+		if (cache) {
+			if (!vars)
+				newton(f,box,*cache,prec,gauss_seidel_ratio);
+			else
+				newton(f,*vars,box,*cache,prec,gauss_seidel_ratio);
+		} else {
+			if (!vars)
+				newton(f,box,prec,gauss_seidel_ratio);
+			else
+				newton(f,*vars,box,prec,gauss_seidel_ratio);
+		}
 	}
 
 	if (box.is_empty()) {
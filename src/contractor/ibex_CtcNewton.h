@@ -53,6 +53,26 @@ public:
 
 	void contract(IntervalVector& box, ContractContext& context);
 
+	/**
+	 * \brief Reuse the Newton state from one box to the other.
+	 *
+	 * The preconditioning matrix (and optionally the Jacobian matrix) is stored
+	 * as a box property (see #ibex::BxpNewtonCache) and inherited by sub-boxes.
+	 * It is only recomputed when the current box becomes significantly smaller than
+	 * the box it was calculated with.
+	 *
+	 * This function must be called before add_property(...).
+	 *
+	 * \param reuse_ratio    - See #ibex::BxpNewtonCache::BxpNewtonCache(long, int, int, double, bool).
+	 * \param reuse_jacobian - Whether the Jacobian matrix is also reused.
+	 */
+	void enable_cache(double reuse_ratio=BxpNewtonCache::default_reuse_ratio, bool reuse_jacobian=false);
+
+	/**
+	 * \brief Add the Newton cache property, if enabled.
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
+
 	/** The function. */
 	const Fnc& f;
 
@@ -74,6 +94,15 @@ public:
 	/** Initialized to 0.01 */
 	static constexpr double default_ceil = 0.01;
 
+protected:
+	/** Identifier of the cache property (-1 if the cache is disabled) */
+	long cache_id;
+
+	/** See #enable_cache(double, bool). */
+	double reuse_ratio;
+
+	/** See #enable_cache(double, bool). */
+	bool reuse_jacobian;
 };
 
 } // end namespace ibex
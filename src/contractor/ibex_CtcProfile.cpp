@@ -0,0 +1,142 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcProfile.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CtcProfile.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// Owns the profiles (deleted at exit)
+class ProfileTable : public vector<CtcProfile*> {
+public:
+	~ProfileTable() {
+		for (iterator it=begin(); it!=end(); it++)
+			delete *it;
+	}
+};
+
+ProfileTable& table() {
+	static ProfileTable _table;
+	return _table;
+}
+
+// protects the table
+mutex table_mtx;
+
+string class_name(const type_info& type) {
+	string name=type.name();
+#ifdef __GNUG__
+	int status;
+	char* demangled=abi::__cxa_demangle(type.name(), NULL, NULL, &status);
+	if (status==0) {
+		name=demangled;
+		free(demangled);
+	}
+#endif
+	if (name.compare(0,6,"ibex::")==0) name=name.substr(6);
+	return name;
+}
+
+}
+
+bool CtcProfile::enabled = false;
+
+CtcProfile::CtcProfile(int id, const string& name) : id(id), name(name), nb_calls(0), nb_empty(0),
+		total_time(0), max_time(0), sum_log_reduction(0) {
+
+}
+
+CtcProfile* CtcProfile::create(const type_info& type) {
+	string name=class_name(type);
+	lock_guard<mutex> lock(table_mtx);
+	CtcProfile* p=new CtcProfile(table().size(), name);
+	table().push_back(p);
+	return p;
+}
+
+void CtcProfile::add_call(double time, bool empty, double log_reduction) {
+	lock_guard<mutex> lock(mtx);
+	nb_calls++;
+	total_time += time;
+	if (time>max_time) max_time=time;
+	if (empty)
+		nb_empty++;
+	else
+		sum_log_reduction += log_reduction;
+}
+
+double CtcProfile::avg_log_reduction() const {
+	return nb_calls>nb_empty? sum_log_reduction/(nb_calls-nb_empty) : 0;
+}
+
+const vector<CtcProfile*>& CtcProfile::profiles() {
+	return table();
+}
+
+void CtcProfile::clear() {
+	lock_guard<mutex> lock(table_mtx);
+	for (vector<CtcProfile*>::iterator it=table().begin(); it!=table().end(); it++) {
+		lock_guard<mutex> lock_p((*it)->mtx);
+		(*it)->nb_calls = (*it)->nb_empty = 0;
+		(*it)->total_time = (*it)->max_time = (*it)->sum_log_reduction = 0;
+	}
+}
+
+void CtcProfile::report(ostream& os) {
+	lock_guard<mutex> lock(table_mtx);
+	os << " contractor profile (wall time, inclusive):" << endl;
+	os << "   " << left << setw(5) << "#" << setw(28) << "contractor" << right
+	   << setw(12) << "calls" << setw(12) << "time (s)" << setw(12) << "max (s)"
+	   << setw(12) << "empty" << setw(14) << "log-vol red." << endl;
+
+	for (vector<CtcProfile*>::const_iterator it=table().begin(); it!=table().end(); it++) {
+		const CtcProfile& p=**it;
+		if (p.nb_calls==0) continue;
+		os << "   " << left << setw(5) << p.id << setw(28) << p.name << right
+		   << setw(12) << p.nb_calls << setw(12) << p.total_time << setw(12) << p.max_time
+		   << setw(12) << p.nb_empty << setw(14) << p.avg_log_reduction() << endl;
+	}
+	os << endl;
+}
+
+void CtcProfile::to_json(ostream& os) {
+	lock_guard<mutex> lock(table_mtx);
+	os << "[";
+	bool first=true;
+	for (vector<CtcProfile*>::const_iterator it=table().begin(); it!=table().end(); it++) {
+		const CtcProfile& p=**it;
+		if (p.nb_calls==0) continue;
+		if (!first) os << ",";
+		first=false;
+		os << "\n  {\"id\": " << p.id
+		   << ", \"name\": \"" << p.name << "\""
+		   << ", \"calls\": " << p.nb_calls
+		   << ", \"total_time\": " << p.total_time
+		   << ", \"max_time\": " << p.max_time
+		   << ", \"empty\": " << p.nb_empty
+		   << ", \"avg_log_volume_reduction\": " << p.avg_log_reduction() << "}";
+	}
+	os << "\n]" << endl;
+}
+
+double CtcProfile::wall_time() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace ibex
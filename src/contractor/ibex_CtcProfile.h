@@ -0,0 +1,142 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcProfile.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_PROFILE_H__
+#define __IBEX_CTC_PROFILE_H__
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <typeinfo>
+#include <mutex>
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ *
+ * \brief Runtime statistics of a contractor.
+ *
+ * Profiling is disabled by default. When #enabled is set to true,
+ * each contractor called through Ctc::profiled_contract(...) (which is what
+ * the solver, the optimizer and the composite contractors do) gets its own
+ * profile, created on the first call and recorded in a global table.
+ *
+ * Times are wall-clock times in seconds and are inclusive, i.e., the time
+ * of a composite contractor includes that of its sub-contractors.
+ *
+ * The global table survives the contractors (so that statistics can be
+ * displayed once the strategy is over). It can be reset with #clear().
+ *
+ * Profiles can be created and updated by several threads (e.g., the
+ * multi-threaded mode of Ctc3BCid or the parallel certification of the
+ * solver): the table and each profile are protected by a mutex.
+ */
+class CtcProfile {
+public:
+
+	/**
+	 * \brief Create a new profile and record it in the global table.
+	 *
+	 * \param type - The dynamic type of the contractor (used for naming).
+	 */
+	static CtcProfile* create(const std::type_info& type);
+
+	/**
+	 * \brief Record a call (thread-safe).
+	 *
+	 * \param time          - wall time of the call.
+	 * \param empty         - whether the box has been emptied.
+	 * \param log_reduction - the decrease of the log-volume of the box
+	 *                        (ignored if the box has been emptied).
+	 */
+	void add_call(double time, bool empty, double log_reduction);
+
+	/**
+	 * \brief Average log-volume reduction.
+	 *
+	 * Calculated on the calls that have not emptied the box.
+	 */
+	double avg_log_reduction() const;
+
+	/**
+	 * \brief Number (in the global table) of this profile.
+	 */
+	const int id;
+
+	/**
+	 * \brief Name of the contractor class.
+	 */
+	const std::string name;
+
+	/**
+	 * \brief Number of calls.
+	 */
+	unsigned long nb_calls;
+
+	/**
+	 * \brief Number of calls that have emptied the box.
+	 */
+	unsigned long nb_empty;
+
+	/**
+	 * \brief Cumulative wall time.
+	 */
+	double total_time;
+
+	/**
+	 * \brief Maximal wall time of a single call.
+	 */
+	double max_time;
+
+	/**
+	 * \brief Sum of the log-volume reductions.
+	 */
+	double sum_log_reduction;
+
+	/**
+	 * \brief Whether profiling is enabled (false by default).
+	 */
+	static bool enabled;
+
+	/**
+	 * \brief All the profiles created so far.
+	 */
+	static const std::vector<CtcProfile*>& profiles();
+
+	/**
+	 * \brief Reset all the statistics.
+	 */
+	static void clear();
+
+	/**
+	 * \brief Display the statistics of all the (called) contractors.
+	 */
+	static void report(std::ostream& os);
+
+	/**
+	 * \brief Write the statistics of all the contractors in JSON format.
+	 */
+	static void to_json(std::ostream& os);
+
+	/**
+	 * \brief Current wall time (in seconds, from an arbitrary origin).
+	 */
+	static double wall_time();
+
+private:
+	CtcProfile(int id, const std::string& name);
+	CtcProfile(const CtcProfile&); // forbidden
+
+	// protects the statistics
+	std::mutex mtx;
+};
+
+} // namespace ibex
+
+#endif // __IBEX_CTC_PROFILE_H__
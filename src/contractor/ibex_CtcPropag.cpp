@@ -19,16 +19,32 @@ namespace ibex {
 
 CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 		  Ctc(cl), list(cl), ratio(ratio), incremental(incremental),
-		  accumulate(false), g(cl.size(), nb_var), agenda(cl.size()),
-		  active(BitSet::empty(cl.size())) {
+		  accumulate(false), prioritized(false), cost(cl.size()), g(cl.size(), nb_var), agenda(cl.size()),
+		  pagenda(cl.size()), active(BitSet::empty(cl.size())) {
 
 	assert(check_nb_var_ctc_list(cl));
 
-	for (int i=0; i<list.size(); i++)
-		for (int j=0; j<nb_var; j++) {
-			if (list[i].input && (*list[i].input)[j]) g.add_arc(i,j,true);
-			if (list[i].input && (*list[i].output)[j]) g.add_arc(i,j,false);
+	// Note: only the elements of the input/output bitsets are
+	// visited. This avoids a quadratic loop on large sparse
+	// systems (and the bitsets may only cover the variables
+	// of the sub-contractor, see CtcFwdBwd).
+	for (int i=0; i<list.size(); i++) {
+		if (!list[i].input) continue;
+		int j=0;
+		for (int k=0; k<list[i].input->size(); k++) {
+			j=(k==0? list[i].input->min() : list[i].input->next(j));
+			g.add_arc(i,j,true);
+		}
+		for (int k=0; k<list[i].output->size(); k++) {
+			j=(k==0? list[i].output->min() : list[i].output->next(j));
+			g.add_arc(i,j,false);
 		}
+	}
+
+	for (int i=0; i<list.size(); i++) {
+		int n=g.input_vars(i).size();
+		cost[i] = n>0 ? n : 1;
+	}
 
 	//cout << g << endl;
 }
@@ -47,6 +63,11 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 
 	assert(box.size()==nb_var);
 
+	if (prioritized) {
+		contract_prioritized(box, context);
+		return;
+	}
+
 	if (incremental) {
 		/**
 		 * Note: when context.impact() is NULL, we can
@@ -59,8 +80,8 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 
 		for (int i=0; i<nb_var; i++) {
 			if (context.impact[i]) {
-				set<int> ctrs=g.output_ctrs(i);
-				for (set<int>::iterator c=ctrs.begin(); c!=ctrs.end(); c++)
+				const set<int>& ctrs=g.output_ctrs(i);
+				for (set<int>::const_iterator c=ctrs.begin(); c!=ctrs.end(); c++)
 					agenda.push(*c);
 			}
 		}
@@ -105,14 +126,22 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 	//cout << "=========== Start propagation ==========" << endl;
 	while (!agenda.empty()) {
 
+		if (context.cancelled()) {
+			// stop early: the box is valid but the propagation
+			// is incomplete (the contractors remain active).
+			agenda.flush();
+			active.fill(0,list.size()-1);
+			break;
+		}
+
 		agenda.pop(c);
 
-		set<int> vars=g.output_vars(c);
+		const set<int>& vars=g.output_vars(c);
 
 		// ===================== fine propagation =========================
 		// reset the old box to the current domains just before contraction
 		if (!accumulate) {
-			for (set<int>::iterator v=vars.begin(); v!=vars.end(); v++) {
+			for (set<int>::const_iterator v=vars.begin(); v!=vars.end(); v++) {
 				old_box[*v] = box[*v];
 			}
 		}
@@ -135,13 +164,13 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 			active.remove(c);
 		}
 
-		for (set<int>::iterator it=vars.begin(); it!=vars.end(); it++) {
+		for (set<int>::const_iterator it=vars.begin(); it!=vars.end(); it++) {
 			int v=*it;
 			//cout << "   " << old_box[v] << " % " << box[v] << "   " << old_box[v].ratiodelta(box[v]) << endl;
 			//if (old_box[v].rel_distance(box[v])>=ratio) {
 			if (old_box[v].ratiodelta(box[v])>=ratio) {
-				set<int> ctrs=g.output_ctrs(v);
-				for (set<int>::iterator c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
+				const set<int>& ctrs=g.output_ctrs(v);
+				for (set<int>::const_iterator c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
 					if ((c!=*c2 && active[*c2]) || (c==*c2 && !context.output_flags[FIXPOINT]))
 						agenda.push(*c2);
 				}
@@ -173,4 +202,102 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 		context.output_flags.add(INACTIVE);
 }
 
+void CtcPropag::contract_prioritized(IntervalVector& box, ContractContext& context) {
+
+	// see contract(...) for comments on the algorithm.
+
+	if (impacts.empty()) // only allocated in priority-driven mode
+		impacts.resize(list.size(), BitSet::empty(nb_var));
+
+	if (incremental) {
+		for (int i=0; i<nb_var; i++) {
+			if (context.impact[i]) {
+				set<int> ctrs=g.output_ctrs(i);
+				for (set<int>::iterator c=ctrs.begin(); c!=ctrs.end(); c++) {
+					pagenda.push(*c, 1.0/cost[*c]);
+					impacts[*c].add(i);
+				}
+			}
+		}
+	} else {
+		for (int i=0; i<list.size(); i++) {
+			pagenda.push(i, 1.0/cost[i]);
+			impacts[i].fill(0,nb_var-1);
+		}
+	}
+
+	BitSet input_impact(context.impact);
+
+	active.fill(0,list.size()-1);
+
+	int c;
+
+	IntervalVector old_box(box);
+
+	while (!pagenda.empty()) {
+
+		if (context.cancelled()) { // see contract(...)
+			pagenda.flush();
+			for (int i=0; i<list.size(); i++)
+				impacts[i].clear();
+			active.fill(0,list.size()-1);
+			break;
+		}
+
+		pagenda.pop(c);
+
+		const set<int>& vars=g.output_vars(c);
+
+		if (!accumulate) {
+			for (set<int>::const_iterator v=vars.begin(); v!=vars.end(); v++) {
+				old_box[*v] = box[*v];
+			}
+		}
+
+		// "fine" propagation: only the variables reduced
+		// since c has been queued are impacted.
+		context.impact = impacts[c];
+		impacts[c].clear();
+
+		context.output_flags.clear();
+
+		list[c].contract(box, context);
+
+		if (box.is_empty()) {
+			pagenda.flush();
+			for (int i=0; i<list.size(); i++)
+				impacts[i].clear();
+			context.impact = input_impact;
+			return;
+		}
+
+		if (context.output_flags[INACTIVE]) {
+			active.remove(c);
+		}
+
+		for (set<int>::const_iterator it=vars.begin(); it!=vars.end(); it++) {
+			int v=*it;
+			double delta=old_box[v].ratiodelta(box[v]);
+			if (delta>=ratio) {
+				const set<int>& ctrs=g.output_ctrs(v);
+				for (set<int>::const_iterator c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
+					if ((c!=*c2 && active[*c2]) || (c==*c2 && !context.output_flags[FIXPOINT])) {
+						pagenda.push(*c2, delta/cost[*c2]);
+						impacts[*c2].add(v);
+					}
+				}
+				if (accumulate)
+					old_box[v] = box[v];
+			}
+		}
+	}
+
+	context.output_flags.clear();
+
+	context.impact = input_impact;
+
+	if (active.empty())
+		context.output_flags.add(INACTIVE);
+}
+
 } // namespace ibex
@@ -13,10 +13,13 @@
 #define __IBEX_CTC_PROPAG_H__
 
 #include "ibex_Agenda.h"
+#include "ibex_PriorityAgenda.h"
 #include "ibex_Ctc.h"
 #include "ibex_DirectedHyperGraph.h"
 #include "ibex_Array.h"
 
+#include <vector>
+
 namespace ibex {
 
 /**
@@ -81,15 +84,45 @@ public:
 	/** Accumulate residual contractions? */
 	bool accumulate;
 
+	/**
+	 * \brief Priority-driven propagation?
+	 *
+	 * If true, the agenda is a priority queue instead of a FIFO. The priority of
+	 * a sub-contractor is the expected gain of calling it, namely, the sum of the
+	 * relative reductions of its impacting variables (since it has been queued)
+	 * divided by its #cost. Moreover, each sub-contractor is given as "impact"
+	 * the variables that have actually been reduced (instead of all the variables).
+	 *
+	 * False by default.
+	 */
+	bool prioritized;
+
+	/**
+	 * \brief Estimated cost of each sub-contractor.
+	 *
+	 * Only used in priority-driven propagation.
+	 * By default, the number of input variables of the sub-contractor.
+	 */
+	std::vector<double> cost;
+
 	/** Default ratio used by propagation, set to 0.1. */
 	static constexpr double default_ratio = 0.01;
 
 protected:
 
+	/**
+	 * \brief Priority-driven propagation (see #prioritized).
+	 */
+	void contract_prioritized(IntervalVector& box, ContractContext& context);
+
 	DirectedHyperGraph g; // constraint network (hypergraph)
 
 	Agenda agenda;        // propagation agenda
 
+	PriorityAgenda pagenda; // propagation agenda (priority-driven mode)
+
+	std::vector<BitSet> impacts; // variables impacted since each sub-contractor has been queued (priority-driven mode)
+
 	BitSet active;      // mark active sub-contractors
 
 
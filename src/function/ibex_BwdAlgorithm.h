@@ -44,6 +44,14 @@ protected:
 	/** TO BE DEFINED (by the subclass) */
 	void chi_bwd(  int a, int b, int c, int y);
 
+	/**
+	 * TO BE DEFINED (by the subclass)
+	 *
+	 * Sum of n scalars x[0]+/-x[1]+/-...+/-x[n-1], calculated from left to
+	 * right (neg[k] is true if x[k] is subtracted).
+	 */
+	void sum_bwd(int* x, int n, const bool* neg, int y);
+
 	/*==================== binary operators =========================*/
 	/** TO BE DEFINED (by the subclass) */
 	void gen2_bwd(int x, int y);
@@ -78,6 +86,14 @@ protected:
 	/** TO BE DEFINED (by the subclass) */
 	void mul_MM_bwd(int x1, int x2, int y);
 
+	/**
+	 * TO BE DEFINED (by the subclass)
+	 *
+	 * Product of a constant matrix by a vector (the
+	 * constant must be read from the node x1).
+	 */
+	void mul_CV_bwd(int x1, int x2, int y);
+
 	/** TO BE DEFINED (by the subclass) */
 	void sub_bwd(int x1, int x2, int y);
 
@@ -19,7 +19,7 @@ using namespace std;
 
 namespace ibex {
 
-CompiledFunction::CompiledFunction() : n(0), n_total(0), nodes(NULL), code(NULL), nb_args(NULL), args(NULL), ptr(-1) {
+CompiledFunction::CompiledFunction() : n(0), n_total(0), nodes(NULL), code(NULL), nb_args(NULL), args(NULL), neg(NULL), ptr(-1) {
 
 }
 
@@ -32,10 +32,14 @@ void CompiledFunction::compile(Function& f) {
 	code=new operation[n];
 	args=new int*[n];
 	nb_args=new int[n];
+	neg=new bool*[n];
 
 	for (ptr=n-1; ptr>=0; ptr--) {
+		neg[ptr]=NULL;
 		(*nodes)[ptr].acceptVisitor(*this);
 	}
+
+	optimize();
 	//cout << f.name << " : n=" << n << " nb_args[" << 0 << "]=" << nb_args[0] << endl;
 }
 
@@ -43,11 +47,80 @@ CompiledFunction::~CompiledFunction() {
 	if (code==NULL) return; // not compiled
 
 	delete[] code;
-	for (int i=0; i<n; i++) delete[] args[i];
+	for (int i=0; i<n; i++) {
+		delete[] args[i];
+		delete[] neg[i];
+	}
 	delete[] args;
+	delete[] neg;
 	delete[] nb_args;
 }
 
+void CompiledFunction::optimize() {
+
+	// number of fathers of each node
+	vector<int> nb_fathers(n,0);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<nb_args[i]; j++)
+			nb_fathers[args[i][j]]++;
+
+	vector<int> terms;
+	vector<bool> sub;
+
+	// fathers are visited before their sons
+	for (int i=0; i<n; i++) {
+		switch (code[i]) {
+		case MUL:
+			if (args[i][0]==args[i][1]) {
+				code[i]=SQR;
+				nb_args[i]=1;
+			}
+			break;
+		case MUL_MV:
+			if (code[args[i][0]]==CST) {
+				code[i]=MUL_CV;
+				if (nb_fathers[args[i][0]]==1)
+					code[args[i][0]]=FUSED;
+			}
+			break;
+		case ADD:
+		case SUB: {
+			// Follow the chain of left operands that are additions/subtractions
+			// only used here. Terms are collected from the last one.
+			terms.clear();
+			sub.clear();
+			int k=i;
+			while (true) {
+				terms.push_back(args[k][1]);
+				sub.push_back(code[k]==SUB);
+				if (k!=i) code[k]=FUSED;
+				int l=args[k][0];
+				if ((code[l]!=ADD && code[l]!=SUB) || nb_fathers[l]>1) break;
+				k=l;
+			}
+			if (k==i) break; // a single binary operation
+
+			terms.push_back(args[k][0]);
+			sub.push_back(false);
+
+			int m=(int) terms.size();
+			code[i]=SUM;
+			nb_args[i]=m;
+			delete[] args[i];
+			args[i]=new int[m];
+			neg[i]=new bool[m];
+			for (int j=0; j<m; j++) {
+				args[i][j]=terms[m-1-j];
+				neg[i][j]=sub[m-1-j];
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+}
+
 Agenda* CompiledFunction::agenda(int rank) const {
 	ExprSubNodes rank_nodes((*nodes)[rank]);
 	Agenda* a=new Agenda(n);
@@ -220,9 +293,11 @@ const char* CompiledFunction::op(operation o) const {
 	case SYM:    return "symbl";
 	case APPLY:  return "apply";
 	case CHI:    return "chi";
+	case SUM:    return "sum";
+	case FUSED:  return "(fused)";
 	case ADD: case ADD_V: case ADD_M:
 		         return "+";
-	case MUL: case MUL_SV: case MUL_SM: case MUL_VV: case MUL_MV: case MUL_MM:  case MUL_VM:
+	case MUL: case MUL_SV: case MUL_SM: case MUL_VV: case MUL_MV: case MUL_MM:  case MUL_VM: case MUL_CV:
 		         return "*";
 	case GEN1:   return "(gen-1)";
 	case MINUS: case MINUS_V: case MINUS_M:
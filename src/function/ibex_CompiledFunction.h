@@ -31,6 +31,22 @@ class ExprData;
  * \ingroup symbolic
  * \brief A low-level representation of a function for speeding up forward/backward algorithms.
  *
+ * Each node of the DAG is translated into an operation code. The code
+ * is then optimized by a peephole pass (see #optimize()):
+ * <ul>
+ * <li> a product x*x of a node by itself is replaced by sqr(x), which is
+ *      both faster and sharper;
+ * <li> a chain of scalar additions/subtractions ((x0+x1)-x2)+... is fused
+ *      into a single SUM operation when the intermediate results are not
+ *      used elsewhere. The operations are performed in the same order, so
+ *      that the result is the same as with the binary operations;
+ * <li> a product of a constant matrix by a vector is replaced by a MUL_CV
+ *      operation. The constant is read directly from the node (it is not
+ *      copied at each evaluation if the product is its only use) and it is
+ *      not differentiated.
+ * </ul>
+ * The nodes that are computed by a fused operation have the code FUSED:
+ * their domain is not calculated.
  */
 class CompiledFunction : public ExprVisitor {
 public:
@@ -93,6 +109,8 @@ protected:
 		IDX,    // index with reference
 		IDX_CP, // index with copy
 		VEC, SYM, CST, APPLY, CHI,
+		SUM,    // fused sum of scalars
+		FUSED,  // node calculated by a fused operation
 		ADD, MUL, SUB, DIV, MAX, MIN, ATAN2,
 		GEN1, GEN2, GENN,
 		MINUS, MINUS_V, MINUS_M,
@@ -103,7 +121,8 @@ protected:
 		FLOOR,  CEIL, SAW,
 
 		ADD_V, ADD_M, SUB_V, SUB_M,
-		MUL_SV, MUL_SM, MUL_VV, MUL_MV, MUL_MM, MUL_VM
+		MUL_SV, MUL_SM, MUL_VV, MUL_MV, MUL_MM, MUL_VM,
+		MUL_CV  // constant matrix times vector
 	} operation;
 
 private:
@@ -167,6 +186,11 @@ private:
 	template<class V>
 	void backward(const V& algo, int i) const;
 
+	/*
+	 * Peephole optimization of the code (called by compile).
+	 */
+	void optimize();
+
 	friend std::ostream& operator<<(std::ostream& os, const CompiledFunction& data);
 
 	const char* op(operation o) const;
@@ -183,6 +207,10 @@ private:
 
 	mutable int** args;
 
+	// For a SUM operation, neg[i][j] is true if the
+	// jth term is subtracted (NULL for other operations)
+	bool** neg;
+
 	// Node counter in Polish prefix notation
 	// (only useful during construction)
 	mutable int ptr;
@@ -218,6 +246,8 @@ void CompiledFunction::forward(const V& algo, int i) const {
 	case CST:    ((V&) algo).cst_fwd    (i); break;
 	case APPLY:  ((V&) algo).apply_fwd  (args[i],i); break;
 	case CHI:    ((V&) algo).chi_fwd    (args[i][0], args[i][1], args[i][2], i); break;
+	case SUM:    ((V&) algo).sum_fwd    (args[i], nb_args[i], neg[i], i); break;
+	case FUSED:  break;
 	case GEN2:   ((V&) algo).gen2_fwd   (args[i][0], args[i][1], i); break;
 	case ADD:    ((V&) algo).add_fwd    (args[i][0], args[i][1], i); break;
 	case ADD_V:  ((V&) algo).add_V_fwd  (args[i][0], args[i][1], i); break;
@@ -229,6 +259,7 @@ void CompiledFunction::forward(const V& algo, int i) const {
 	case MUL_MV: ((V&) algo).mul_MV_fwd (args[i][0], args[i][1], i); break;
 	case MUL_MM: ((V&) algo).mul_MM_fwd (args[i][0], args[i][1], i); break;
 	case MUL_VM: ((V&) algo).mul_VM_fwd (args[i][0], args[i][1], i); break;
+	case MUL_CV: ((V&) algo).mul_CV_fwd (args[i][0], args[i][1], i); break;
 	case SUB:    ((V&) algo).sub_fwd    (args[i][0], args[i][1], i); break;
 	case SUB_V:  ((V&) algo).sub_V_fwd  (args[i][0], args[i][1], i); break;
 	case SUB_M:  ((V&) algo).sub_M_fwd  (args[i][0], args[i][1], i); break;
@@ -298,6 +329,8 @@ void CompiledFunction::backward(const V& algo, int i) const {
 	case CST:    ((V&) algo).cst_bwd    (i); break;
 	case APPLY:  ((V&) algo).apply_bwd  (args[i], i); break;
 	case CHI:    ((V&) algo).chi_bwd    (args[i][0], args[i][1], args[i][2], i); break;
+	case SUM:    ((V&) algo).sum_bwd    (args[i], nb_args[i], neg[i], i); break;
+	case FUSED:  break;
 	case GEN2:   ((V&) algo).gen2_bwd   (args[i][0], args[i][1], i); break;
 	case ADD:    ((V&) algo).add_bwd    (args[i][0], args[i][1], i); break;
 	case ADD_V:  ((V&) algo).add_V_bwd  (args[i][0], args[i][1], i); break;
@@ -309,6 +342,7 @@ void CompiledFunction::backward(const V& algo, int i) const {
 	case MUL_MV: ((V&) algo).mul_MV_bwd (args[i][0], args[i][1], i); break;
 	case MUL_MM: ((V&) algo).mul_MM_bwd (args[i][0], args[i][1], i); break;
 	case MUL_VM: ((V&) algo).mul_VM_bwd (args[i][0], args[i][1], i); break;
+	case MUL_CV: ((V&) algo).mul_CV_bwd (args[i][0], args[i][1], i); break;
 	case SUB:    ((V&) algo).sub_bwd    (args[i][0], args[i][1], i); break;
 	case SUB_V:  ((V&) algo).sub_V_bwd  (args[i][0], args[i][1], i); break;
 	case SUB_M:  ((V&) algo).sub_M_bwd  (args[i][0], args[i][1], i); break;
@@ -30,8 +30,8 @@ Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL), matrix
 			fwd_agenda = new Agenda*[m];
 			bwd_agenda = new Agenda*[m];
 			for (int i=0; i<m; i++) {
-				bwd_agenda[i] = f.cf.agenda(f.nodes.rank(vec->arg(i)));
-				fwd_agenda[i] = new Agenda(*bwd_agenda[i],true); // true<=>swap
+				bwd_agenda[i] = NULL; // see component_fwd_agenda
+				fwd_agenda[i] = NULL;
 			}
 
 			if (dim.is_matrix()) {
@@ -51,12 +51,11 @@ Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL), matrix
 					matrix_fwd_agenda = new Agenda**[m];
 					matrix_bwd_agenda = new Agenda**[m];
 					for (int i=0; i<m; i++) {
-						const ExprVector& fi=(const ExprVector&) vec->arg(i);
 						matrix_fwd_agenda[i] = new Agenda*[n];
 						matrix_bwd_agenda[i] = new Agenda*[n];
 						for (int j=0; j<n; j++) {
-							matrix_bwd_agenda[i][j] = f.cf.agenda(f.nodes.rank(fi.arg(j)));
-							matrix_fwd_agenda[i][j] = new Agenda(*matrix_bwd_agenda[i][j],true); // true<=>swap
+							matrix_bwd_agenda[i][j] = NULL; // see element_fwd_agenda
+							matrix_fwd_agenda[i][j] = NULL;
 						}
 					}
 				}
@@ -131,6 +130,16 @@ Domain& Eval::eval(const IntervalVector& box) {
 	return *d.top;
 }
 
+Domain& Eval::eval() {
+
+	try {
+		f.forward<Eval>(*this);
+	} catch(EmptyBoxException&) {
+		d.top->set_empty();
+	}
+	return *d.top;
+}
+
 Domain Eval::eval(const IntervalVector& box, const BitSet& components) {
 
 	Dim dim=d.top->dim;
@@ -170,14 +179,14 @@ Domain Eval::eval(const IntervalVector& box, const BitSet& components) {
 	// merge all the agendas
 	Agenda a(f.nodes.size()); // the global agenda initialized with the maximal possible value
 	for (BitSet::const_iterator c=components.begin(); c!=components.end(); ++c) {
-		a.push(*(fwd_agenda[c]));
+		a.push(component_fwd_agenda(c));
 	}
 
 	try {
 		f.cf.forward<Eval>(*this,a);
 		int i=0;
 		for (BitSet::const_iterator c=components.begin(); c!=components.end(); ++c) {
-			res[i++] = d[bwd_agenda[c]->first()];
+			res[i++] = d[component_bwd_agenda(c).first()];
 		}
 	} catch(EmptyBoxException&) {
 		d.top->set_empty();
@@ -238,7 +247,7 @@ Domain Eval::eval(const IntervalVector& box, const BitSet& rows, const BitSet& c
 	Agenda a(f.nodes.size()); // the global agenda initialized with the maximal possible value
 	for (BitSet::const_iterator r=rows.begin(); r!=rows.end(); ++r) {
 		for (BitSet::const_iterator c=cols.begin(); c!=cols.end(); ++c) {
-			a.push(*(matrix_fwd_agenda[r][c]));
+			a.push(element_fwd_agenda(r,c));
 		}
 	}
 
@@ -248,7 +257,7 @@ Domain Eval::eval(const IntervalVector& box, const BitSet& rows, const BitSet& c
 		for (BitSet::const_iterator r=rows.begin(); r!=rows.end(); ++r, i++) {
 			int j=0;
 			for (BitSet::const_iterator c=cols.begin(); c!=cols.end(); ++c, j++) {
-				res[i][j] = d[matrix_bwd_agenda[r][c]->first()];
+				res[i][j] = d[element_bwd_agenda(r,c).first()];
 			}
 		}
 	} catch(EmptyBoxException&) {
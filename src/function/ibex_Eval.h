@@ -55,6 +55,14 @@ public:
 	 */
 	Domain& eval(const IntervalVector& box);
 
+	/**
+	 * \brief Run the forward algorithm with the current domains of the arguments.
+	 *
+	 * The domains of the arguments (see #d) must be set by the caller
+	 * (only those of the used variables are read).
+	 */
+	Domain& eval();
+
 	/**
 	 * \brief Evaluate a subset of components.
 	 *
@@ -91,6 +99,7 @@ public: // because called from CompiledFunction
 	inline void symbol_fwd (int y);
 	inline void cst_fwd    (int y);
 	inline void chi_fwd    (int x1, int x2, int x3, int y);
+	inline void sum_fwd    (int* x, int n, const bool* neg, int y);
 	inline void gen2_fwd   (int x, int x2, int y);
 	inline void add_fwd    (int x1, int x2, int y);
 	inline void mul_fwd    (int x1, int x2, int y);
@@ -135,11 +144,28 @@ public: // because called from CompiledFunction
 	inline void mul_MV_fwd (int x1, int x2, int y);
 	inline void mul_VM_fwd (int x1, int x2, int y);
 	inline void mul_MM_fwd (int x1, int x2, int y);
+	inline void mul_CV_fwd (int x1, int x2, int y);
 	inline void sub_V_fwd  (int x1, int x2, int y);
 	inline void sub_M_fwd  (int x1, int x2, int y);
 
+	/*
+	 * Agendas of the ith vector component/matrix row.
+	 * Only valid if fwd_agenda!=NULL. Built at the first call.
+	 */
+	const Agenda& component_fwd_agenda(int i);
+	const Agenda& component_bwd_agenda(int i);
+
+	/*
+	 * Agendas of the matrix element (i,j).
+	 * Only valid if matrix_fwd_agenda!=NULL. Built at the first call.
+	 */
+	const Agenda& element_fwd_agenda(int i, int j);
+	const Agenda& element_bwd_agenda(int i, int j);
+
 	Function& f;
 	ExprDomain d;
+	// Note: an agenda has the size of the whole DAG, so the agendas of
+	// the components are only built when required (NULL before).
 	Agenda** fwd_agenda;         // one agenda for each vector component/matrix row
 	Agenda** bwd_agenda;         // one agenda for each vector component/matrix row
 	Agenda*** matrix_fwd_agenda; // one agenda for each matrix element
@@ -150,6 +176,34 @@ public: // because called from CompiledFunction
  	 	 	 	 	 	 	 implementation
   ============================================================================*/
 
+inline const Agenda& Eval::component_fwd_agenda(int i) {
+	if (!fwd_agenda[i]) {
+		const ExprVector& vec=(const ExprVector&) f.expr();
+		bwd_agenda[i] = f.cf.agenda(f.nodes.rank(vec.arg(i)));
+		fwd_agenda[i] = new Agenda(*bwd_agenda[i],true); // true<=>swap
+	}
+	return *fwd_agenda[i];
+}
+
+inline const Agenda& Eval::component_bwd_agenda(int i) {
+	if (!bwd_agenda[i]) component_fwd_agenda(i);
+	return *bwd_agenda[i];
+}
+
+inline const Agenda& Eval::element_fwd_agenda(int i, int j) {
+	if (!matrix_fwd_agenda[i][j]) {
+		const ExprVector& fi=(const ExprVector&) ((const ExprVector&) f.expr()).arg(i);
+		matrix_bwd_agenda[i][j] = f.cf.agenda(f.nodes.rank(fi.arg(j)));
+		matrix_fwd_agenda[i][j] = new Agenda(*matrix_bwd_agenda[i][j],true); // true<=>swap
+	}
+	return *matrix_fwd_agenda[i][j];
+}
+
+inline const Agenda& Eval::element_bwd_agenda(int i, int j) {
+	if (!matrix_bwd_agenda[i][j]) element_fwd_agenda(i,j);
+	return *matrix_bwd_agenda[i][j];
+}
+
 inline void Eval::idx_fwd(int, int) { /* nothing to do */ }
 
 inline void Eval::symbol_fwd(int) { /* nothing to do */ }
@@ -166,6 +220,16 @@ inline void Eval::cst_fwd(int y) {
 
 inline void Eval::chi_fwd(int x1, int x2, int x3, int y) { d[y].i() = chi(d[x1].i(),d[x2].i(),d[x3].i()); }
 inline void Eval::add_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()+d[x2].i(); }
+
+inline void Eval::sum_fwd(int* x, int n, const bool* neg, int y) {
+	Interval s=d[x[0]].i();
+	for (int k=1; k<n; k++) {
+		if (neg[k]) s=s-d[x[k]].i();
+		else s=s+d[x[k]].i();
+	}
+	d[y].i()=s;
+}
+
 inline void Eval::mul_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()*d[x2].i(); }
 inline void Eval::sub_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()-d[x2].i(); }
 inline void Eval::div_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()/d[x2].i(); }
@@ -209,6 +273,7 @@ inline void Eval::mul_VV_fwd(int x1, int x2, int y){ d[y].i()=d[x1].v()*d[x2].v(
 inline void Eval::mul_MV_fwd(int x1, int x2, int y){ d[y].v()=d[x1].m()*d[x2].v(); }
 inline void Eval::mul_VM_fwd(int x1, int x2, int y){ d[y].v()=d[x1].v()*d[x2].m(); }
 inline void Eval::mul_MM_fwd(int x1, int x2, int y){ d[y].m()=d[x1].m()*d[x2].m(); }
+inline void Eval::mul_CV_fwd(int x1, int x2, int y){ d[y].v()=((const ExprConstant&) f.node(x1)).get_matrix_value()*d[x2].v(); }
 inline void Eval::sub_V_fwd(int x1, int x2, int y) { d[y].v()=d[x1].v()-d[x2].v(); }
 inline void Eval::sub_M_fwd(int x1, int x2, int y) { d[y].m()=d[x1].m()-d[x2].m(); }
 
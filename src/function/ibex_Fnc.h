@@ -320,6 +320,12 @@ inline void Fnc::gradient(const IntervalVector& x, IntervalVector& g) const {
 	g=IntervalVector(_image_dim.vec_size());
 }
 
+inline IntervalVector Fnc::gradient(const IntervalVector& x) const {
+	IntervalVector g(x.size());
+	gradient(x,g);
+	return g;
+}
+
 inline IntervalMatrix Fnc::jacobian(const IntervalVector& x, int v) const {
 	IntervalMatrix J(image_dim(),x.size());
 	jacobian(x,J,v);
@@ -23,11 +23,12 @@ namespace ibex {
 Function::~Function() {
 
 	// note: destructor of Eval requires *this
+	// (the other evaluators are built from _eval)
 	if (_eval!=NULL) {
+		if (_hc4revise) delete _hc4revise;
+		if (_grad) delete _grad;
+		if (_inhc4revise) delete _inhc4revise;
 		delete _eval;
-		delete _hc4revise;
-		delete _grad;
-		delete _inhc4revise;
 	}
 
 	if (comp!=NULL) {
@@ -197,7 +198,7 @@ IntervalMatrix Function::eval_matrix(const IntervalVector& box) const {
 		M.set_col(0,eval_vector(box));
 		break;
 	case Dim::MATRIX:
-		M=((Function*) this)->_eval->eval(box).m();
+		M=basic_evaluator().eval(box).m();
 		break;
 	default :
 		throw std::logic_error("Function::eval_matrix: invalid Dim type");
@@ -224,9 +225,9 @@ IntervalMatrix Function::eval_matrix(const IntervalVector& box, const BitSet& ro
 		break;
 	case Dim::MATRIX:
 		if (rows.size()==1)
-			M.set_row(0,((Function*) this)->_eval->eval(box,rows).v());
+			M.set_row(0,basic_evaluator().eval(box,rows).v());
 		else
-			M=((Function*) this)->_eval->eval(box,rows).m();
+			M=basic_evaluator().eval(box,rows).m();
 		break;
 	default :
 		throw std::logic_error("Function::eval_matrix: invalid Dim type");
@@ -256,14 +257,14 @@ IntervalMatrix Function::eval_matrix(const IntervalVector& box, const BitSet& ro
 	case Dim::MATRIX:
 		if (rows.size()==1)
 			if (cols.size()==1)
-				M[0][0]=((Function*) this)->_eval->eval(box,rows,cols).i();
+				M[0][0]=basic_evaluator().eval(box,rows,cols).i();
 			else
-				M.set_row(0,((Function*) this)->_eval->eval(box,rows,cols).v());
+				M.set_row(0,basic_evaluator().eval(box,rows,cols).v());
 		else
 			if (cols.size()==1)
-				M.set_col(0,((Function*) this)->_eval->eval(box,rows,cols).v());
+				M.set_col(0,basic_evaluator().eval(box,rows,cols).v());
 			else
-		        M=((Function*) this)->_eval->eval(box,rows,cols).m();
+		        M=basic_evaluator().eval(box,rows,cols).m();
 		break;
 	default :
 		throw std::logic_error("Function::eval_matrix: invalid Dim type");
@@ -900,6 +900,7 @@ protected:
 
 private:
 	friend class VarSet;
+	friend class SystemBinary; // for saving/loading df
 
 	void build_from_string(const Array<const char*>& x, const char* y, const char* name=NULL);
 
@@ -932,6 +933,10 @@ private:
 	// point to this field (instead of being a copy)
 	Function *zero;
 
+	// The evaluators are built at the first call (they all allocate
+	// domains for the whole DAG, so that the ones that are never used,
+	// e.g., the gradient of a constraint of a large system, would
+	// otherwise cost a lot of memory).
 	Eval *_eval;
 	HC4Revise *_hc4revise;
 	// TODO: actually never used if f is vector/matrix valued
@@ -1007,15 +1012,15 @@ inline void Function::forward(const V& algo) const {
 }
 
 inline Domain& Function::eval_domain(const IntervalVector& box) const {
-	return ((Function*) this)->_eval->eval(box);
+	return basic_evaluator().eval(box);
 }
 
 inline Domain& Function::eval_domain(const Array<const Domain>& d) const {
-	return ((Function*) this)->_eval->eval(d);
+	return basic_evaluator().eval(d);
 }
 
 inline Domain& Function::eval_domain(const Array<Domain>& d) const {
-	return ((Function*) this)->_eval->eval(d);
+	return basic_evaluator().eval(d);
 }
 
 inline Interval Function::eval(const IntervalVector& box) const {
@@ -1023,7 +1028,7 @@ inline Interval Function::eval(const IntervalVector& box) const {
 }
 
 inline Interval Function::eval(int i, const IntervalVector& box) const {
-	return ((Function*) this)->_eval->eval(box,BitSet::singleton(_image_dim.size(),i)).i();
+	return basic_evaluator().eval(box,BitSet::singleton(_image_dim.size(),i)).i();
 }
 
 inline IntervalVector Function::eval_vector(const IntervalVector& box) const {
@@ -1034,7 +1039,7 @@ inline IntervalVector Function::eval_vector(const IntervalVector& box) const {
 	assert(!_image_dim.is_matrix());
 	return _image_dim.is_scalar() ?
 			IntervalVector(1,eval(box)) :
-			((Function*) this)->_eval->eval(box).v();
+			basic_evaluator().eval(box).v();
 }
 
 inline IntervalVector Function::eval_vector(const IntervalVector& box, const BitSet& components) const {
@@ -1042,9 +1047,9 @@ inline IntervalVector Function::eval_vector(const IntervalVector& box, const Bit
 	return _image_dim.is_scalar() ?
 			IntervalVector(1,eval(box)) :
 			components.size()==1 ?
-					IntervalVector(1,((Function*) this)->_eval->eval(box,components).i())
+					IntervalVector(1,basic_evaluator().eval(box,components).i())
 					:
-					((Function*) this)->_eval->eval(box,components).v();
+					basic_evaluator().eval(box,components).v();
 }
 
 template<class V>
@@ -1053,7 +1058,7 @@ inline void Function::backward(const V& algo) const {
 }
 
 inline bool Function::backward(const Domain& y, IntervalVector& x) const {
-	return ((Function*) this)->_hc4revise->proj(y,x);
+	return hc4revise().proj(y,x);
 }
 
 inline bool Function::backward(const Interval& y, IntervalVector& x) const {
@@ -1070,11 +1075,11 @@ inline bool Function::backward(const IntervalMatrix& y, IntervalVector& x) const
 }
 
 inline void Function::ibwd(const Domain& y, IntervalVector& x) const {
-	((Function*) this)->_inhc4revise->iproj(y,x);
+	inhc4revise().iproj(y,x);
 }
 
 inline void Function::ibwd(const Domain& y, IntervalVector& x, const IntervalVector& xin) const {
-	((Function*) this)->_inhc4revise->iproj(y,x,xin);
+	inhc4revise().iproj(y,x,xin);
 }
 
 inline void Function::ibwd(const Interval& y, IntervalVector& x) const {
@@ -1092,7 +1097,7 @@ inline void Function::print_expr(std::ostream& os) const {
 inline void Function::gradient(const IntervalVector& x, IntervalVector& g) const {
 	assert(g.size()==nb_var());
 	assert(x.size()==nb_var());
-	_grad->gradient(x,g);
+	deriv_calculator().gradient(x,g);
 //	if (!df) ((Function*) this)->df=new Function(*this,DIFF);
 //	g=df->eval_vector(x);
 }
@@ -1121,7 +1126,7 @@ inline void Function::jacobian(const IntervalVector& full_box, IntervalMatrix& J
 }
 
 inline void Function::jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v) const {
-	_grad->jacobian(x, J, components, v);
+	deriv_calculator().jacobian(x, J, components, v);
 }
 
 inline void Function::hansen_matrix(const IntervalVector& x, IntervalMatrix& H) const {
@@ -1145,19 +1150,19 @@ inline void Function::hansen_matrix(const IntervalVector& full_box, const Interv
 }
 
 inline Eval& Function::basic_evaluator() const {
-	return *_eval;
+	return *(_eval ? _eval : (((Eval*&) _eval) = new Eval((Function&) *this)));
 }
 
 inline Gradient& Function::deriv_calculator() const {
-	return *_grad;
+	return *(_grad ? _grad : (((Gradient*&) _grad) = new Gradient(basic_evaluator())));
 }
 
 inline HC4Revise& Function::hc4revise() const {
-	return *_hc4revise;
+	return *(_hc4revise ? _hc4revise : (((HC4Revise*&) _hc4revise) = new HC4Revise(basic_evaluator())));
 }
 
 inline InHC4Revise& Function::inhc4revise() const {
-	return *_inhc4revise;
+	return *(_inhc4revise ? _inhc4revise : (((InHC4Revise*&) _inhc4revise) = new InHC4Revise(basic_evaluator())));
 }
 
 inline std::ostream& operator<<(std::ostream& os, const Function& f) {
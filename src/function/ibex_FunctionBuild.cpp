@@ -76,18 +76,15 @@ public:
 
 	bool add_index(const ExprNode& e) {
 		const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e);
-		if (idx && idx->indexed_symbol())  {
-			pair<const ExprSymbol*, bool**> p = idx->symbol_mask();
-			if (p.first==NULL) return false;
-			const ExprSymbol& s= *p.first;
-			bool** mask=p.second;
-			int current_index = symbol_index[s.key];
-			for (int i=0; i<s.dim.nb_rows(); i++) {
-				for (int j=0; j<s.dim.nb_cols(); j++)
-					if (mask[i][j])  is_used.add(current_index+(i*s.dim.nb_cols())+j);
-				delete[] mask[i];
-			}
-			delete[] mask;
+		if (idx)  {
+			// note: no mask is built (the symbol may be large)
+			int r,c,nb_rows,nb_cols;
+			const ExprSymbol* s=idx->symbol_block(r,c,nb_rows,nb_cols);
+			if (s==NULL) return false;
+			int current_index = symbol_index[s->key];
+			for (int i=r; i<r+nb_rows; i++)
+				for (int j=c; j<c+nb_cols; j++)
+					is_used.add(current_index+(i*s->dim.nb_cols())+j);
 			return true;
 		} else
 			return false;
@@ -366,6 +363,8 @@ Function::Function(const char* filename) {
 	if ((fd = fopen(filename, "r")) == NULL) throw UnknownFileException(filename);
 
 	ibexin = fd;
+	// the buffer of the lexer still refers to the previous (closed) file
+	ibexrestart(ibexin);
 
 	try {
 		parser::pstruct = new parser::P_StructFunction(*this);
@@ -391,6 +390,8 @@ Function::Function(FILE* fd) {
 	LOCK;
 
 	ibexin = fd;
+	// the buffer of the lexer still refers to the previous (closed) file
+	ibexrestart(ibexin);
 
 	try {
 		parser::pstruct = new parser::P_StructFunction(*this);
@@ -450,13 +451,25 @@ void Function::generate_comp() {
 
 	comp = new Function*[m];
 
+	// If the expression is a vector of m expressions (m rows in the
+	// case of a matrix) the ith component is directly copied from the
+	// ith subexpression. Otherwise, copying expr()[i] copies the whole
+	// DAG for each component.
+	const ExprVector* vec=dynamic_cast<const ExprVector*>(&expr());
+	if (vec && (vec->nb_args!=m || (_image_dim.is_matrix() && vec->row_vector()))) vec=NULL;
+
 	for (int i=0; i<m; i++) {
 		Array<const ExprSymbol> x(nb_arg());
 		varcopy(symbs,x);
-		const ExprIndex& yi_tmp=expr()[i];
-		const ExprNode& yi=ExprCopy().copy(symbs, x, yi_tmp).simplify();
-		delete &yi_tmp;
-		Function* fi=new Function(x,yi);
+		const ExprNode* yi;
+		if (vec) {
+			yi=&ExprCopy().copy(symbs, x, vec->arg(i)).simplify();
+		} else {
+			const ExprIndex& yi_tmp=expr()[i];
+			yi=&ExprCopy().copy(symbs, x, yi_tmp).simplify();
+			delete &yi_tmp;
+		}
+		Function* fi=new Function(x,*yi);
 		const ExprConstant* c=dynamic_cast<const ExprConstant*>(&(fi->expr()));
 		if (c && c->dim.is_scalar() && c->get_value()==Interval::zero()) { // use a more efficient structure than a DAG!
 			if (!zero) zero=fi;
@@ -526,9 +539,7 @@ void Function::init(const Array<const ExprSymbol>& x, const ExprNode& y, const c
 
 		(int&) _nb_var += x[i].dim.size();
 
-		for (int j=0; j<x[i].dim.size(); j++) {
-			index++;
-		}
+		index += x[i].dim.size();
 	}
 
 //	// Find input used
@@ -552,10 +563,11 @@ void Function::init(const Array<const ExprSymbol>& x, const ExprNode& y, const c
 
 	decorate(x,y);
 
-	_eval = new Eval(*this);
-	_hc4revise = new HC4Revise(*_eval);
-	_grad = new Gradient(*_eval);
-	_inhc4revise = new InHC4Revise(*_eval);
+	// the evaluators are built on demand (see basic_evaluator())
+	_eval=NULL;
+	_hc4revise=NULL;
+	_grad=NULL;
+	_inhc4revise=NULL;
 
 	// ===== display adjacency (debug) =========
 //	cout << "adjacency of function" << *this << ":" << endl;
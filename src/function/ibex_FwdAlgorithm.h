@@ -45,6 +45,14 @@ protected:
 	/** TO BE DEFINED (by the subclass) */
 	void chi_fwd(int a, int b, int c, int y);
 
+	/**
+	 * TO BE DEFINED (by the subclass)
+	 *
+	 * Sum of n scalars x[0]+/-x[1]+/-...+/-x[n-1], calculated from left to
+	 * right (neg[k] is true if x[k] is subtracted).
+	 */
+	void sum_fwd(int* x, int n, const bool* neg, int y);
+
 	/*==================== binary operators =========================*/
 	/** TO BE DEFINED (by the subclass) */
 	void gen2_fwd(int x, int y);
@@ -79,6 +87,14 @@ protected:
 	/** TO BE DEFINED (by the subclass) */
 	void mul_MM_fwd(int x1, int x2, int y);
 
+	/**
+	 * TO BE DEFINED (by the subclass)
+	 *
+	 * Product of a constant matrix by a vector (the
+	 * constant must be read from the node x1).
+	 */
+	void mul_CV_fwd(int x1, int x2, int y);
+
 	/** TO BE DEFINED (by the subclass) */
 	void sub_fwd(int x1, int x2, int y);
 
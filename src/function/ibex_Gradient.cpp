@@ -18,7 +18,14 @@ using namespace std;
 namespace ibex {
 
 Gradient::Gradient(Eval& e): f(e.f), _eval(e), d(e.d), g(f),
-		coeff_matrix(f.image_dim(),f.nb_var()+1), is_linear(new bool[f.image_dim()]) {
+		coeff_matrix(NULL), is_linear(NULL) {
+
+}
+
+void Gradient::init_linearity() {
+
+	coeff_matrix = new IntervalMatrix(f.image_dim(),f.nb_var()+1);
+	is_linear = new bool[f.image_dim()];
 
 	if (f.expr().dim.is_matrix())
 		return; // class not called in this case
@@ -26,17 +33,20 @@ Gradient::Gradient(Eval& e): f(e.f), _eval(e), d(e.d), g(f),
 	ExprLinearity el(f.args(),f.expr());
 
 	if (f.expr().dim.is_scalar())
-		coeff_matrix[0]=el.coeff_vector(f.expr());
+		(*coeff_matrix)[0]=el.coeff_vector(f.expr());
 	else
-		coeff_matrix=el.coeff_matrix(f.expr());
+		*coeff_matrix=el.coeff_matrix(f.expr());
 
 	for (int i=0; i<f.image_dim(); i++) {
-		is_linear[i]=!coeff_matrix[i].is_unbounded();
+		is_linear[i]=!(*coeff_matrix)[i].is_unbounded();
 	}
 }
 
 Gradient::~Gradient() {
-	delete[] is_linear;
+	if (coeff_matrix) {
+		delete coeff_matrix;
+		delete[] is_linear;
+	}
 }
 
 void Gradient::gradient(const Array<Domain>& d2, IntervalVector& gbox) {
@@ -101,6 +111,8 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 	assert(box.size()==n);
 	assert(!components.empty());
 
+	if (!coeff_matrix) init_linearity();
+
 
 	int c; // constraint number
 
@@ -112,7 +124,7 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 
 		c=(i==0? components.min() : components.next(c));
 
-		const IntervalVector& row=coeff_matrix[c];
+		const IntervalVector& row=(*coeff_matrix)[c];
 
 		if (is_linear[c])
 			if (v!=-1)
@@ -158,11 +170,11 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 
 			g.write_arg_domains(J.row(i));
 
-			f.cf.forward<Gradient>(*this, *(_eval.fwd_agenda)[c]);
+			f.cf.forward<Gradient>(*this, _eval.component_fwd_agenda(c));
 
-			g[_eval.bwd_agenda[c]->first()].i() = 1.0;
+			g[_eval.component_bwd_agenda(c).first()].i() = 1.0;
 
-			f.cf.backward<Gradient>(*this, *(_eval.bwd_agenda)[c]);
+			f.cf.backward<Gradient>(*this, _eval.component_bwd_agenda(c));
 
 			g.read_arg_domains(J.row(i));
 
@@ -408,6 +420,12 @@ void Gradient::chi_bwd(int a, int b, int c, int y) {
 	g[c].i() += g[y].i() * gc;
 }
 
+void Gradient::sum_bwd(int* x, int n, const bool* neg, int y) {
+	for (int k=n-1; k>=0; k--) {
+		if (neg[k]) g[x[k]].i() += -g[y].i();
+		else g[x[k]].i() += g[y].i();
+	}
+}
 
 void Gradient::max_bwd(int x1, int x2, int y) {
 	Interval gx1,gx2;
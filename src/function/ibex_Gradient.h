@@ -71,6 +71,11 @@ public:
 	 */
 	void jacobian(const Array<Domain>& d, IntervalMatrix& J);
 
+	/**
+	 * \brief True if the ith component of f is linear (w.r.t. all variables).
+	 */
+	bool linear_component(int i);
+
 	/* ====================================== Forward =================================== */
 
 	inline void idx_fwd(int , int ) { /* nothing to do */ }
@@ -80,6 +85,7 @@ public:
 	       void symbol_fwd(int y)             { g[y].clear(); }
 	       void apply_fwd(int*, int y)        { g[y].clear(); }
 	inline void chi_fwd(int, int, int, int y) { g[y].i()=0; }
+	inline void sum_fwd(int*, int, const bool*, int y) { g[y].i()=0; }
 	inline void gen2_fwd(int, int, int y)     { g[y].clear(); }
 	inline void add_fwd(int, int, int y)      { g[y].i()=0; }
 	inline void mul_fwd(int, int, int y)      { g[y].i()=0; }
@@ -124,6 +130,7 @@ public:
 	inline void mul_MV_fwd(int, int, int y)   { g[y].v().clear(); }
 	inline void mul_VM_fwd(int, int, int y)   { g[y].v().clear(); }
 	inline void mul_MM_fwd(int, int, int y)   { g[y].m().clear(); }
+	inline void mul_CV_fwd(int, int, int y)   { g[y].v().clear(); }
 	inline void sub_V_fwd(int, int, int y)    { g[y].v().clear(); }
 	inline void sub_M_fwd(int, int, int y)    { g[y].m().clear(); }
 
@@ -136,6 +143,7 @@ public:
 	inline void cst_bwd    (int) { /* nothing to do */ }
 	       void apply_bwd  (int* x, int y);
 	       void chi_bwd    (int x1, int x2, int x3, int y);
+	       void sum_bwd    (int* x, int n, const bool* neg, int y);
 	       void gen2_bwd   (int x1, int x2, int y);
 	inline void add_bwd    (int x1, int x2, int y) { g[x1].i() += g[y].i();  g[x2].i() += g[y].i(); }
 	inline void mul_bwd    (int x1, int x2, int y) { g[x1].i() += g[y].i() * d[x2].i(); g[x2].i() += g[y].i() * d[x1].i(); }
@@ -181,6 +189,7 @@ public:
 	inline void mul_MV_bwd(int x1, int x2, int y) { g[x1].m() += outer_product(g[y].v(),d[x2].v()); g[x2].v() += d[x1].m().transpose()*g[y].v(); }
 	inline void mul_MM_bwd(int x1, int x2, int y) { g[x1].m() += g[y].m()*d[x2].m().transpose(); g[x2].m() += d[x1].m().transpose()*g[y].m(); }
 	inline void mul_VM_bwd(int x1, int x2, int y) { g[x1].v() += d[x2].m()*g[y].v(); g[x2].m() += outer_product(d[x1].v(),g[y].v()); }
+	inline void mul_CV_bwd(int x1, int x2, int y) { g[x2].v() += g[y].v()*((const ExprConstant&) f.node(x1)).get_matrix_value(); }
 	inline void sub_V_bwd (int x1, int x2, int y) { g[x1].v() += g[y].v(); g[x2].v() -= g[y].v(); }
 	inline void sub_M_bwd (int x1, int x2, int y) { g[x1].m() += g[y].m(); g[x2].m() -= g[y].m(); }
 
@@ -190,11 +199,25 @@ public:
 	ExprDomain  g;
 	// Store the "linear part" of f so
 	// that these coefficients are only calculated once.
-	IntervalMatrix coeff_matrix;
+	// Calculated at the first call to jacobian(...) or
+	// linear_component(...) only, since the matrix is dense
+	// (NULL before).
+	IntervalMatrix* coeff_matrix;
 	// True if the ith component is linear (wrt all variables)
 	bool *is_linear;
+
+protected:
+	// Calculate coeff_matrix and is_linear.
+	void init_linearity();
 };
 
+/*============================================ inline implementation ============================================ */
+
+inline bool Gradient::linear_component(int i) {
+	if (!coeff_matrix) init_linearity();
+	return is_linear[i];
+}
+
 } // namespace ibex
 
 #endif // __IBEX_GRADIENT_H__
@@ -157,6 +157,30 @@ void HC4Revise::vector_bwd(int* x, int y) {
 	}
 }
 
+void HC4Revise::sum_bwd(int* x, int n, const bool* neg, int y) {
+	// The partial sums (the intermediate nodes of the binary
+	// operations) are not calculated by the forward algorithm.
+	partial_sum.resize(n-1);
+	for (int k=1; k<n-1; k++) {
+		const Interval& l=k==1? d[x[0]].i() : partial_sum[k-1];
+		partial_sum[k]=neg[k]? l-d[x[k]].i() : l+d[x[k]].i();
+	}
+
+	// Backward of the binary operations, from the last one
+	for (int k=n-1; k>=1; k--) {
+		const Interval& s=k==n-1? d[y].i() : partial_sum[k];
+		Interval& l=k==1? d[x[0]].i() : partial_sum[k-1];
+		if (!(neg[k]? bwd_sub(s,l,d[x[k]].i()) : bwd_add(s,l,d[x[k]].i())))
+			throw EmptyBoxException();
+	}
+}
+
+void HC4Revise::mul_CV_bwd(int x1, int x2, int y) {
+	// the constant is not contracted
+	IntervalMatrix m=((const ExprConstant&) f.node(x1)).get_matrix_value();
+	if (!(bwd_mul(d[y].v(),m,d[x2].v(),RATIO))) throw EmptyBoxException();
+}
+
 void HC4Revise::gen2_bwd(int x1, int x2, int y) {
 	assert(dynamic_cast<const ExprGenericBinaryOp*>(&(f.node(y))));
 
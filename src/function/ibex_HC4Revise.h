@@ -13,6 +13,8 @@
 
 #include "ibex_Eval.h"
 
+#include <vector>
+
 namespace ibex {
 
 /**
@@ -82,6 +84,9 @@ protected:
 	Eval& eval;
 	ExprDomain& d;
 
+	// partial sums of a fused sum (see sum_bwd)
+	std::vector<Interval> partial_sum;
+
 public: // because called from CompiledFunction
 	inline void idx_bwd    (int, int)          { /* nothing to do */ }
 	       void idx_cp_bwd (int, int);
@@ -91,6 +96,7 @@ public: // because called from CompiledFunction
 	       void apply_bwd  (int* x, int y);
 	inline void chi_bwd(int a, int b, int c, int y){ if (!(bwd_chi(d[y].i(),d[a].i(),d[b].i(),d[c].i()))) throw EmptyBoxException();  }
 	       void gen2_bwd   (int x1, int x2, int y);
+	       void sum_bwd    (int* x, int n, const bool* neg, int y);
 	inline void add_bwd    (int x1, int x2, int y) { if (!(bwd_add(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
 	inline void add_V_bwd  (int x1, int x2, int y) { if (!(bwd_add(d[y].v(),d[x1].v(),d[x2].v()))) throw EmptyBoxException();  }
 	inline void add_M_bwd  (int x1, int x2, int y) { if (!(bwd_add(d[y].m(),d[x1].m(),d[x2].m()))) throw EmptyBoxException();  }
@@ -101,6 +107,7 @@ public: // because called from CompiledFunction
 	inline void mul_MV_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].v(),d[x1].m(),d[x2].v(), RATIO))) throw EmptyBoxException();  }
 	inline void mul_VM_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].v(),d[x1].v(),d[x2].m(), RATIO))) throw EmptyBoxException();  }
 	inline void mul_MM_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].m(),d[x1].m(),d[x2].m(), RATIO))) throw EmptyBoxException();  }
+	       void mul_CV_bwd (int x1, int x2, int y);
 	inline void sub_bwd    (int x1, int x2, int y) { if (!(bwd_sub(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
 	inline void sub_V_bwd  (int x1, int x2, int y) { if (!(bwd_sub(d[y].v(),d[x1].v(),d[x2].v()))) throw EmptyBoxException();  }
 	inline void sub_M_bwd  (int x1, int x2, int y) { if (!(bwd_sub(d[y].m(),d[x1].m(),d[x2].m()))) throw EmptyBoxException();  }
@@ -25,6 +25,7 @@ public:
 	void symbol_fwd (int y) { }
 	void cst_fwd    (int y) { }
 	void chi_fwd    (int x1, int x2, int x3, int y) { throw NotImplemented(); }
+	void sum_fwd    (int* x, int n, const bool* neg, int y) { }
 	void gen2_fwd   (int x, int x2, int y) { throw NotImplemented(); }
 	void add_fwd    (int x1, int x2, int y) { }
 	void mul_fwd    (int x1, int x2, int y) { }
@@ -66,6 +67,7 @@ public:
 	void mul_MV_fwd (int x1, int x2, int y) { throw NotImplemented(); }
 	void mul_VM_fwd (int x1, int x2, int y) { throw NotImplemented(); }
 	void mul_MM_fwd (int x1, int x2, int y) { throw NotImplemented(); }
+	void mul_CV_fwd (int x1, int x2, int y) { throw NotImplemented(); }
 	void sub_V_fwd  (int x1, int x2, int y) { throw NotImplemented(); }
 	void sub_M_fwd  (int x1, int x2, int y) { throw NotImplemented(); }
 	void floor_fwd  (int x, int y) { throw NotImplemented(); }
@@ -154,6 +156,28 @@ void InHC4Revise::idx_cp_bwd(int x, int y) {
 	d[x].put(e.index.first_row(), e.index.first_col(), d[y]);
 }
 
+void InHC4Revise::sum_bwd(int* x, int n, const bool* neg, int y) {
+	// The partial sums (the intermediate nodes of the binary
+	// operations) are not calculated by the forward algorithm.
+	partial_sum.resize(n-1);
+	p_partial_sum.resize(n-1);
+	for (int k=1; k<n-1; k++) {
+		const Interval& l=k==1? d[x[0]].i() : partial_sum[k-1];
+		const Interval& pl=k==1? p[x[0]].i() : p_partial_sum[k-1];
+		partial_sum[k]=neg[k]? l-d[x[k]].i() : l+d[x[k]].i();
+		p_partial_sum[k]=neg[k]? pl-p[x[k]].i() : pl+p[x[k]].i();
+	}
+
+	// Inner backward of the binary operations, from the last one
+	for (int k=n-1; k>=1; k--) {
+		const Interval& s=k==n-1? d[y].i() : partial_sum[k];
+		Interval& l=k==1? d[x[0]].i() : partial_sum[k-1];
+		const Interval& pl=k==1? p[x[0]].i() : p_partial_sum[k-1];
+		if (!(neg[k]? ibwd_sub(s,l,d[x[k]].i(),pl,p[x[k]].i()) : ibwd_add(s,l,d[x[k]].i(),pl,p[x[k]].i())))
+			throw EmptyBoxException();
+	}
+}
+
 void InHC4Revise::apply_bwd(int* x, int y) {
 
 	assert(dynamic_cast<const ExprApply*> (&f.node(y)));
@@ -15,6 +15,8 @@
 #include "ibex_Exception.h"
 #include "ibex_InnerArith.h"
 
+#include <vector>
+
 namespace ibex {
 
 class InHC4Revise : public BwdAlgorithm {
@@ -41,6 +43,10 @@ public:
 	Eval p_eval;
 	ExprDomain& p;
 
+	// partial sums of a fused sum (see sum_bwd)
+	std::vector<Interval> partial_sum;
+	std::vector<Interval> p_partial_sum;
+
 protected:
 	/**
 	 * Class used internally to interrupt the
@@ -59,6 +65,7 @@ public: // because called from CompiledFunction
 	       void vector_bwd (int* , int)             { not_implemented("Inner projection of \"vector\""); }
 	inline void apply_bwd  (int* x, int y);
 	inline void chi_bwd    (int, int, int, int)     { not_implemented("Inner projection of \"chi\""); }
+	       void sum_bwd    (int* x, int n, const bool* neg, int y);
 	inline void add_bwd    (int x1, int x2, int y)  { if (!ibwd_add(d[y].i(),d[x1].i(),d[x2].i(),p[x1].i(),p[x2].i())) throw EmptyBoxException(); }
 	inline void gen2_bwd   (int , int , int)        { not_implemented("Inner projection of binary generic operator"); }
 	inline void add_V_bwd  (int , int , int)        { not_implemented("Inner projection of \"add_V\""); }
@@ -70,6 +77,7 @@ public: // because called from CompiledFunction
 	inline void mul_MV_bwd (int , int , int)        { not_implemented("Inner projection of \"mul_MV\""); }
 	inline void mul_VM_bwd (int , int , int)        { not_implemented("Inner projection of \"mul_VM\""); }
 	inline void mul_MM_bwd (int , int , int)        { not_implemented("Inner projection of \"mul_MM\""); }
+	inline void mul_CV_bwd (int , int , int)        { not_implemented("Inner projection of \"mul_MV\""); }
 	inline void sub_bwd    (int x1, int x2, int y)  { if (!ibwd_sub(d[y].i(),d[x1].i(),d[x2].i(),p[x1].i(),p[x2].i())) throw EmptyBoxException(); }
 	inline void sub_V_bwd  (int , int, int)         { not_implemented("Inner projection of \"sub_V\""); }
 	inline void sub_M_bwd  (int , int, int)         { not_implemented("Inner projection of \"sub_M\""); }
@@ -16,6 +16,7 @@
 #include "ibex_P_Struct.h"
 
 #include <sstream>
+#include <algorithm>
 #include <mutex>
 
 #ifndef _WIN32 // MinGW does not support mutex
@@ -36,39 +37,116 @@ extern void ibexparse_string(const char* syntax);
 
 namespace ibex {
 
-NumConstraint::NumConstraint(const char* filename) : id(next_id()), f(*new Function()), op(EQ), own_f(true) {
+namespace {
+
+/*
+ * Copy an expression where the components of the arguments
+ * of a function f are replaced by scalar symbols (the local
+ * variables). The jth used component of the arguments
+ * (see Function::used_vars) is replaced by the jth local variable.
+ */
+class LocalCopy : public ExprCopy {
+public:
+	LocalCopy(const Function& f, const Array<const ExprSymbol>& x) : used(f.used_vars), x(x), start(f.nb_arg()) {
+		int j=0;
+		for (int s=0; s<f.nb_arg(); s++) {
+			start[s]=j;
+			j+=f.arg(s).dim.size();
+		}
+	}
+
+	const ExprNode& copy(const ExprNode& y) {
+		clone.clean();
+		visit(y);
+		return *clone[y];
+	}
+
+protected:
+	using ExprCopy::visit;
+
+	void visit(const ExprSymbol& s) {
+		clone.insert(s, &components(s, DoubleIndex::all(s.dim)));
+	}
+
+	void visit(const ExprIndex& e) {
+		const ExprSymbol* s=dynamic_cast<const ExprSymbol*>(&e.expr);
+		if (s)
+			clone.insert(e, &components(*s, e.index));
+		else
+			ExprCopy::visit(e);
+	}
+
+	/*
+	 * Local variable corresponding to the component (i,j) of s.
+	 */
+	const ExprNode& var(const ExprSymbol& s, int i, int j) const {
+		int c=start[s.key]+i*s.dim.nb_cols()+j;
+		vector<int>::const_iterator it=lower_bound(used.begin(), used.end(), c);
+		assert(it!=used.end() && *it==c);
+		return x[it-used.begin()];
+	}
+
+	/*
+	 * Expression of local variables equivalent to s[idx].
+	 */
+	const ExprNode& components(const ExprSymbol& s, const DoubleIndex& idx) const {
+		if (idx.one_elt())
+			return var(s, idx.first_row(), idx.first_col());
+
+		Array<const ExprNode> rows(idx.nb_rows());
+		for (int i=0; i<idx.nb_rows(); i++) {
+			if (idx.nb_cols()==1)
+				rows.set_ref(i, var(s, idx.first_row()+i, idx.first_col()));
+			else {
+				Array<const ExprNode> row(idx.nb_cols());
+				for (int j=0; j<idx.nb_cols(); j++)
+					row.set_ref(j, var(s, idx.first_row()+i, idx.first_col()+j));
+				rows.set_ref(i, ExprVector::new_row(row));
+			}
+		}
+		return idx.nb_rows()==1 ? rows[0] : ExprVector::new_col(rows);
+	}
+
+	const vector<int>& used;
+	const Array<const ExprSymbol>& x;
+	vector<int> start; // index of the first component of each argument
+};
+
+} // end anonymous namespace
+
+NumConstraint::NumConstraint(const char* filename) : id(next_id()), f(*new Function()), op(EQ), local(NULL), own_f(true) {
 	build_from_system(System(filename));
 }
 
-NumConstraint::NumConstraint(const char* x, const char* c) : id(next_id()), f(*new Function()), op(EQ), own_f(true) {
+NumConstraint::NumConstraint(const char* x, const char* c) : id(next_id()), f(*new Function()), op(EQ), local(NULL), own_f(true) {
 	build_from_string(Array<const char*>(x),c);
 }
 
-NumConstraint::NumConstraint(const char* x1, const char* x2, const char* c) : id(next_id()), f(*new Function()), op(EQ), own_f(true) {
+NumConstraint::NumConstraint(const char* x1, const char* x2, const char* c) : id(next_id()), f(*new Function()), op(EQ), local(NULL), own_f(true) {
 	build_from_string(Array<const char*>(x1,x2),c);
 }
 
-NumConstraint::NumConstraint(const char* x1, const char* x2, const char* x3, const char* c) : id(next_id()), f(*new Function()), op(EQ), own_f(true) {
+NumConstraint::NumConstraint(const char* x1, const char* x2, const char* x3, const char* c) : id(next_id()), f(*new Function()), op(EQ), local(NULL), own_f(true) {
 	build_from_string(Array<const char*>(x1,x2,x3),c);
 }
 
-NumConstraint::NumConstraint(const char* x1, const char* x2, const char* x3, const char* x4, const char* c) : id(next_id()), f(*new Function()), op(EQ), own_f(true) {
+NumConstraint::NumConstraint(const char* x1, const char* x2, const char* x3, const char* x4, const char* c) : id(next_id()), f(*new Function()), op(EQ), local(NULL), own_f(true) {
 	build_from_string(Array<const char*>(x1,x2,x3,x4),c);
 }
 
-NumConstraint::NumConstraint(const char* x1, const char* x2, const char* x3, const char* x4, const char* x5, const char* c) : id(next_id()), f(*new Function()), op(EQ), own_f(true) {
+NumConstraint::NumConstraint(const char* x1, const char* x2, const char* x3, const char* x4, const char* x5, const char* c) : id(next_id()), f(*new Function()), op(EQ), local(NULL), own_f(true) {
 	build_from_string(Array<const char*>(x1,x2,x3,x4,x5),c);
 }
 
-NumConstraint::NumConstraint(const char* x1, const char* x2, const char* x3, const char* x4, const char* x5, const char* x6, const char* c) : id(next_id()), f(*new Function()), op(EQ), own_f(true) {
+NumConstraint::NumConstraint(const char* x1, const char* x2, const char* x3, const char* x4, const char* x5, const char* x6, const char* c) : id(next_id()), f(*new Function()), op(EQ), local(NULL), own_f(true) {
 	build_from_string(Array<const char*>(x1,x2,x3,x4,x5,x6),c);
 }
 
-NumConstraint::NumConstraint(const char* x1, const char* x2, const char* x3, const char* x4, const char* x5, const char* x6, const char* x7, const char* c) : id(next_id()), f(*new Function()), op(EQ), own_f(true) {
+NumConstraint::NumConstraint(const char* x1, const char* x2, const char* x3, const char* x4, const char* x5, const char* x6, const char* x7, const char* c) : id(next_id()), f(*new Function()), op(EQ), local(NULL), own_f(true) {
 	build_from_string(Array<const char*>(x1,x2,x3,x4,x5,x6,x7),c);
 }
 
-NumConstraint::NumConstraint(const char* x1, const char* x2, const char* x3, const char* x4, const char* x5, const char* x6, const char* x7, const char* x8, const char* c) : id(next_id()), f(*new Function()), op(EQ), own_f(true) {
+NumConstraint::NumConstraint(const char* x1, const char* x2, const char* x3, const char* x4, const char* x5, const char* x6, const char* x7, const char* x8, const char* c) : id(next_id()), f(*new Function()), op(EQ), local(NULL), own_f(true) {
 	build_from_string(Array<const char*>(x1,x2,x3,x4,x5,x6,x7,x8),c);
 }
 
@@ -126,6 +204,19 @@ void NumConstraint::build_from_system(const System& sys) {
 	(CmpOp&) op = c0.op;
 }
 
+void NumConstraint::set_sparse() {
+	if (local || f.used_vars.empty()) return;
+
+	int k=(int) f.used_vars.size();
+	Array<const ExprSymbol> x(k);
+	for (int i=0; i<k; i++)
+		x.set_ref(i, ExprSymbol::new_());
+
+	const ExprNode& y=LocalCopy(f,x).copy(f.expr()).simplify();
+
+	local = new NumConstraint(*new Function(x,y), op, true);
+}
+
 #define RETURN(a,b) return pair<const ExprNode*, const Interval*>(a,b)
 
 //pair<const ExprNode*, const Interval*> NumConstraint::is_thick_equality() const {
@@ -301,11 +301,9 @@ bool full_rank(const IntervalMatrix& A) {
 	 }
 }
 
-void precond(IntervalMatrix& A) {
-	int n=(A.nb_rows());
-	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
+void precond_matrix(const IntervalMatrix& A, Matrix& C) {
+	assert(A.nb_rows() == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
 
-	Matrix C(n,n);
 	try { real_inverse(A.mid(), C); }
 	catch (SingularMatrixException&) {
 		try { real_inverse(A.lb(), C); }
@@ -313,23 +311,23 @@ void precond(IntervalMatrix& A) {
 			real_inverse(A.ub(), C);
 		}
 	}
+}
+
+void precond(IntervalMatrix& A) {
+	int n=(A.nb_rows());
+
+	Matrix C(n,n);
+	precond_matrix(A, C);
 
 	A = C*A;
 }
 
 void precond(IntervalMatrix& A, IntervalVector& b) {
 	int n=(A.nb_rows());
-	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
 	assert(n == b.size());
 
 	Matrix C(n,n);
-	try { real_inverse(A.mid(), C); }
-	catch (SingularMatrixException&) {
-		try { real_inverse(A.lb(), C); }
-		catch (SingularMatrixException&) {
-			real_inverse(A.ub(), C);
-		}
-	}
+	precond_matrix(A, C);
 
 	//   cout << "A=" << (A.nb_cols()) << "x" << (A.nb_rows()) << "  " << "b=" << (b.size()) << "  " << "C="
 	//        << (C.nb_cols()) << "x" << (C.nb_rows()) << endl;
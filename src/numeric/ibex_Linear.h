@@ -148,6 +148,20 @@ void neumaier_inverse(const IntervalMatrix& A, IntervalMatrix& invA);
  */
 void precond_rohn_inverse(const IntervalMatrix& A, IntervalMatrix& invA);
 
+/**
+ * \brief Computes the preconditioning matrix of \f$[A]\f$.
+ *
+ * <br> The matrix returned is \f$C^{-1}\f$ where C is chosen to be either (in priority)
+ * \c Mid([A]), \c Inf([A]) or \c Sup([A]).
+ *
+ * \param A - The interval matrix [A].
+ * \param invC (output) - The preconditioning matrix \f$C^{-1}\f$.
+ *
+ * \throw SingularMatrixException if no real matrix extracted from [A] could be inversed successfully.
+ *                                In this case, invC is not significant.
+ */
+void precond_matrix(const IntervalMatrix& A, Matrix& invC);
+
 /**
  * \brief Preconditions system \f$[A]x=[b]\f$.
  *
@@ -77,7 +77,7 @@ int LinearizerDuality::linearize(const IntervalVector& box, LPSolver& lp_solver,
 		int i=0; // counter of active constraints
 		for (BitSet::iterator c=active->begin(); c!=active->end(); ++c, i++)  {
 
-			if (!sys.f_ctrs.deriv_calculator().is_linear[c]) {
+			if (!sys.f_ctrs.deriv_calculator().linear_component(c)) {
 				for (size_t j=0; j<n; j++) {
 					Vector row(n_total,0.0);
 					row[j]=1;
@@ -147,7 +147,7 @@ int LinearizerXTaylor::linear_relax(const IntervalVector& box, const BitSet& act
 				//cout << " add ctr n°" << c << endl;
 
 				// only one corner for a linear constraint
-				if (k>0 && sys.f_ctrs.deriv_calculator().is_linear[c]) {
+				if (k>0 && sys.f_ctrs.deriv_calculator().linear_component(c)) {
 					//cout << "ctr " << c << " is linear!\n";
 					continue;
 				}
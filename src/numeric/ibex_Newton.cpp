@@ -32,9 +32,67 @@ namespace {
 //	mid = box.mid();
 //	Fmid=f.eval_vector(mid);
 //
+
+/*
+ * Calculate the Jacobian matrix J (and Jp, the Jacobian % parameters, if vars!=NULL).
+ *
+ * If the cached state is valid and contains the Jacobian, J is
+ * directly set to the *preconditioned* Jacobian matrix.
+ */
+void newton_matrix(const Fnc& f, const VarSet* vars, const IntervalVector& full_box,
+		IntervalMatrix& J, IntervalMatrix* Jp, BxpNewtonCache* cache, bool reuse) {
+
+	if (cache && cache->reuse_jacobian) {
+		if (reuse) {
+			J = cache->precond_jacobian;
+			if (vars) *Jp = cache->jacobian_param;
+		} else {
+			// the Hansen matrix is not monotonic w.r.t. inclusion
+			// so we need the full Jacobian to be able to reuse it.
+			if (vars)
+				f.jacobian(full_box,J,*Jp,*vars);
+			else
+				f.jacobian(full_box,J);
+		}
+	} else {
+		if (vars)
+			f.hansen_matrix(full_box,J,*Jp,*vars);
+		else
+			f.hansen_matrix(full_box,J);
+	}
+}
+
+/*
+ * Precondition the linear system J*x=Fmid with the cached
+ * preconditioning matrix if the state is valid. Otherwise,
+ * calculate a new state and store it.
+ *
+ * \throw SingularMatrixException - see precond_matrix(...)
+ */
+void cached_precond(const IntervalVector& full_box, IntervalMatrix& J, const IntervalMatrix* Jp, IntervalVector& Fmid,
+		BxpNewtonCache& cache, bool reuse) {
+
+	if (reuse) {
+		cache.nb_reuse++;
+		if (!cache.reuse_jacobian) J = cache.precond*J;
+		// otherwise: J is already preconditioned
+	} else {
+		cache.invalidate(); // in case precond_matrix(...) throws an exception
+		precond_matrix(J, cache.precond);
+		J = cache.precond*J;
+		if (cache.reuse_jacobian) {
+			cache.precond_jacobian = J;
+			if (Jp) cache.jacobian_param = *Jp;
+		}
+		cache.set_ref_box(full_box);
+	}
+
+	Fmid = cache.precond*Fmid;
 }
 
-bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double prec, double ratio_gauss_seidel) {
+}
+
+bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, BxpNewtonCache* cache, double prec, double ratio_gauss_seidel) {
 	int n=vars? vars->nb_var : f.nb_var();
 	int m=f.image_dim();
 	assert(full_box.size()==f.nb_var());
@@ -63,11 +121,12 @@ bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double p
 
 	y1 = box.mid();
 
+	bool reuse; // can the cached state be reused?
+
 	do {
-		if (vars)
-			f.hansen_matrix(full_box,J,*Jp,*vars);
-		else
-			f.hansen_matrix(full_box,J);
+		reuse = cache && cache->is_valid(full_box);
+
+		newton_matrix(f,vars,full_box,J,Jp,cache,reuse);
 		//		f.jacobian(box,J);
 
 		if (J.is_empty() || (vars && Jp->is_empty())) break;
@@ -96,7 +155,10 @@ bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double p
 		y1=y;
 
 		try {
-			precond(J, Fmid);
+			if (cache)
+				cached_precond(full_box, J, Jp, Fmid, *cache, reuse);
+			else
+				precond(J, Fmid);
 
 			gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
 
@@ -142,14 +204,22 @@ bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double p
 }
 
 bool newton(const Fnc& f, IntervalVector& box, double prec, double ratio_gauss_seidel) {
-	return newton(f,NULL,box,prec,ratio_gauss_seidel);
+	return newton(f,NULL,box,NULL,prec,ratio_gauss_seidel);
 }
 
 bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, double prec, double ratio_gauss_seidel) {
-	return newton(f,&vars,full_box,prec,ratio_gauss_seidel);
+	return newton(f,&vars,full_box,NULL,prec,ratio_gauss_seidel);
+}
+
+bool newton(const Fnc& f, IntervalVector& box, BxpNewtonCache& cache, double prec, double ratio_gauss_seidel) {
+	return newton(f,NULL,box,&cache,prec,ratio_gauss_seidel);
+}
+
+bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, BxpNewtonCache& cache, double prec, double ratio_gauss_seidel) {
+	return newton(f,&vars,full_box,&cache,prec,ratio_gauss_seidel);
 }
 
-bool inflating_newton(const Fnc& f, const VarSet* vars, const IntervalVector& full_box, IntervalVector& box_existence, IntervalVector& box_unicity, int k_max, double mu_max, double delta, double chi) {
+bool inflating_newton(const Fnc& f, const VarSet* vars, const IntervalVector& full_box, IntervalVector& box_existence, IntervalVector& box_unicity, BxpNewtonCache* cache, int k_max, double mu_max, double delta, double chi) {
 	int n=vars ? vars->nb_var : f.nb_var();
 	assert(f.image_dim()==n);
 	assert(full_box.size()==f.nb_var());
@@ -201,14 +271,15 @@ bool inflating_newton(const Fnc& f, const VarSet* vars, const IntervalVector& fu
 
 	y1 = box.mid();
 
+	bool reuse; // can the cached state be reused?
+
 	while (k<k_max) {
 
 		//cout << "current box=" << box << endl << endl;
 
-		if (vars)
-			f.hansen_matrix(box_existence, J, *Jp, *vars);
-		else
-			f.hansen_matrix(box_existence, J);
+		reuse = cache && cache->is_valid(box_existence);
+
+		newton_matrix(f, vars, box_existence, J, Jp, cache, reuse);
 
 		if (J.is_empty()) break;
 
@@ -229,7 +300,10 @@ bool inflating_newton(const Fnc& f, const VarSet* vars, const IntervalVector& fu
 		y1=y;
 
 		try {
-			precond(J, Fmid);
+			if (cache)
+				cached_precond(box_existence, J, Jp, Fmid, *cache, reuse);
+			else
+				precond(J, Fmid);
 		} catch(LinearException&) {
 			break; // should be false
 		}
@@ -315,11 +389,19 @@ bool inflating_newton(const Fnc& f, const VarSet* vars, const IntervalVector& fu
 
 
 bool inflating_newton(const Fnc& f, const IntervalVector& full_box, IntervalVector& box_existence, IntervalVector& box_unicity, int k_max, double mu_max, double delta, double chi) {
-	return inflating_newton(f,NULL,full_box,box_existence,box_unicity,k_max,mu_max,delta,chi);
+	return inflating_newton(f,NULL,full_box,box_existence,box_unicity,NULL,k_max,mu_max,delta,chi);
 }
 
 bool inflating_newton(const Fnc& f, const VarSet& vars, const IntervalVector& full_box, IntervalVector& box_existence, IntervalVector& box_unicity, int k_max, double mu_max, double delta, double chi) {
-	return inflating_newton(f,&vars,full_box,box_existence,box_unicity,k_max,mu_max,delta,chi);
+	return inflating_newton(f,&vars,full_box,box_existence,box_unicity,NULL,k_max,mu_max,delta,chi);
+}
+
+bool inflating_newton(const Fnc& f, const IntervalVector& full_box, IntervalVector& box_existence, IntervalVector& box_unicity, BxpNewtonCache& cache, int k_max, double mu_max, double delta, double chi) {
+	return inflating_newton(f,NULL,full_box,box_existence,box_unicity,&cache,k_max,mu_max,delta,chi);
+}
+
+bool inflating_newton(const Fnc& f, const VarSet& vars, const IntervalVector& full_box, IntervalVector& box_existence, IntervalVector& box_unicity, BxpNewtonCache& cache, int k_max, double mu_max, double delta, double chi) {
+	return inflating_newton(f,&vars,full_box,box_existence,box_unicity,&cache,k_max,mu_max,delta,chi);
 }
 
 VarSet get_newton_vars(const Fnc& f, const Vector& pt, const VarSet& forced_params) {
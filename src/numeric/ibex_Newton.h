@@ -13,6 +13,7 @@
 
 #include "ibex_Fnc.h"
 #include "ibex_VarSet.h"
+#include "ibex_BxpNewtonCache.h"
 
 namespace ibex {
 
@@ -51,6 +52,23 @@ bool newton(const Fnc& f, IntervalVector& box, double prec=default_newton_prec,
  */
 bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
 
+/**
+ * \brief Newton with a cached state.
+ *
+ * Same function as #ibex::newton(const Fnc&, IntervalVector&, double, double) except
+ * that the preconditioning matrix (and, optionally, the Jacobian matrix) stored in \a cache
+ * is reused if it is still valid for the current box. Otherwise, it is
+ * recomputed and stored in \a cache.
+ *
+ * \see #ibex::BxpNewtonCache.
+ */
+bool newton(const Fnc& f, IntervalVector& box, BxpNewtonCache& cache, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
+
+/**
+ * \brief Newton on a subset of variables with a cached state.
+ */
+bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, BxpNewtonCache& cache, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
+
 /**
  * \ingroup numeric
  *
@@ -103,6 +121,30 @@ bool inflating_newton(const Fnc& f, const VarSet& vars, const IntervalVector& bo
 		double delta_relative_inflat=1.1, double chi_absolute_inflat=1e-12);
 
 
+/**
+ * \ingroup numeric
+ *
+ * \brief Multivariate Newton operator (inflating) with a cached state.
+ *
+ * Same function as #ibex::inflating_newton(const Fnc&, const IntervalVector&, IntervalVector&, IntervalVector&, int, double, double, double)
+ * except that the preconditioning matrix (and, optionally, the Jacobian matrix) stored in \a cache is reused
+ * as long as it is valid for the current iterate.
+ *
+ * \see #ibex::BxpNewtonCache.
+ */
+bool inflating_newton(const Fnc& f, const IntervalVector& box, IntervalVector& box_existence, IntervalVector& box_unicity,
+		BxpNewtonCache& cache, int k_max_iteration=15, double mu_max_divergence=1.0,
+		double delta_relative_inflat=1.1, double chi_absolute_inflat=1e-12);
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Multivariate Newton operator (inflating) on a subset of variables, with a cached state.
+ */
+bool inflating_newton(const Fnc& f, const VarSet& vars, const IntervalVector& box, IntervalVector& box_existence, IntervalVector& box_unicity,
+		BxpNewtonCache& cache, int k_max_iteration=15, double mu_max_divergence=1.0,
+		double delta_relative_inflat=1.1, double chi_absolute_inflat=1e-12);
+
 /**
  * Determine which variables should be considered as parameters
  * when solving an under-constrained system f(x)=0 around a point "pt"
@@ -15,6 +15,8 @@
 #include "ibex_CovSolverData.h"
 
 #include <cassert>
+#include <climits>
+#include <chrono>
 
 using namespace std;
 
@@ -27,10 +29,10 @@ namespace {
 Solver::Solver(const System& sys, Ctc& ctc, Bsc& bsc, CellBuffer& buffer,
 		const Vector& eps_x_min, const Vector& eps_x_max) :
 		  ctc(ctc), bsc(bsc), buffer(buffer), eps_x_min(eps_x_min), eps_x_max(eps_x_max),
-		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0),
+		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0), listener(NULL), cancellation(NULL),
 		  solve_init_box(sys.box), eqs(NULL), ineqs(NULL),
 		  params(sys.nb_var,BitSet::empty(sys.nb_var),false) /* no forced parameter by default */,
-		  manif(NULL), time(0), nb_cells(0) {
+		  manif(NULL), unicity_index(sys.nb_var), cert_capacity(0), cert_pool(NULL), time(0), nb_cells(0), nb_iter(0), next_milestone(1), interrupted(false) {
 
 	assert(sys.box.size()==ctc.nb_var);
 
@@ -67,7 +69,45 @@ void Solver::set_params(const VarSet& _params) {
 	params=_params;
 }
 
+void Solver::set_parallel_certification(int nb_threads, unsigned int capacity) {
+	drop_candidates(false);
+
+	// the threads must be over before their systems are deleted
+	if (cert_pool) {
+		delete cert_pool;
+		cert_pool = NULL;
+	}
+
+	for (size_t i=0; i<cert_eqs.size(); i++) {
+		if (cert_eqs[i]) delete cert_eqs[i];
+		if (cert_ineqs[i]) delete cert_ineqs[i];
+	}
+	cert_eqs.clear();
+	cert_ineqs.clear();
+
+	if (nb_threads<=0) {
+		cert_capacity = 0;
+		return;
+	}
+
+	if (capacity==0)
+		ibex_error("Solver: the certification capacity must be positive");
+
+	cert_capacity = capacity;
+
+	// function evaluation is not thread-safe:
+	// each additional thread needs its own copy of the system.
+	for (int i=1; i<nb_threads; i++) {
+		cert_eqs.push_back(eqs? new System(*eqs, System::COPY) : NULL);
+		cert_ineqs.push_back(ineqs? new System(*ineqs, System::COPY) : NULL);
+	}
+
+	cert_pool = new ThreadPool(nb_threads);
+}
+
 Solver::~Solver() {
+	set_parallel_certification(0);
+
 	if (ineqs) {
 		delete ineqs;
 		if (eqs) {
@@ -82,10 +122,15 @@ void Solver::start(const IntervalVector& init_box) {
 
 	buffer.flush();
 
+	drop_candidates(false);
+	outputs.clear();
+
 	if (manif) delete manif;
 
 	manif = new CovSolverData(n, m, nb_ineq, CovManifold::EQU_ONLY, eqs? eqs->var_names() : ineqs->var_names());
 
+	unicity_index.clear();
+
 	Cell* root=new Cell(init_box);
 
 	// add data required by the bisector
@@ -104,12 +149,19 @@ void Solver::start(const IntervalVector& init_box) {
 	nb_cells = 1;
 	manif->set_nb_cells(0);
 
+	next_milestone = 1;
+	interrupted = false;
+	nb_iter = 0;
+
 	timer.restart();
 }
 
 void Solver::start(const CovSolverData& data) {
 	buffer.flush();
 
+	drop_candidates(false);
+	outputs.clear();
+
 	if (manif) delete manif;
 	manif = new CovSolverData(n, m, nb_ineq);
 
@@ -121,10 +173,13 @@ void Solver::start(const CovSolverData& data) {
 	for (size_t i=0; i<data.nb_inner(); i++)
 		manif->add_inner(data.inner(i));
 
+	unicity_index.clear();
+
 	for (size_t i=0; i<data.nb_solution(); i++)
-		if (m==n)
+		if (m==n) {
 			manif->add_solution(data.solution(i), data.unicity(i));
-		else
+			unicity_index.add(data.unicity(i), i);
+		} else
 			manif->add_solution(data.solution(i), data.unicity(i), data.solution_varset(i));
 
 	for (size_t i=0; i<data.nb_boundary(); i++)
@@ -156,6 +211,10 @@ void Solver::start(const CovSolverData& data) {
 	nb_cells=0; // no new cell created!
 	manif->set_nb_cells(data.nb_cells());
 
+	next_milestone = 1;
+	interrupted = false;
+	nb_iter = 0;
+
 	timer.restart();
 }
 
@@ -166,9 +225,32 @@ void Solver::start(const char* input_paving) {
 
 bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol) {
 
-	while (!buffer.empty()) {
+	while (!buffer.empty() || !candidates.empty() || !outputs.empty()) {
 
-		if (time_limit >0) {
+		// boxes recorded by the last certification
+		if (!outputs.empty()) {
+			status=outputs.front().first;
+			if (sol) *sol=&(*manif)[outputs.front().second];
+			outputs.pop_front();
+			return true;
+		}
+
+		// take the certifications over (or wait for the oldest one if
+		// the search cannot go on)
+		if (!candidates.empty() && (buffer.empty() || candidates.size()>=cert_capacity
+				|| candidates.front()->done.wait_for(chrono::seconds(0))==future_status::ready)) {
+			try {
+				record_cert();
+			}
+			catch(CellLimitException& e) {
+				if (sol) *sol=NULL;
+				throw e;
+			}
+			continue;
+		}
+
+		// amortized (the CPU time is read by a system call)
+		if (time_limit >0 && nb_iter++ % time_check_period==0) {
 			try {
 				timer.check(time_limit);
 			}
@@ -179,11 +261,21 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 			}
 		}
 
+		if (interrupted || (cancellation && cancellation->poll())) {
+			flush();
+			if (sol) *sol=NULL;
+			if (!interrupted && cancellation->expired())
+				throw TimeOutException();
+			else
+				throw SolverInterruptedException();
+		}
+
 		if (trace==2) cout << buffer << endl;
 
 		Cell* c=buffer.top();
 
 		ContractContext context(c->prop);
+		context.cancellation = cancellation;
 
 		int v=c->bisected_var; // last bisected var.
 
@@ -192,18 +284,28 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 		}
 
 		try {
-			ctc.contract(c->box,context);
+			ctc.profiled_contract(c->box,context);
 
 			if (c->box.is_empty()) throw EmptyBoxException();
 
+			// the only solution in the cell (if any) has already been found
+			if (!unicity_index.empty() && unicity_index.find_superset(c->box)!=-1)
+				throw EmptyBoxException();
+
 			// 2nd condition: certification is performed at
 			// each intermediate step only if the system is under constrained
 			if (m==0 || (m<n && !is_too_large(c->box))) {
+				if (cert_pool) {
+					// certified (and bisected if necessary) later
+					submit_cert(buffer.pop(),false);
+					continue;
+				}
 				// note: cannot return PENDING status
 				status=check_sol(c->box);
 				if (status!=CovSolverData::UNKNOWN) { // <=> solution or boundary
 					delete buffer.pop();
 					if (sol) *sol=&(*manif)[manif->size()-1];
+					if (listener) notify_box(status);
 					return true;
 				} // otherwise: continue search...
 			} // else: otherwise: continue search...
@@ -224,9 +326,14 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 					if (sol) *sol=NULL;
 					throw CellLimitException();
 				}
+				if (listener) notify_cells();
 			}
 
 			catch (NoBisectableVariableException&) {
+				if (cert_pool) {
+					submit_cert(buffer.pop(),true);
+					continue;
+				}
 				status=check_sol(c->box);
 				if (status==CovSolverData::UNKNOWN) {
 					if (trace >=1) cout << " [unknown] " << c->box << endl;
@@ -234,6 +341,7 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 				}
 				delete buffer.pop();
 				if (sol) *sol=&(*manif)[manif->size()-1];
+				if (listener) notify_box(status);
 				return true;
 			}
 		}
@@ -290,6 +398,8 @@ Solver::Status Solver::solve() {
 		final_status=CELL_OVERFLOW;
 	} catch(TimeOutException&) {
 		final_status=TIME_OUT;
+	} catch(SolverInterruptedException&) {
+		final_status=INTERRUPTED;
 	}
 
 	manif->set_solver_status(final_status);
@@ -304,16 +414,16 @@ Solver::Status Solver::solve() {
 	return final_status;
 }
 
-bool Solver::check_ineq(const IntervalVector& box) {
-	if (!ineqs)
+bool Solver::check_ineq(const IntervalVector& box, const System* _ineqs) const {
+	if (!_ineqs)
 		return true;
 
 	Interval y,r;
 
 	bool not_inner=false;
 
-	for (int i=0; i<ineqs->nb_ctr; i++) {
-		NumConstraint& c=ineqs->ctrs[i];
+	for (int i=0; i<_ineqs->nb_ctr; i++) {
+		NumConstraint& c=_ineqs->ctrs[i];
 		assert(c.f.image_dim()==1);
 		y=c.f.eval(box);
 		r=c.right_hand_side().i();
@@ -329,46 +439,52 @@ bool Solver::check_ineq(const IntervalVector& box) {
 	return !not_inner;
 }
 
+Solver::Certification::Certification(int n) : status(CovSolverData::UNKNOWN), empty(false), certified(false),
+		existence(n), unicity(n), varset(n,BitSet::empty(n)) {
+
+}
+
 CovSolverData::BoxStatus Solver::check_sol(const IntervalVector& box) {
+	Certification cert(n);
+	certify(box, eqs, ineqs, cert);
+	return record(box, cert);
+}
 
-	if (!eqs) {
-		if (check_ineq(box)) {
-			if (trace >=1) cout << " [solution] " << box << endl;
-			manif->add_inner(box);
-			return CovSolverData::SOLUTION;
-		} else if (is_boundary(box)) {
-			manif->add_boundary(box);
-			return CovSolverData::BOUNDARY;
-		} else
-			return CovSolverData::UNKNOWN;
-	} else {
+void Solver::certify(const IntervalVector& box, const System* _eqs, const System* _ineqs, Certification& cert) const {
+
+	try {
+		if (!_eqs) {
+			if (check_ineq(box, _ineqs))
+				cert.status = CovSolverData::SOLUTION;
+			else if (is_boundary(box, _eqs, _ineqs))
+				cert.status = CovSolverData::BOUNDARY;
+			return;
+		}
 
 		if (m>n) {
 			// Certification not implemented for over-constrained systems
-			return CovSolverData::UNKNOWN;
+			return;
 		}
 
-		IntervalVector existence(box);
-		IntervalVector unicity(n);
-		VarSet varset(n,BitSet::empty(n));
+		cert.existence = box;
 
 		if (m<n) {
 			// ====== under-constrained =========
 			try {
 
-				varset=get_newton_vars(eqs->f_ctrs,box.mid(),params);
+				cert.varset=get_newton_vars(_eqs->f_ctrs,box.mid(),params);
 
-				if (!inflating_newton(eqs->f_ctrs, varset, box, existence, unicity)) {
-					return CovSolverData::UNKNOWN;
+				if (!inflating_newton(_eqs->f_ctrs, cert.varset, box, cert.existence, cert.unicity)) {
+					return;
 				}
 
 			} catch(SingularMatrixException& e) {
-				return CovSolverData::UNKNOWN;
+				return;
 			}
 		} else {
 			// ====== well-constrained =========
-			if (!inflating_newton(eqs->f_ctrs, box.mid(), existence, unicity)) {
-				return CovSolverData::UNKNOWN;
+			if (!inflating_newton(_eqs->f_ctrs, box.mid(), cert.existence, cert.unicity)) {
+				return;
 			}
 		}
 
@@ -376,45 +492,157 @@ CovSolverData::BoxStatus Solver::check_sol(const IntervalVector& box) {
 
 		// Note that the following line also tests the case of an existence box outside
 		// the initial box of the search
-		if (box.is_disjoint(existence)) {
+		if (box.is_disjoint(cert.existence)) {
 			throw EmptyBoxException();
 		}
 
-		bool solution = existence.is_subset(solve_init_box);
+		cert.certified = true;
+
+		bool solution = cert.existence.is_subset(solve_init_box);
+
+		solution &= check_ineq(cert.existence, _ineqs);
+
+		if (solution)
+			cert.status = CovSolverData::SOLUTION;
+		else if (is_boundary(cert.existence, _eqs, _ineqs))
+			cert.status = CovSolverData::BOUNDARY;
+
+	} catch(EmptyBoxException&) {
+		cert.empty = true;
+	}
+}
+
+CovSolverData::BoxStatus Solver::record(const IntervalVector& box, const Certification& cert) {
+
+	if (cert.empty)
+		throw EmptyBoxException();
+
+	if (!eqs) {
+		if (cert.status==CovSolverData::SOLUTION) {
+			if (trace >=1) cout << " [solution] " << box << endl;
+			manif->add_inner(box);
+		} else if (cert.status==CovSolverData::BOUNDARY)
+			manif->add_boundary(box);
+		return cert.status;
+	}
+
+	if (!cert.certified)
+		return CovSolverData::UNKNOWN;
+
+	if (n==m) {
+		// Check if the solution is new, that is, that the solution is not included in the unicity
+		// box of a previously found solution. For efficiency reason, this test is not performed in
+		// the case of under-constrained systems (m<n).
+		if (unicity_index.find_superset(cert.existence)!=-1)
+			throw EmptyBoxException();
+	}
+
+	switch (cert.status) {
+	case CovSolverData::SOLUTION:
+		if (trace >=1) cout << " [solution] " << cert.existence << endl;
+		manif->add_solution(cert.existence, cert.unicity, cert.varset);
+		if (n==m) unicity_index.add(cert.unicity, manif->nb_solution()-1);
+		break;
+	case CovSolverData::BOUNDARY:
+		if (trace >=1) cout << " [boundary] " << cert.existence << endl;
+		manif->add_boundary(cert.existence, cert.varset);
+		break;
+	default:
+		break;
+	}
+	return cert.status;
+}
+
+Solver::Candidate::Candidate(Cell* cell, bool too_small, int n) : cell(cell), too_small(too_small), cert(n) {
+
+}
+
+void Solver::submit_cert(Cell* c, bool too_small) {
+	Candidate* cand=new Candidate(c, too_small, n);
+
+	// the thread k>0 works on its own copy of the system
+	cand->done=cert_pool->submit([this,cand](int k) {
+		certify(cand->cell->box, k==0? eqs : cert_eqs[k-1], k==0? ineqs : cert_ineqs[k-1], cand->cert);
+	});
+
+	candidates.push_back(cand);
+}
 
-		solution &= check_ineq(existence);
+void Solver::record_cert() {
 
-		if (eqs && n==m) {
-			// Check if the solution is new, that is, that the solution is not included in the unicity
-			// box of a previously found solution. For efficiency reason, this test is not performed in
-			// the case of under-constrained systems (m<n).
+	Candidate* cand=candidates.front();
+	candidates.pop_front();
 
-			// TODO
-			//		for (vector<QualifiedBox>::iterator it=manif->inner.begin(); it!=manif->inner.end(); it++) {
-			//			if (it->unicity().is_superset(existence)) {
-			//				if (unicity) delete unicity;
-			//				if (varset) delete varset;
-			//				throw EmptyBoxException();
-			//			}
-			//		}
+	Cell* c=cand->cell;
+	bool too_small=cand->too_small;
+	CovSolverData::BoxStatus status;
+
+	try {
+		cand->done.get(); // rethrows the exception raised by the certification
+		status=record(c->box, cand->cert);
+	} catch (EmptyBoxException&) {
+		delete c;
+		delete cand;
+		return;
+	} catch (...) {
+		delete c;
+		delete cand;
+		throw;
+	}
+
+	delete cand;
+
+	if (status==CovSolverData::UNKNOWN) {
+		if (!too_small) {
+			// same as in the sequential mode: the search goes on
+			try {
+				if (is_too_small(c->box))
+					throw NoBisectableVariableException();
+
+				pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
+
+				delete c;
+				buffer.push(new_cells.first);
+				buffer.push(new_cells.second);
+				nb_cells+=2;
+				if (cell_limit >=0 && nb_cells>=cell_limit) {
+					// the next candidates are pending
+					flush();
+					throw CellLimitException();
+				}
+				if (listener) notify_cells();
+				return;
+			} catch (NoBisectableVariableException&) {
+				// note: the certification would give the same result
+			}
 		}
+		if (trace >=1) cout << " [unknown] " << c->box << endl;
+		manif->add_unknown(c->box);
+	}
 
-		if (solution) {
-			if (trace >=1) cout << " [solution] " << existence << endl;
-			manif->add_solution(existence, unicity, varset);
-			return CovSolverData::SOLUTION;
-		} else {
-			if (is_boundary(existence)) {
-				if (trace >=1) cout << " [boundary] " << existence << endl;
-				manif->add_boundary(existence, varset);
-				return CovSolverData::BOUNDARY;
-			} else
-				return CovSolverData::UNKNOWN;
+	delete c;
+	outputs.push_back(make_pair(status, manif->size()-1));
+	if (listener) notify_box(status);
+}
+
+void Solver::drop_candidates(bool pending) {
+	// the certifications not started are discarded
+	if (cert_pool) cert_pool->discard();
+
+	for (deque<Candidate*>::iterator it=candidates.begin(); it!=candidates.end(); it++) {
+		// the cell may still be read by a certification thread
+		(*it)->done.wait();
+		if (pending) {
+			if (trace >=1) cout << " [pending] " << (*it)->cell->box << endl;
+			manif->add_pending((*it)->cell->box);
 		}
+		delete (*it)->cell;
+		delete *it;
 	}
+	candidates.clear();
 }
 
-bool Solver::is_boundary(const IntervalVector& box) {
+bool Solver::is_boundary(const IntervalVector& box, const System* _eqs, const System* _ineqs) const {
 
 	switch (boundary_test) {
 	case ALL_TRUE : return true;
@@ -431,7 +659,7 @@ bool Solver::is_boundary(const IntervalVector& box) {
 		}
 
 		// get active inequalities
-		BitSet ineq_active=ineqs? ineqs->active_ctrs(box) : BitSet::empty(n);
+		BitSet ineq_active=_ineqs? _ineqs->active_ctrs(box) : BitSet::empty(n);
 
 		int size = bound.size() + m + ineq_active.size();
 
@@ -444,11 +672,11 @@ bool Solver::is_boundary(const IntervalVector& box) {
 			J[i][v]=1.0;
 		}
 		if (m>0) {
-			J.put(i,0,eqs->f_ctrs.jacobian(box));
+			J.put(i,0,_eqs->f_ctrs.jacobian(box));
 			i+=m;
 		}
-		if (ineqs!=NULL) {
-			J.put(i,0,ineqs->f_ctrs.jacobian(box,ineq_active));
+		if (_ineqs!=NULL) {
+			J.put(i,0,_ineqs->f_ctrs.jacobian(box,ineq_active));
 		}
 		return full_rank(J);
 	}
@@ -471,7 +699,31 @@ bool Solver::is_too_large(const IntervalVector& box) {
 	return false;
 }
 
+void Solver::notify_box(CovSolverData::BoxStatus status) {
+	time = timer.get_time();
+	listener->box_found(*this, (*manif)[manif->size()-1], status);
+}
+
+void Solver::notify_cells() {
+	// nb_cells has just been increased by 2
+	if (nb_cells/listener->period > (nb_cells-2)/listener->period) {
+		time = timer.get_time();
+		listener->cells_handled(*this);
+	}
+
+	unsigned int size=buffer.size();
+	if (size >= next_milestone) {
+		time = timer.get_time();
+		listener->buffer_milestone(*this, size);
+		while (next_milestone <= size && next_milestone < UINT_MAX/2)
+			next_milestone *= 2;
+	}
+}
+
 void Solver::flush() {
+	// cells waiting for certification
+	drop_candidates(true);
+
 	while (!buffer.empty()) {
 		Cell* cell=buffer.top();
 		if (trace >=1) cout << " [pending] " << cell->box << endl;
@@ -519,10 +771,16 @@ void Solver::report() {
 		cout << red() << " done! but some boxes have 'unknown' status." << endl;
 		break;
 	case TIME_OUT: 
-		cout << red() << " time limit " << time_limit << "s. reached " << endl;
+		if (cancellation && cancellation->expired())
+			cout << red() << " deadline reached " << endl;
+		else
+			cout << red() << " time limit " << time_limit << "s. reached " << endl;
 		break;
 	case CELL_OVERFLOW: 
 		cout << red() << " cell overflow" << endl;
+		break;
+	case INTERRUPTED:
+		cout << red() << " solving interrupted" << endl;
 	}
 
 	cout << white() << endl;
@@ -547,6 +805,8 @@ void Solver::report() {
 	if (manif->nb_cells()!=nb_cells)
 		cout << " [total=" << manif->nb_cells() << "]";
 	cout << endl << endl;
+	if (CtcProfile::enabled)
+		CtcProfile::report(cout);
 }
 
 } // end namespace ibex
@@ -17,11 +17,16 @@
 #include "ibex_CellBuffer.h"
 #include "ibex_SubPaving.h"
 #include "ibex_Timer.h"
+#include "ibex_Cancellation.h"
 #include "ibex_Exception.h"
 #include "ibex_Linear.h"
 #include "ibex_CovSolverData.h"
+#include "ibex_SolverListener.h"
+#include "ibex_BoxIndex.h"
+#include "ibex_ThreadPool.h"
 
 #include <vector>
+#include <deque>
 
 namespace ibex {
 
@@ -37,6 +42,8 @@ namespace ibex {
 
 class CellLimitException : public Exception {} ;
 
+class SolverInterruptedException : public Exception {} ;
+
 class CovSolverData;
 class CovSolverDataFactory;
 
@@ -47,7 +54,7 @@ public:
 	 *
 	 * See comments for solve(...) below.
 	 */
-	typedef enum { SUCCESS, INFEASIBLE, NOT_ALL_VALIDATED, TIME_OUT, CELL_OVERFLOW } Status;
+	typedef enum { SUCCESS, INFEASIBLE, NOT_ALL_VALIDATED, TIME_OUT, CELL_OVERFLOW, INTERRUPTED } Status;
 
 	/**
 	 * \brief Boundary test strength
@@ -81,6 +88,30 @@ public:
 	 */
 	void set_params(const VarSet& params);
 
+	/**
+	 * \brief Certify the candidate boxes asynchronously, with several threads.
+	 *
+	 * Instead of being certified (inflating Newton) as soon as they are
+	 * reached, the candidate boxes are submitted to persistent threads
+	 * and the search goes on. The certifications are taken by next() as
+	 * soon as they are over, in the order of submission, and the status of
+	 * the box (solution, boundary or unknown) is written in the COV. A box
+	 * that is not validated but can still be bisected is pushed back (split)
+	 * into the buffer. The search only waits for a certification when the
+	 * buffer is empty or when \a capacity boxes are being certified.
+	 *
+	 * Each additional thread works on its own copy of the system. The
+	 * boxes found are the same as in the sequential mode, but they
+	 * may be found in a different order.
+	 *
+	 * \param nb_threads - number of threads (including the calling one,
+	 *                     which only searches if nb_threads>1).
+	 *                     If zero (default), the boxes are certified
+	 *                     immediately (sequential mode).
+	 * \param capacity   - maximal number of boxes being certified.
+	 */
+	void set_parallel_certification(int nb_threads, unsigned int capacity=default_cert_capacity);
+
 	/**
 	 * \brief Destructor.
 	 */
@@ -107,6 +138,10 @@ public:
 	 *   CELL_OVERFLOW:     (incomplete search) cell overflow : the number of
 	 *                      cell has exceeded the limit.
 	 *
+	 *   INTERRUPTED:       (incomplete search) the search has been
+	 *                      stopped by interrupt() or by the cancellation
+	 *                      token (see #cancellation).
+	 *
 	 * The vector of "solutions" (output boxes) found by the solver
 	 * are retrieved with #get_solutions().
 	 */
@@ -170,12 +205,26 @@ public:
 	 *              *sol is set to NULL if search is over, time is out or the number
 	 *              of cells exceeds the limit.
 	 *
-	 * \throw CellLimitException or TimeOutException
+	 * \throw CellLimitException, TimeOutException or SolverInterruptedException
 	 */
 	bool next(CovSolverData::BoxStatus& box_status, const IntervalVector** sol=NULL);
 
+	/**
+	 * \brief Stop the search.
+	 *
+	 * The remaining cells are flushed (as pending boxes) at the
+	 * beginning of the next iteration and solve(...) returns INTERRUPTED.
+	 *
+	 * This function is meant to be called by a listener callback
+	 * (see #listener).
+	 */
+	void interrupt();
+
 	/**
 	 * \brief Displays on standard output a report of the last call to solve(...).
+	 *
+	 * If profiling is enabled (see CtcProfile), the statistics of the contractors
+	 * are also displayed.
 	 */
 	void report();
 
@@ -199,6 +248,24 @@ public:
 	 * \return the number of cells generated by the last call to solve(...).
 	 */
 	double get_nb_cells() const;
+
+	/**
+	 * \brief Get the time spent by the current search.
+	 *
+	 * Contrary to get_time(), the time of previous calls (in case of
+	 * a search started from a COV) is not included. During the search,
+	 * this time is only updated before the listener callbacks.
+	 */
+	double get_current_time() const;
+
+	/**
+	 * \brief Get the number of cells of the current search.
+	 *
+	 * Contrary to get_nb_cells(), the cells of previous calls (in case
+	 * of a search started from a COV) are not included.
+	 */
+	unsigned int get_current_nb_cells() const;
+
 	/**
 	 * \brief The contractor.
 	 *
@@ -239,6 +306,10 @@ public:
 	 *
 	 * This parameter allows to bound running time.
 	 * The value can be fixed by the user. By default, it is -1 (no limit).
+	 *
+	 * Reading the CPU time is a system call: the time is checked every
+	 * #time_check_period cells only, so the limit can be exceeded by
+	 * the time of a few cells.
 	 */
 
 	double time_limit;
@@ -262,6 +333,38 @@ public:
 	 */
 	int trace;
 
+	/**
+	 * \brief Listener.
+	 *
+	 * If not NULL, the listener is notified of each output box, of
+	 * the number of cells handled and of the growth of the buffer
+	 * (see SolverListener).
+	 *
+	 * The callbacks can stop the search (see #interrupt()) or change
+	 * the #time_limit.
+	 *
+	 * Default value: NULL.
+	 */
+	SolverListener* listener;
+
+	/**
+	 * \brief Cancellation token.
+	 *
+	 * If not NULL, the token is polled at each cell and passed to the
+	 * contractor (see ContractContext::cancellation). Once the token is
+	 * cancelled, the search stops with status INTERRUPTED, or TIME_OUT
+	 * if the deadline of the token is reached. Contrary to #time_limit
+	 * (CPU time of the process), the deadline is a wall-clock time.
+	 *
+	 * Default value: NULL.
+	 */
+	Cancellation* cancellation;
+
+	/** Default maximal number of boxes being certified: 64. */
+	static constexpr unsigned int default_cert_capacity = 64;
+
+	/** Number of cells between two checks of the #time_limit: 64. */
+	static constexpr unsigned int time_check_period = 64;
 
 protected:
 	/**
@@ -269,6 +372,26 @@ protected:
 	 */
 	Status solve();
 
+	/*
+	 * \brief Result of the certification of a box.
+	 */
+	struct Certification {
+		Certification(int n);
+
+		/* Status of the box (if not empty). */
+		CovSolverData::BoxStatus status;
+
+		/* True if the box contains no solution. */
+		bool empty;
+
+		/* True if inflating Newton has succeeded (equalities only). */
+		bool certified;
+
+		IntervalVector existence;
+		IntervalVector unicity;
+		VarSet varset;
+	};
+
 	/*
 	 * \brief Return a new "output box" that potentially contains solutions.
 	 * \throw An exception otherwise (no solution inside).
@@ -282,11 +405,52 @@ protected:
 	 */
 	CovSolverData::BoxStatus check_sol(const IntervalVector& box);
 
+	/*
+	 * \brief Certify a box (first half of check_sol).
+	 *
+	 * Does not modify the solver, so that several boxes can be certified
+	 * in parallel, each thread with its own copy of the equalities and
+	 * inequalities (\a eqs and \a ineqs).
+	 */
+	void certify(const IntervalVector& box, const System* eqs, const System* ineqs, Certification& cert) const;
+
+	/*
+	 * \brief Store a certified box in the COV (second half of check_sol).
+	 *
+	 * \throw EmptyBoxException if the box contains no new solution.
+	 */
+	CovSolverData::BoxStatus record(const IntervalVector& box, const Certification& cert);
+
+	/*
+	 * \brief Submit a cell to the certification threads.
+	 *
+	 * \param too_small - true if the cell cannot be bisected.
+	 */
+	void submit_cert(Cell* c, bool too_small);
+
+	/*
+	 * \brief Record the certification of the oldest candidate
+	 *        (waits until it is over).
+	 *
+	 * The cell is bisected if it is not validated (as in the
+	 * sequential mode).
+	 */
+	void record_cert();
+
+	/*
+	 * \brief Discard the candidates (once their certification, if started,
+	 *        is over).
+	 *
+	 * \param pending - if true, the candidates are added to the COV
+	 *                  as pending boxes.
+	 */
+	void drop_candidates(bool pending);
+
 	/**
 	 * \brief Check if the box is "BOUNDARY"
 	 * \see SolverOutputBox.
 	 */
-	bool is_boundary(const IntervalVector& box);
+	bool is_boundary(const IntervalVector& box, const System* eqs, const System* ineqs) const;
 
 	/**
 	 * \brief True if width(box)>eps_x_max.
@@ -298,7 +462,7 @@ protected:
 	 */
 	bool is_too_small(const IntervalVector& box);
 
-	bool check_ineq(const IntervalVector& box);
+	bool check_ineq(const IntervalVector& box, const System* ineqs) const;
 
 	/**
 	 * \brief Check if time is out.
@@ -310,6 +474,16 @@ protected:
 	 */
 	void flush();
 
+	/**
+	 * \brief Call the listener after a new output box is found.
+	 */
+	void notify_box(CovSolverData::BoxStatus status);
+
+	/**
+	 * \brief Call the listener after a bisection.
+	 */
+	void notify_cells();
+
 	/*
 	 * \brief Initial box of the current search.
 	 */
@@ -350,6 +524,59 @@ protected:
 	 */
 	CovSolverData* manif;
 
+	/*
+	 * \brief Unicity boxes of the solutions found (well-constrained systems only).
+	 *
+	 * A cell included in the unicity box of a solution cannot contain
+	 * another solution and is discarded.
+	 */
+	BoxIndex unicity_index;
+
+	/*
+	 * \brief Maximal number of boxes being certified (0 if the boxes
+	 *        are certified immediately).
+	 */
+	unsigned int cert_capacity;
+
+	/*
+	 * \brief Copies of the equalities and inequalities, one for each
+	 *        additional certification thread.
+	 */
+	std::vector<System*> cert_eqs, cert_ineqs;
+
+	/*
+	 * \brief The certification threads (NULL in sequential mode).
+	 */
+	ThreadPool* cert_pool;
+
+	/*
+	 * \brief A cell submitted to certification.
+	 */
+	struct Candidate {
+		Candidate(Cell* cell, bool too_small, int n);
+
+		Cell* cell;
+
+		/* True if the cell cannot be bisected. */
+		bool too_small;
+
+		Certification cert;
+
+		/* Ready when the certification is over. */
+		std::future<void> done;
+	};
+
+	/*
+	 * \brief Candidates, in the order of submission.
+	 */
+	std::deque<Candidate*> candidates;
+
+	/*
+	 * \brief Output boxes (status and index in the COV) recorded but
+	 *        not yet returned by next().
+	 */
+	std::deque<std::pair<CovSolverData::BoxStatus,size_t> > outputs;
+
 	/*
 	 * \brief CPU running time used to obtain this manifold.
 	 */
@@ -371,6 +598,22 @@ protected:
 	 * \brief Number of cells of the previous call.
 	 */
 	unsigned int old_nb_cells;
+
+	/**
+	 * \brief Number of cells handled by the current search (for
+	 * the checks of the #time_limit).
+	 */
+	unsigned int nb_iter;
+
+	/**
+	 * \brief Next buffer size notified to the listener.
+	 */
+	unsigned int next_milestone;
+
+	/**
+	 * \brief True if interrupt() has been called.
+	 */
+	bool interrupted;
 };
 
 /*============================================ inline implementation ============================================ */
@@ -387,6 +630,18 @@ inline double Solver::get_nb_cells() const {
 	return get_data().nb_cells();
 }
 
+inline double Solver::get_current_time() const {
+	return time;
+}
+
+inline unsigned int Solver::get_current_nb_cells() const {
+	return nb_cells;
+}
+
+inline void Solver::interrupt() {
+	interrupted = true;
+}
+
 } // end namespace ibex
 
 #endif // __IBEX_SOLVER_H__
@@ -0,0 +1,86 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SolverListener.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_SOLVER_LISTENER_H__
+#define __IBEX_SOLVER_LISTENER_H__
+
+#include "ibex_CovSolverData.h"
+
+namespace ibex {
+
+class Solver;
+
+/**
+ * \ingroup solver
+ *
+ * \brief Observer of a solver.
+ *
+ * The callbacks are called by the solver during the search (see
+ * Solver::listener). They do nothing by default. A callback can
+ * query the solver (e.g., Solver::get_current_time(),
+ * Solver::get_current_nb_cells() or Solver::get_data()), change its
+ * time limit or stop the search with Solver::interrupt().
+ */
+class SolverListener {
+public:
+
+	/**
+	 * \brief Create the listener.
+	 *
+	 * \param period - number of cells between two calls to #cells_handled().
+	 */
+	SolverListener(unsigned int period=default_period);
+
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~SolverListener();
+
+	/**
+	 * \brief Called when a new output box is found.
+	 *
+	 * \param box    - the box (last box of Solver::get_data())
+	 * \param status - the status of the box (solution, boundary or unknown).
+	 */
+	virtual void box_found(Solver& solver, const IntervalVector& box, CovSolverData::BoxStatus status);
+
+	/**
+	 * \brief Called every #period cells.
+	 */
+	virtual void cells_handled(Solver& solver);
+
+	/**
+	 * \brief Called each time the size of the buffer reaches
+	 *        a new power of two.
+	 */
+	virtual void buffer_milestone(Solver& solver, unsigned int size);
+
+	/**
+	 * \brief Number of cells between two calls to #cells_handled().
+	 */
+	const unsigned int period;
+
+	/** Default period: 1000 cells. */
+	static constexpr unsigned int default_period = 1000;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline SolverListener::SolverListener(unsigned int period) : period(period>0? period : 1) { }
+
+inline SolverListener::~SolverListener() { }
+
+inline void SolverListener::box_found(Solver&, const IntervalVector&, CovSolverData::BoxStatus) { }
+
+inline void SolverListener::cells_handled(Solver&) { }
+
+inline void SolverListener::buffer_milestone(Solver&, unsigned int) { }
+
+} // end namespace ibex
+
+#endif // __IBEX_SOLVER_LISTENER_H__
@@ -0,0 +1,70 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpNewtonCache.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_BxpNewtonCache.h"
+
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+BxpNewtonCache::BxpNewtonCache(long id, int n, int nb_param, double reuse_ratio, bool reuse_jacobian) :
+		Bxp(id), reuse_ratio(reuse_ratio), reuse_jacobian(reuse_jacobian),
+		precond(n,n), precond_jacobian(n,n), jacobian_param(n, nb_param>0? nb_param : 1 /* unused */),
+		nb_reuse(0), ref_box(IntervalVector::empty(n+nb_param)) {
+
+}
+
+BxpNewtonCache* BxpNewtonCache::copy(const IntervalVector& box, const BoxProperties& prop) const {
+	BxpNewtonCache* c=new BxpNewtonCache(id, precond.nb_rows(), ref_box.size()-precond.nb_rows(), reuse_ratio, reuse_jacobian);
+	if (!ref_box.is_empty()) {
+		c->precond = precond;
+		if (reuse_jacobian) {
+			c->precond_jacobian = precond_jacobian;
+			c->jacobian_param = jacobian_param;
+		}
+		c->ref_box = ref_box;
+		c->update(BoxEvent(box,BoxEvent::CHANGE), prop);
+	}
+	return c;
+}
+
+void BxpNewtonCache::update(const BoxEvent& e, const BoxProperties& prop) {
+	if (!ref_box.is_empty() && !is_valid(e.box))
+		invalidate();
+}
+
+bool BxpNewtonCache::is_valid(const IntervalVector& box) const {
+	if (ref_box.is_empty() || box.is_empty()) return false;
+
+	assert(box.size()==ref_box.size());
+
+	for (int j=0; j<box.size(); j++) {
+		if (!box[j].is_subset(ref_box[j]))
+			return false;
+
+		if ((reuse_ratio==0 && ref_box[j]!=box[j])
+				|| ref_box[j].rel_distance(box[j])>reuse_ratio)
+			return false;
+	}
+	return true;
+}
+
+void BxpNewtonCache::set_ref_box(const IntervalVector& box) {
+	ref_box = box;
+}
+
+string BxpNewtonCache::to_string() const {
+	stringstream ss;
+	ss << '[' << id << "] BxpNewtonCache";
+	if (!ref_box.is_empty()) ss << " (" << nb_reuse << " reuse)";
+	return ss.str();
+}
+
+} /* namespace ibex */
@@ -0,0 +1,155 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpNewtonCache.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_BXP_NEWTON_CACHE_H__
+#define __IBEX_BXP_NEWTON_CACHE_H__
+
+#include "ibex_Bxp.h"
+#include "ibex_IntervalMatrix.h"
+#include "ibex_Matrix.h"
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Cache for the interval Newton iteration.
+ *
+ * This property stores the state of a Newton iteration (see #ibex::newton(...)
+ * and #ibex::inflating_newton(...)) computed on a "reference" box, namely:
+ * - the preconditioning matrix (the approximate inverse of the midpoint of the Jacobian)
+ * - optionally, the interval Jacobian matrix (and its preconditioned counterpart).
+ *
+ * Contrary to most properties, the value is inherited by sub-boxes
+ * so that, on a deep branch of the search tree, the preconditioner computed
+ * at some node is reused by its descendants.
+ *
+ * This is rigorous: any real matrix can be used to precondition the
+ * linear system and, by inclusion monotonicity, the Jacobian enclosure
+ * of the reference box is also an enclosure of the Jacobian on any sub-box.
+ * Only the sharpness is impacted: the state is therefore recomputed as soon as
+ * the current box is significantly smaller than the reference box.
+ */
+class BxpNewtonCache : public Bxp {
+public:
+
+	/**
+	 * \brief Build the property value.
+	 *
+	 * \param id             - The identifier of the property (typically
+	 *                         chosen by the contractor that requires it).
+	 * \param n              - The number of variables (also the number of equations)
+	 *                         Newton is applied on.
+	 * \param nb_param       - The number of parameters (0 if Newton is applied on all the
+	 *                         variables). The size of the boxes is n+nb_param.
+	 * \param reuse_ratio    - Indicates when a modification of the box is considered
+	 *                         as significant enough so that the state is recomputed.
+	 *                         The state is valid for a box included in the reference box,
+	 *                         and if the relative distance between both (see
+	 *                         Interval::rel_distance(...)) does not exceed this ratio.
+	 *                         E.g., the 0 value means "recompute as soon as the box has changed".
+	 * \param reuse_jacobian - Whether the interval Jacobian matrix is also stored. In this case,
+	 *                         the full Jacobian (instead of the Hansen matrix) is calculated.
+	 */
+	BxpNewtonCache(long id, int n, int nb_param=0, double reuse_ratio=default_reuse_ratio, bool reuse_jacobian=false);
+
+	/**
+	 * \brief Copy the property.
+	 *
+	 * The cached state is duplicated.
+	 */
+	virtual BxpNewtonCache* copy(const IntervalVector& box, const BoxProperties& prop) const;
+
+	/**
+	 * \brief Update the property after box modification.
+	 *
+	 * Invalidate the state if the new box is not close
+	 * enough to the reference box.
+	 */
+	virtual void update(const BoxEvent& event, const BoxProperties& prop);
+
+	/**
+	 * \brief To string
+	 */
+	virtual std::string to_string() const;
+
+	/**
+	 * \brief Whether the cached state can be used for a box.
+	 */
+	bool is_valid(const IntervalVector& box) const;
+
+	/**
+	 * \brief Set the reference box.
+	 *
+	 * To be called once the state has been computed on \a box.
+	 */
+	void set_ref_box(const IntervalVector& box);
+
+	/**
+	 * \brief Invalidate the cached state.
+	 */
+	void invalidate();
+
+	/**
+	 * \brief Ratio for considering the state as outdated.
+	 */
+	const double reuse_ratio;
+
+	/**
+	 * \brief Whether the Jacobian matrix is cached.
+	 */
+	const bool reuse_jacobian;
+
+	/**
+	 * \brief The preconditioning matrix.
+	 */
+	Matrix precond;
+
+	/**
+	 * \brief The preconditioned Jacobian matrix % variables.
+	 *
+	 * Only significant if #reuse_jacobian is true.
+	 */
+	IntervalMatrix precond_jacobian;
+
+	/**
+	 * \brief The Jacobian matrix % parameters.
+	 *
+	 * Only significant if #reuse_jacobian is true and Newton
+	 * is applied on a subset of variables.
+	 */
+	IntervalMatrix jacobian_param;
+
+	/**
+	 * \brief Number of times the state has been reused.
+	 */
+	unsigned int nb_reuse;
+
+	/**
+	 * Set to 0.5
+	 */
+	static constexpr double default_reuse_ratio = 0.5;
+
+protected:
+
+	/**
+	 * The box on which the state has been computed
+	 * (empty if there is no state).
+	 */
+	IntervalVector ref_box;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void BxpNewtonCache::invalidate() {
+	ref_box.set_empty();
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_BXP_NEWTON_CACHE_H__ */
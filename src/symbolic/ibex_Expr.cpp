@@ -24,6 +24,10 @@
 #include <stdio.h>
 #include <set>
 
+#ifndef _WIN32 // MinGW does not support mutex
+#include <mutex>
+#endif
+
 
 using namespace std;
 
@@ -172,6 +176,29 @@ pair<const ExprSymbol*, bool**> ExprIndex::symbol_mask() const {
 	return pair<const ExprSymbol*, bool**>(symbol, mask);
 }
 
+const ExprSymbol* ExprIndex::symbol_block(int& r, int& c, int& nb_rows, int& nb_cols) const {
+
+	const ExprSymbol* symbol=dynamic_cast<const ExprSymbol*>(&expr);
+
+	if (symbol) {
+		r=0;
+		c=0;
+	} else {
+		const ExprIndex* expr_index=dynamic_cast<const ExprIndex*>(&expr);
+		if (!expr_index) return NULL;
+		symbol=expr_index->symbol_block(r,c,nb_rows,nb_cols);
+		if (!symbol) return NULL;
+	}
+
+	// the index is relative to the block of the sub-expression
+	r += index.first_row();
+	c += index.first_col();
+	nb_rows = index.nb_rows();
+	nb_cols = index.nb_cols();
+
+	return symbol;
+}
+
 ExprNAryOp::ExprNAryOp(const Array<const ExprNode>& _args, const Dim& dim) :
 		ExprNode(max_height(_args)+1, nary_size(_args), dim),
 		args(_args), nb_args(_args.size()) {
@@ -229,6 +256,18 @@ NodeMap<const Variable*>& variables() {
 	return _variables;
 }
 
+// the map is shared by all the threads (symbols are created
+// and deleted during the construction of functions)
+#ifndef _WIN32
+std::mutex variables_mtx;
+
+#define LOCK variables_mtx.lock()
+#define UNLOCK variables_mtx.unlock()
+#else
+#define LOCK
+#define UNLOCK
+#endif
+
 }
 
 ExprSymbol::ExprSymbol(const Dim& dim) : ExprLeaf(dim),
@@ -249,6 +288,7 @@ const ExprSymbol& ExprSymbol::new_(const char* name, const Dim& dim) {
 }
 
 inline ExprSymbol::~ExprSymbol() {
+	LOCK;
 	if (variables().found(*this)) {
 		// before deleting me, associate the Variable
 		// with a new symbol.
@@ -258,19 +298,22 @@ inline ExprSymbol::~ExprSymbol() {
 		var->symbol = new ExprSymbol(name,dim);
 		variables().insert(*var->symbol, var);
 	}
+	UNLOCK;
 	free((char*) name);
 }
 
-Variable::Variable(const Dim& dim) : symbol(new ExprSymbol(dim))                                                   { variables().insert(*symbol,this); }
-Variable::Variable(const char* name) : symbol(new ExprSymbol(name,Dim::scalar()))                                  { variables().insert(*symbol,this); }
-Variable::Variable(const Dim& dim, const char* name) : symbol(new ExprSymbol(name, dim))                           { variables().insert(*symbol,this); }
-Variable::Variable(int n) : symbol(new ExprSymbol(Dim::col_vec(n)))                                                { variables().insert(*symbol,this); }
-Variable::Variable(int n, const char* name) : symbol(new ExprSymbol(name, Dim::col_vec(n)))                        { variables().insert(*symbol,this); }
-Variable::Variable(int m, int n) : symbol(new ExprSymbol(Dim::matrix(m,n)))                                        { variables().insert(*symbol,this); }
-Variable::Variable(int m, int n, const char* name) : symbol(new ExprSymbol(name, Dim::matrix(m,n)))                { variables().insert(*symbol,this); }
+Variable::Variable(const Dim& dim) : symbol(new ExprSymbol(dim))                                                   { LOCK; variables().insert(*symbol,this); UNLOCK; }
+Variable::Variable(const char* name) : symbol(new ExprSymbol(name,Dim::scalar()))                                  { LOCK; variables().insert(*symbol,this); UNLOCK; }
+Variable::Variable(const Dim& dim, const char* name) : symbol(new ExprSymbol(name, dim))                           { LOCK; variables().insert(*symbol,this); UNLOCK; }
+Variable::Variable(int n) : symbol(new ExprSymbol(Dim::col_vec(n)))                                                { LOCK; variables().insert(*symbol,this); UNLOCK; }
+Variable::Variable(int n, const char* name) : symbol(new ExprSymbol(name, Dim::col_vec(n)))                        { LOCK; variables().insert(*symbol,this); UNLOCK; }
+Variable::Variable(int m, int n) : symbol(new ExprSymbol(Dim::matrix(m,n)))                                        { LOCK; variables().insert(*symbol,this); UNLOCK; }
+Variable::Variable(int m, int n, const char* name) : symbol(new ExprSymbol(name, Dim::matrix(m,n)))                { LOCK; variables().insert(*symbol,this); UNLOCK; }
 
 Variable::~Variable()                                                                                              {
+	LOCK;
 	variables().erase(*symbol);
+	UNLOCK;
 
 	// no: don't delete the symbol that can live after the Variable.
 	// This is the case in particular with SystemFactory, where symbols
@@ -285,9 +328,11 @@ Variable::~Variable()
 Variable::operator const ExprSymbol&() const {
 	if (symbol->f) { // already used build new one.
 		// Note: it is Function's responsibility to delete the old symbol
+		LOCK;
 		variables().erase(*symbol);
 		symbol=new ExprSymbol(symbol->name, symbol->dim);
 		variables().insert(*symbol, this);
+		UNLOCK;
 	}
 	return *symbol;
 }
@@ -218,6 +218,18 @@ public:
 	 */
 	std::pair<const ExprSymbol*, bool**> symbol_mask() const;
 
+	/**
+	 * \brief The block of components of the symbol that are used.
+	 *
+	 * Same information as symbol_mask() but without building the mask
+	 * (whose size is the size of the symbol): the components are those
+	 * of the submatrix of the symbol starting at row \a r and column \a c,
+	 * with \a nb_rows rows and \a nb_cols columns.
+	 *
+	 * \return the symbol (NULL if this node is not an indexed symbol).
+	 */
+	const ExprSymbol* symbol_block(int& r, int& c, int& nb_rows, int& nb_cols) const;
+
 	static const ExprIndex& new_(const ExprNode& subexpr, const DoubleIndex& index);
 
 private:
@@ -12,6 +12,9 @@
 
 #include "ibex_ExprVisitor.h"
 #include "ibex_NodeMap.h"
+#include "ibex_ExprHashCons.h"
+
+#include <functional>
 
 namespace ibex {
 
@@ -23,14 +26,38 @@ namespace ibex {
  *
  * The expression can be a tree or, partially, a DAG.
  *
+ * Structurally equal subexpressions are detected by hash-consing
+ * (see #ExprHashCons), so that the transformation is linear in
+ * the size of the expression.
+ *
+ * The same object can be used to transform several expressions:
+ * nodes are then also shared between the results.
  */
 class Expr2DAG : public virtual ExprVisitor {
 public:
 	/**
 	 * \brief Transform y to a DAG
+	 *
+	 * The result is a copy of y where the symbols old_x are
+	 * replaced by new_x.
 	 */
 	const ExprNode& transform(const Array<const ExprSymbol>& old_x, const Array<const ExprNode>& new_x, const ExprNode& y);
 
+	/**
+	 * \brief Share the nodes of y with the nodes built so far.
+	 *
+	 * Contrary to transform, y is not copied: a node of y is kept
+	 * if there is no equal node already and if its subnodes are kept.
+	 * Nodes of y that are replaced are not deleted (they are found
+	 * in #peer).
+	 */
+	const ExprNode& share(const ExprNode& y);
+
+	/**
+	 * \brief The node representing each node met so far in the DAG.
+	 */
+	NodeMap<const ExprNode*> peer;
+
 protected:
 	void visit(const ExprNode& e);
 	void visit(const ExprIndex& i);
@@ -77,15 +104,33 @@ protected:
 	void visit(const ExprCeil& e);
 	void visit(const ExprSaw& e);
 
-	NodeMap<const ExprNode*> peer;
+	/*
+	 * Representative of e (e is visited first if necessary).
+	 */
+	const ExprNode& get(const ExprNode& e);
 
-	Array<const ExprNode> comps(const ExprNAryOp& e);
+	/*
+	 * Set the representative of e, where the subnodes of e are
+	 * already visited:
+	 * - if a node equal to e (after replacing its subnodes) exists, this node;
+	 * - if "same" is true (all the subnodes are kept) and if we are not
+	 *   copying, e itself;
+	 * - otherwise, a new node obtained by calling "new_node".
+	 */
+	void build(const ExprNode& e, bool same, std::function<const ExprNode&()> new_node);
+
+	Array<const ExprNode> comps(const ExprNAryOp& e, bool& same);
 
 	template<class T>
 	void visit_unary(const T& e);
 
 	template<class T>
 	void visit_binary(const T& e);
+
+	ExprHashCons hc;
+
+	// true during transform
+	bool copy;
 };
 
 } // namespace ibex
@@ -47,6 +47,39 @@ void ExprDiff::add_grad_expr(const ExprNode& node, const ExprNode& _expr_) {
 		grad.insert(node, &_expr_);
 }
 
+void ExprDiff::add_grad_comp(const ExprNode& node, int i, const ExprNode& _expr_) {
+
+	vector<const ExprNode*>& comps=grad_comp[node];
+
+	if (comps.empty()) comps.resize(node.dim.vec_size(), NULL);
+
+	if (comps[i])
+		comps[i]= & (*comps[i] +_expr_);
+	else
+		comps[i]= &_expr_;
+}
+
+void ExprDiff::gather_grad_comps(const ExprNode& node) {
+
+	vector<const ExprNode*>& comps=grad_comp[node];
+	int n=comps.size();
+	const ExprNode* zero=NULL; // shared by all the missing components
+
+	Array<const ExprNode> tab(n);
+	for (int i=0; i<n; i++) {
+		if (comps[i])
+			tab.set_ref(i,*comps[i]);
+		else {
+			if (!zero) zero=&ZERO;
+			tab.set_ref(i,*zero);
+		}
+	}
+
+	grad_comp.erase(node);
+
+	add_grad_expr(node, ExprVector::new_(tab, node.dim.type()==Dim::ROW_VECTOR? ExprVector::ROW : ExprVector::COL));
+}
+
 const ExprNode& ExprDiff::diff(const ExprNode& y, const Array<const ExprSymbol>& x) {
 	const ExprNode* res;
 
@@ -59,22 +92,35 @@ const ExprNode& ExprDiff::diff(const ExprNode& y, const Array<const ExprSymbol>&
 		int m=y.dim.vec_size();
 		Array<const ExprNode> a(m);
 
-		for (int i=0; i<m; i++) { // y.dim.vec_size() == vec->nb_args()
-			const ExprNode& argi=y[i]; // temporary node creation
-			a.set_ref(i,gradient(argi,x));
-			delete &argi;
+		const ExprVector* vec=dynamic_cast<const ExprVector*>(&y);
+
+		if (vec && vec->nb_args==m && old_symbols) {
+			// Differentiate directly each component, so that the
+			// whole vector is not visited for every component.
+			// Note: in this mode (copy), the nodes of y are not
+			// destroyed so that components can share subexpressions.
+			for (int i=0; i<m; i++)
+				a.set_ref(i,gradient(vec->arg(i),x));
+		} else {
+			for (int i=0; i<m; i++) { // y.dim.vec_size() == vec->nb_args()
+				const ExprNode& argi=y[i]; // temporary node creation
+				a.set_ref(i,gradient(argi,x));
+				delete &argi;
+			}
 		}
 		res=&ExprVector::new_col(a);
 	} else {
 		throw ExprDiffException("differentiation of matrix-valued functions");
 	}
 
-	return res->simplify();
+	// the derivative contains many repetitions
+	return ExprSimplify(true).simplify(*res);
 }
 
 const ExprNode& ExprDiff::gradient(const ExprNode& y, const Array<const ExprSymbol>& x) {
 
 	grad.clean();
+	grad_comp.clean();
 	groots.clear();
 
 	ExprSubNodes nodes(y);
@@ -89,6 +135,10 @@ const ExprNode& ExprDiff::gradient(const ExprNode& y, const Array<const ExprSymb
 
 	// visit nodes in topological order
 	for (int i=0; i<n; i++) {
+		// all the fathers are visited: the adjoints of the
+		// components can be gathered (except for symbols)
+		if (grad_comp.found(nodes[i]) && !dynamic_cast<const ExprSymbol*>(&nodes[i]))
+			gather_grad_comps(nodes[i]);
 		visit(nodes[i]);
 	}
 
@@ -99,7 +149,7 @@ const ExprNode& ExprDiff::gradient(const ExprNode& y, const Array<const ExprSymb
 	// cleared after.
 	for (int i=0; i<x.size(); i++) {
 
-		if (!grad.found(x[i]))
+		if (!grad.found(x[i]) && !grad_comp.found(x[i]))
 			// this symbol does not appear in the expression -> null derivative
 			grad.insert(x[i], &ExprConstant::new_matrix(Matrix::zeros(x[i].dim.nb_rows(),x[i].dim.nb_cols())));
 	}
@@ -120,8 +170,19 @@ const ExprNode& ExprDiff::gradient(const ExprNode& y, const Array<const ExprSymb
 			case Dim::ROW_VECTOR:
 			case Dim::COL_VECTOR:
 				{
+					const ExprNode* zero=NULL; // shared by all the null partial derivatives
 					for (int j=0; j<d.vec_size(); j++) {
-						dX.set_ref(k,(*grad[x[i]])[j]);
+						const ExprNode* dxj=grad.found(x[i]) ? &(*grad[x[i]])[j] : NULL;
+
+						if (grad_comp.found(x[i]) && grad_comp[x[i]][j])
+							dxj = dxj ? &(*dxj + *grad_comp[x[i]][j]) : grad_comp[x[i]][j];
+
+						if (!dxj) {
+							if (!zero) zero=&ZERO;
+							dxj=zero;
+						}
+
+						dX.set_ref(k,*dxj);
 						groots.push_back(&dX[k]);
 						k++;
 					}
@@ -230,6 +291,11 @@ void ExprDiff::visit(const ExprIndex& i) {
 		return;
 	}
 
+	if (i.expr.dim.is_vector() && i.index.one_elt()) {
+		add_grad_comp(i.expr, i.expr.dim.type()==Dim::ROW_VECTOR? i.index.first_col() : i.index.first_row(), *grad[i]);
+		return;
+	}
+
 	vector<const ExprNode*> row_vec;
 
 	int n=i.expr.dim.nb_rows();
@@ -284,7 +350,14 @@ void ExprDiff::visit(const ExprSymbol& x) {
 	// is not a symbol in "x" (a symbol we
 	// diff). So, to simplify, we add it in the
 	// root array.
-	groots.push_back(grad[x]);
+	if (grad.found(x))
+		groots.push_back(grad[x]);
+
+	if (grad_comp.found(x)) {
+		const vector<const ExprNode*>& comps=grad_comp[x];
+		for (vector<const ExprNode*>::const_iterator it=comps.begin(); it!=comps.end(); it++)
+			if (*it) groots.push_back(*it);
+	}
 }
 
 void ExprDiff::visit(const ExprConstant& c) {
@@ -423,15 +496,15 @@ void ExprDiff::visit(const ExprTrans& e) { add_grad_expr(e.expr, transpose(*grad
 void ExprDiff::visit(const ExprSign& e)  { add_grad_expr(e.expr, (*grad[e])*chi(abs(e.expr),ALL_REALS,ZERO)); }
 void ExprDiff::visit(const ExprAbs& e)   { add_grad_expr(e.expr, (*grad[e])*sign(e.expr)); }
 void ExprDiff::visit(const ExprSqr& e)   { add_grad_expr(e.expr, (*grad[e])*Interval(2.0)*e.expr); }
-void ExprDiff::visit(const ExprSqrt& e)  { add_grad_expr(e.expr, (*grad[e])*Interval(0.5)/sqrt(e.expr)); }
-void ExprDiff::visit(const ExprExp& e)   { add_grad_expr(e.expr, (*grad[e])*exp(e.expr)); }
+void ExprDiff::visit(const ExprSqrt& e)  { add_grad_expr(e.expr, (*grad[e])*Interval(0.5)/e); }
+void ExprDiff::visit(const ExprExp& e)   { add_grad_expr(e.expr, (*grad[e])*e); }
 void ExprDiff::visit(const ExprLog& e)   { add_grad_expr(e.expr, (*grad[e])/e.expr ); }
 void ExprDiff::visit(const ExprCos& e)   { add_grad_expr(e.expr,-(*grad[e])*sin(e.expr) ); }
 void ExprDiff::visit(const ExprSin& e)   { add_grad_expr(e.expr, (*grad[e])*cos(e.expr) ); }
-void ExprDiff::visit(const ExprTan& e)   { add_grad_expr(e.expr, (*grad[e])*(1.0+sqr(tan(e.expr)))); }
+void ExprDiff::visit(const ExprTan& e)   { add_grad_expr(e.expr, (*grad[e])*(1.0+sqr(e))); }
 void ExprDiff::visit(const ExprCosh& e)  { add_grad_expr(e.expr, (*grad[e])*sinh(e.expr)); }
 void ExprDiff::visit(const ExprSinh& e)  { add_grad_expr(e.expr, (*grad[e])*cosh(e.expr)); }
-void ExprDiff::visit(const ExprTanh& e)  { add_grad_expr(e.expr, (*grad[e])*(1.0-sqr(tanh(e.expr)))); }
+void ExprDiff::visit(const ExprTanh& e)  { add_grad_expr(e.expr, (*grad[e])*(1.0-sqr(e))); }
 void ExprDiff::visit(const ExprAcos& e)  { add_grad_expr(e.expr,-(*grad[e])/sqrt(1.0-sqr(e.expr))); }
 void ExprDiff::visit(const ExprAsin& e)  { add_grad_expr(e.expr, (*grad[e])/sqrt(1.0-sqr(e.expr))); }
 void ExprDiff::visit(const ExprAtan& e)  { add_grad_expr(e.expr, (*grad[e])/(1.0+sqr(e.expr))); }
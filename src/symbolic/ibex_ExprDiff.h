@@ -132,11 +132,29 @@ protected:
 
 	void add_grad_expr(const ExprNode& node, const ExprNode& expr);
 
+	/*
+	 * Add expr to the adjoint of the ith component of a vector node.
+	 */
+	void add_grad_comp(const ExprNode& node, int i, const ExprNode& expr);
+
+	/*
+	 * Gather the adjoints of the components of a vector node
+	 * into a single vector (added to grad[node]).
+	 */
+	void gather_grad_comps(const ExprNode& node);
+
 	const Array<const ExprSymbol>* old_symbols;
 	const Array<const ExprSymbol>* new_symbols;
 
 	NodeMap<const ExprNode*> grad;
 
+	// Adjoints of the components of vector nodes that are indexed one by one
+	// (typically, a vector of variables x and the nodes x[i]). They are
+	// kept apart so that each occurrence of x[i] costs O(1) instead of
+	// creating a vector of zeros of the size of x. For a symbol w.r.t. which
+	// we are differentiating, they directly give the partial derivatives.
+	NodeMap<std::vector<const ExprNode*> > grad_comp;
+
 	// ======== Information for cleanup only =========
 	// Roots of the expression calculated **before simplification**
 	// This also includes the "grad" node of symbols w.r.t. which
@@ -0,0 +1,194 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprHashCons.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_ExprHashCons.h"
+#include "ibex_Expr.h"
+
+#include <cstring>
+#include <typeinfo>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * The subnodes of a node (none for a leaf).
+ */
+class Subnodes {
+public:
+	Subnodes(const ExprNode& e) : nary(NULL), size(0) {
+		const ExprBinaryOp* b;
+		const ExprUnaryOp* u;
+		const ExprIndex* i;
+
+		if ((b=dynamic_cast<const ExprBinaryOp*>(&e))) {
+			sub[0]=&b->left;
+			sub[1]=&b->right;
+			size=2;
+		} else if ((u=dynamic_cast<const ExprUnaryOp*>(&e))) {
+			sub[0]=&u->expr;
+			size=1;
+		} else if ((i=dynamic_cast<const ExprIndex*>(&e))) {
+			sub[0]=&i->expr;
+			size=1;
+		} else if ((nary=dynamic_cast<const ExprNAryOp*>(&e))) {
+			size=nary->nb_args;
+		}
+	}
+
+	const ExprNode& operator[](int i) const {
+		return nary ? nary->arg(i) : *sub[i];
+	}
+
+	const ExprNAryOp* nary;
+	const ExprNode* sub[2];
+	int size;
+};
+
+inline void combine(size_t& h, size_t v) {
+	h ^= v + 0x9e3779b9 + (h<<6) + (h>>2);
+}
+
+inline void combine(size_t& h, const Interval& x) {
+	combine(h, std::hash<double>()(x.lb()));
+	combine(h, std::hash<double>()(x.ub()));
+}
+
+size_t hash_domain(const Domain& d) {
+	size_t h=0;
+	switch(d.dim.type()) {
+	case Dim::SCALAR:
+		combine(h, d.i());
+		break;
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR:
+		for (int i=0; i<d.v().size(); i++)
+			combine(h, d.v()[i]);
+		break;
+	default:
+		for (int i=0; i<d.m().nb_rows(); i++)
+			for (int j=0; j<d.m().nb_cols(); j++)
+				combine(h, d.m()[i][j]);
+	}
+	return h;
+}
+
+/*
+ * A node that is only equal to itself.
+ */
+bool is_unique(const ExprNode& e) {
+	if (dynamic_cast<const ExprSymbol*>(&e)) return true;
+	const ExprConstant* c=dynamic_cast<const ExprConstant*>(&e);
+	// a reference may be modified afterwards
+	return c && c->get().is_reference;
+}
+
+/*
+ * Image of a subnode.
+ */
+inline const ExprNode* image(const ExprNode& e, const NodeMap<const ExprNode*>* peer) {
+	return peer && peer->found(e) ? (*peer)[e] : &e;
+}
+
+} // end anonymous namespace
+
+size_t ExprHashCons::hash(const ExprNode& e, const NodeMap<const ExprNode*>* peer) const {
+
+	if (is_unique(e)) return std::hash<long>()(e.id);
+
+	size_t h=typeid(e).hash_code();
+
+	const ExprConstant* c;
+	const ExprIndex* i;
+	const ExprVector* v;
+	const ExprApply* a;
+	const ExprPower* p;
+	const ExprGenericBinaryOp* gb;
+	const ExprGenericUnaryOp* gu;
+
+	if ((c=dynamic_cast<const ExprConstant*>(&e)))
+		combine(h, hash_domain(c->get()));
+	else if ((i=dynamic_cast<const ExprIndex*>(&e))) {
+		combine(h, i->index.first_row());
+		combine(h, i->index.last_row());
+		combine(h, i->index.first_col());
+		combine(h, i->index.last_col());
+	}
+	else if ((v=dynamic_cast<const ExprVector*>(&e)))
+		combine(h, v->orient);
+	else if ((a=dynamic_cast<const ExprApply*>(&e)))
+		combine(h, std::hash<const Function*>()(&a->func));
+	else if ((p=dynamic_cast<const ExprPower*>(&e)))
+		combine(h, p->expon);
+	else if ((gb=dynamic_cast<const ExprGenericBinaryOp*>(&e)))
+		combine(h, std::hash<string>()(gb->name));
+	else if ((gu=dynamic_cast<const ExprGenericUnaryOp*>(&e)))
+		combine(h, std::hash<string>()(gu->name));
+
+	Subnodes sub(e);
+	for (int k=0; k<sub.size; k++)
+		combine(h, std::hash<long>()(image(sub[k],peer)->id));
+
+	return h;
+}
+
+bool ExprHashCons::equal(const ExprNode& e, const NodeMap<const ExprNode*>* peer, const ExprNode& n) const {
+
+	if (&e==&n) return true;
+
+	if (typeid(e)!=typeid(n) || is_unique(e) || is_unique(n)) return false;
+
+	if (dynamic_cast<const ExprConstant*>(&e))
+		return ((const ExprConstant&) e).get()==((const ExprConstant&) n).get();
+	else if (dynamic_cast<const ExprIndex*>(&e)) {
+		if (!(((const ExprIndex&) e).index==((const ExprIndex&) n).index)) return false;
+	}
+	else if (dynamic_cast<const ExprVector*>(&e)) {
+		if (((const ExprVector&) e).orient!=((const ExprVector&) n).orient) return false;
+	}
+	else if (dynamic_cast<const ExprApply*>(&e)) {
+		if (&((const ExprApply&) e).func!=&((const ExprApply&) n).func) return false;
+	}
+	else if (dynamic_cast<const ExprPower*>(&e)) {
+		if (((const ExprPower&) e).expon!=((const ExprPower&) n).expon) return false;
+	}
+	else if (dynamic_cast<const ExprGenericBinaryOp*>(&e)) {
+		if (strcmp(((const ExprGenericBinaryOp&) e).name,((const ExprGenericBinaryOp&) n).name)!=0) return false;
+	}
+	else if (dynamic_cast<const ExprGenericUnaryOp*>(&e)) {
+		if (strcmp(((const ExprGenericUnaryOp&) e).name,((const ExprGenericUnaryOp&) n).name)!=0) return false;
+	}
+
+	Subnodes sub_e(e);
+	Subnodes sub_n(n);
+
+	if (sub_e.size!=sub_n.size) return false;
+
+	for (int k=0; k<sub_e.size; k++)
+		if (image(sub_e[k],peer)!=&sub_n[k]) return false;
+
+	return true;
+}
+
+const ExprNode* ExprHashCons::find(const ExprNode& e, const NodeMap<const ExprNode*>* peer) const {
+	auto range=table.equal_range(hash(e,peer));
+	for (auto it=range.first; it!=range.second; it++) {
+		if (equal(e,peer,*it->second))
+			return it->second;
+	}
+	return NULL;
+}
+
+void ExprHashCons::insert(const ExprNode& e) {
+	assert(!find(e));
+	table.insert(make_pair(hash(e,NULL),&e));
+}
+
+} // namespace ibex
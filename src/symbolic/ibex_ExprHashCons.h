@@ -0,0 +1,105 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprHashCons.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_EXPR_HASH_CONS_H__
+#define __IBEX_EXPR_HASH_CONS_H__
+
+#include "ibex_NodeMap.h"
+
+#include <unordered_map>
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Table of structurally unique expression nodes (hash-consing).
+ *
+ * Two nodes are structurally equal if they have the same type, the
+ * same attributes (constant value, index, exponent, function, etc.)
+ * and the same subnodes. Since subnodes are themselves registered
+ * before their fathers, subnodes are compared by address and the
+ * structural hash of a node is calculated in constant time from
+ * the identifiers of its subnodes. Looking up a node is therefore
+ * in O(1) (on average) and building a maximally shared DAG from
+ * an expression is linear.
+ *
+ * Symbols and constants that are references (see ExprConstant::new_)
+ * are only equal to themselves.
+ *
+ * The table does not own the nodes.
+ */
+class ExprHashCons {
+public:
+	/**
+	 * \brief Look for a registered node equal to e.
+	 *
+	 * The subnodes of e are first substituted by their image in
+	 * \a peer, if any. This allows to look for a node before
+	 * building it.
+	 *
+	 * \return NULL if there is no such node.
+	 */
+	const ExprNode* find(const ExprNode& e, const NodeMap<const ExprNode*>& peer) const;
+
+	/**
+	 * \brief Look for a registered node equal to e.
+	 *
+	 * \return NULL if there is no such node.
+	 */
+	const ExprNode* find(const ExprNode& e) const;
+
+	/**
+	 * \brief Register a node.
+	 *
+	 * \pre No node equal to e is registered and the
+	 *      subnodes of e are registered.
+	 */
+	void insert(const ExprNode& e);
+
+	/**
+	 * \brief Number of registered nodes.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Remove all the nodes.
+	 */
+	void clear();
+
+protected:
+	size_t hash(const ExprNode& e, const NodeMap<const ExprNode*>* peer) const;
+
+	bool equal(const ExprNode& e, const NodeMap<const ExprNode*>* peer, const ExprNode& n) const;
+
+	const ExprNode* find(const ExprNode& e, const NodeMap<const ExprNode*>* peer) const;
+
+	std::unordered_multimap<size_t, const ExprNode*> table;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline const ExprNode* ExprHashCons::find(const ExprNode& e, const NodeMap<const ExprNode*>& peer) const {
+	return find(e, &peer);
+}
+
+inline const ExprNode* ExprHashCons::find(const ExprNode& e) const {
+	return find(e, NULL);
+}
+
+inline int ExprHashCons::size() const {
+	return (int) table.size();
+}
+
+inline void ExprHashCons::clear() {
+	table.clear();
+}
+
+} // namespace ibex
+
+#endif // __IBEX_EXPR_HASH_CONS_H__
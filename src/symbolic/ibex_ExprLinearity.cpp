@@ -15,6 +15,24 @@ using namespace std;
 
 namespace ibex {
 
+namespace {
+
+/*
+ * Component-wise absolute value of a domain.
+ */
+Domain abs_domain(const Domain& d) {
+	Domain res(d.dim);
+	switch(d.dim.type()) {
+	case Dim::SCALAR:     res.i()=abs(d.i()); break;
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR: res.v()=abs(d.v()); break;
+	case Dim::MATRIX:     res.m()=abs(d.m()); break;
+	}
+	return res;
+}
+
+}
+
 ExprLinearity::ExprLinearity(const Array<const ExprSymbol> x, const ExprNode& y) :
 		n(0) {
 
@@ -195,24 +213,31 @@ void ExprLinearity::visit(const ExprMul& e) {
 
 	Domain non_linear(Dim::scalar()); // =ALL_REALS
 
-	// can be in O(n^4) :-(
-	for (int i=0; i<n+1; i++) {
-		for (int j=0; j<n+1; j++) {
-
-			if (i<n && j<n) {
-				// we introduce the "non_linear" coefficient so that
-				// a non-null term x_i*x_j will have its corresponding
-				// entry set to [-oo,oo]
-				Domain prod=non_linear*l[i]*r[j];
-				(*d)[i] = (*d)[i]+prod; //TODO: implement += in TemplateDomain
-				(*d)[j] = (*d)[j]+prod;
-			} else {
-				if (i<n) (*d)[i] = (*d)[i] + l[i]*r[n];
-				else if (j<n) (*d)[j] = (*d)[j] + (l[n]*r[j]);
-				else (*d)[n] = l[n]*r[n];
-			}
-		}
+	// Sums of the absolute values of the coefficients of the variables.
+	// An entry of the sum is zero iff the corresponding entry of all the
+	// coefficients is zero (no cancellation can occur).
+	Domain abs_l(e.left.dim);
+	Domain abs_r(e.right.dim);
+	abs_l.clear();
+	abs_r.clear();
+	for (int i=0; i<n; i++) {
+		abs_l = abs_l + abs_domain(l[i]);
+		abs_r = abs_r + abs_domain(r[i]);
+	}
+
+	// we introduce the "non_linear" coefficient so that
+	// a non-null term x_i*x_j (for any j) will have its
+	// corresponding entry set to [-oo,oo]. Using the sums
+	// instead of all the pairs (i,j) gives the same non-linear
+	// entries in O(n) instead of O(n^2).
+	Domain nl_l=non_linear*abs_l;
+
+	for (int i=0; i<n; i++) {
+		(*d)[i] = (non_linear*l[i])*abs_r + nl_l*r[i]; //TODO: implement += in TemplateDomain
+		(*d)[i] = (*d)[i] + l[i]*r[n];
+		(*d)[i] = (*d)[i] + l[n]*r[i];
 	}
+	(*d)[n] = l[n]*r[n];
 
 	for (int i=0; i<n; i++) {
 		if (type==CONSTANT && !(*d)[i].is_zero()) type=LINEAR;
@@ -15,7 +15,7 @@
 
 using namespace std;
 
-#define CLONE_VEC vector<pair<DoubleIndex, const ExprNode*> >
+#define CLONE_VEC map<DoubleIndex, const ExprNode*>
 
 namespace ibex {
 
@@ -73,9 +73,15 @@ bool is_identity(const ExprNode& e) {
 
 } // end anonymous namespace
 
+ExprSimplify::ExprSimplify(bool hash_cons) : hash_cons(hash_cons), dag(NULL) {
+
+}
+
 const ExprNode& ExprSimplify::simplify(const ExprNode& e) {
 	ExprSubNodes old_nodes(e);
 
+	if (hash_cons) dag = new Expr2DAG();
+
 	idx = DoubleIndex::all(e.dim);
 	e.acceptVisitor(*this);
 	const ExprNode& result = get(e,idx);
@@ -111,6 +117,18 @@ const ExprNode& ExprSimplify::simplify(const ExprNode& e) {
 	}
 	/*...............................*/
 
+	// nodes replaced or created by hash-consing
+	if (dag) {
+		for (IBEX_NODE_MAP(const ExprNode*)::const_iterator it=dag->peer.begin(); it!=dag->peer.end(); it++) {
+			if (!all_nodes.found(*it->first))
+				all_nodes.insert(*it->first,true);
+			if (!all_nodes.found(*it->second))
+				all_nodes.insert(*it->second,true);
+		}
+		delete dag;
+		dag = NULL;
+	}
+
 	for (IBEX_NODE_MAP(bool)::const_iterator it=all_nodes.begin(); it!=all_nodes.end(); it++) {
 		if (/* auto-cleanup, so remove this ----> !old_nodes.found(*it->first) && */
 			!dynamic_cast<const ExprSymbol*>(it->first) &&
@@ -151,7 +169,7 @@ void ExprSimplify::insert(const ExprNode& e, const ExprNode& e2) {
 	if (!idx_clones.found(e)) {
 		idx_clones.insert(e,new CLONE_VEC());
 	}
-	idx_clones[e]->push_back(pair<DoubleIndex,const ExprNode*>(idx,&e2));
+	idx_clones[e]->insert(pair<DoubleIndex,const ExprNode*>(idx,dag? &dag->share(e2) : &e2));
 }
 
 const ExprNode& ExprSimplify::get(const ExprNode& e, const DoubleIndex& idx2) {
@@ -161,18 +179,17 @@ const ExprNode& ExprSimplify::get(const ExprNode& e, const DoubleIndex& idx2) {
 	}
 
 	CLONE_VEC& v=*(idx_clones[e]);
-	unsigned int i=0;
-	while (i<v.size() && v[i].first!=idx2)
-		i++;
-	if (i==v.size()) { // idx2 not found in the clone list
+	CLONE_VEC::const_iterator it=v.find(idx2);
+	if (it==v.end()) { // idx2 not found in the clone list
 		DoubleIndex old_idx=idx;
 		idx=idx2;
 		e.acceptVisitor(*this);
 		idx=old_idx;
-		assert(v.back().first==idx2);
+		it=v.find(idx2);
+		assert(it!=v.end());
 	}
 
-	return *v[i].second;
+	return *it->second;
 }
 
 void ExprSimplify::visit(const ExprVector& e) {
@@ -182,8 +199,12 @@ void ExprSimplify::visit(const ExprVector& e) {
 	bool all_cst=true;
 	bool all_same=true;
 
+	// If each argument is a single column (resp. row), e.g., a vector
+	// of scalars, we jump directly to the first indexed argument
+	// (otherwise simplifying all the components of a vector is quadratic).
 	if (e.row_vector()) {
 		int c=0;
+		if (e.nb_args==e.dim.nb_cols()) c=i=idx.first_col();
 		while (c<=idx.last_col()) {
 			int n=e.arg(i).dim.nb_cols();
 			int first_col=idx.first_col()-c;
@@ -202,6 +223,7 @@ void ExprSimplify::visit(const ExprVector& e) {
 		}
 	} else {
 		int r=0;
+		if (e.nb_args==e.dim.nb_rows()) r=i=idx.first_row();
 		while (r<=idx.last_row()) {
 			int n=e.arg(i).dim.nb_rows();
 			int first_row=idx.first_row()-r;
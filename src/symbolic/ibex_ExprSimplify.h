@@ -15,8 +15,10 @@
 #include "ibex_NodeMap.h"
 #include "ibex_DoubleIndex.h"
 #include "ibex_Domain.h"
+#include "ibex_Expr2DAG.h"
 
 #include <vector>
+#include <map>
 #include <utility>
 #include <functional>
 
@@ -25,6 +27,18 @@ namespace ibex {
 class ExprSimplify : public ExprVisitor {
 public:
 
+	/**
+	 * \brief Build the simplifier.
+	 *
+	 * \param hash_cons - if true, structurally equal subexpressions
+	 *                    are merged as soon as they are built (see
+	 *                    #Expr2DAG::share()), so that the result is
+	 *                    a maximally shared DAG. This is recommended
+	 *                    for large generated expressions (typically,
+	 *                    derivatives) that contain many repetitions.
+	 */
+	ExprSimplify(bool hash_cons=false);
+
 	/**
 	 * \warning The function cleanup all unused nodes which
 	 * may include e itself (so the node "e" may not exist
@@ -84,7 +98,14 @@ protected:
 	void visit(const ExprSaw& e);
 
 	DoubleIndex idx;
-	NodeMap<std::vector<std::pair<DoubleIndex, const ExprNode*> >*> idx_clones;
+	// clones of each node, for each index (a map, because the same node,
+	// typically a large vector, may be indexed many times)
+	NodeMap<std::map<DoubleIndex, const ExprNode*>*> idx_clones;
+
+	bool hash_cons;
+
+	// the DAG built by hash-consing (only during simplify, if hash_cons is true)
+	Expr2DAG* dag;
 
 	void insert(const ExprNode& e, const ExprNode& e2);
 	const ExprNode& get(const ExprNode& e, const DoubleIndex&);
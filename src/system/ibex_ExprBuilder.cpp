@@ -0,0 +1,270 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprBuilder.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_ExprBuilder.h"
+#include "ibex_Timer.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+inline void combine(size_t& h, size_t v) {
+	h ^= v + 0x9e3779b9 + (h<<6) + (h>>2);
+}
+
+} // end anonymous namespace
+
+size_t ExprBuilder::RecordHash::operator()(const Record& r) const {
+	size_t h=r.op;
+	combine(h, std::hash<int>()(r.a));
+	combine(h, std::hash<int>()(r.b));
+	return h;
+}
+
+size_t ExprBuilder::IntervalHash::operator()(const pair<double,double>& x) const {
+	size_t h=std::hash<double>()(x.first);
+	combine(h, std::hash<double>()(x.second));
+	return h;
+}
+
+Interval ExprBuilder::eval(Op op, const Interval& x, const Interval& y, int expon) {
+	// note: the namespace is necessary because the
+	// functions are hidden by the methods of the class.
+	switch(op) {
+	case ADD:   return x+y;
+	case SUB:   return x-y;
+	case MUL:   return x*y;
+	case DIV:   return x/y;
+	case MAX:   return ibex::max(x,y);
+	case MIN:   return ibex::min(x,y);
+	case ATAN2: return ibex::atan2(x,y);
+	case POWER: return ibex::pow(x,expon);
+	case MINUS: return -x;
+	case ABS:   return ibex::abs(x);
+	case SQR:   return ibex::sqr(x);
+	case SQRT:  return ibex::sqrt(x);
+	case EXP:   return ibex::exp(x);
+	case LOG:   return ibex::log(x);
+	case COS:   return ibex::cos(x);
+	case SIN:   return ibex::sin(x);
+	case TAN:   return ibex::tan(x);
+	case ACOS:  return ibex::acos(x);
+	case ASIN:  return ibex::asin(x);
+	case ATAN:  return ibex::atan(x);
+	case COSH:  return ibex::cosh(x);
+	case SINH:  return ibex::sinh(x);
+	case TANH:  return ibex::tanh(x);
+	default:    assert(false); return Interval::empty_set();
+	}
+}
+
+ExprBuilder::ExprBuilder(SystemFactory& fac) : fac(fac) {
+	fac.init_args();
+
+	for (int i=0; i<fac.input_args.size(); i++)
+		symbol.insert(fac.input_args[i], i);
+}
+
+ExprBuilder::Node ExprBuilder::record(Op op, int a, int b) {
+	Record r;
+	r.op=op;
+	r.a=a;
+	r.b=b;
+
+	pair<unordered_map<Record,int,RecordHash>::iterator,bool> res=table.insert(make_pair(r,(int) tape.size()));
+
+	if (res.second) {
+		tape.push_back(r);
+		sys_img.push_back(NULL);
+		ctr_img.push_back(NULL);
+	}
+
+	return Node(res.first->second);
+}
+
+ExprBuilder::Node ExprBuilder::var(const ExprSymbol& x) {
+	if (!symbol.found(x)) ibex_error("[ExprBuilder] unknown variable");
+	if (!x.dim.is_scalar()) ibex_error("[ExprBuilder] variable is not scalar");
+	return record(VAR, symbol[x], -1);
+}
+
+ExprBuilder::Node ExprBuilder::var(const ExprSymbol& x, int i) {
+	if (!symbol.found(x)) ibex_error("[ExprBuilder] unknown variable");
+	if (!x.dim.is_vector()) ibex_error("[ExprBuilder] variable is not a vector");
+	if (i<0 || i>=x.dim.vec_size()) ibex_error("[ExprBuilder] index out of bounds");
+	return record(VAR, symbol[x], i);
+}
+
+ExprBuilder::Node ExprBuilder::var(const ExprSymbol& x, int i, int j) {
+	if (!symbol.found(x)) ibex_error("[ExprBuilder] unknown variable");
+	if (!x.dim.is_matrix()) ibex_error("[ExprBuilder] variable is not a matrix");
+	if (i<0 || i>=x.dim.nb_rows() || j<0 || j>=x.dim.nb_cols()) ibex_error("[ExprBuilder] index out of bounds");
+	return record(VAR, symbol[x], i*x.dim.nb_cols()+j);
+}
+
+ExprBuilder::Node ExprBuilder::cst(const Interval& c) {
+	pair<unordered_map<pair<double,double>,int,IntervalHash>::iterator,bool> res=
+			cst_table.insert(make_pair(make_pair(c.lb(),c.ub()),(int) csts.size()));
+
+	if (res.second) csts.push_back(c);
+
+	return record(CST, res.first->second, -1);
+}
+
+ExprBuilder::Node ExprBuilder::binary(Op op, Node l, Node r) {
+	assert(l.i>=0 && r.i>=0);
+
+	const Record& left=tape[l.i];
+	const Record& right=tape[r.i];
+
+	if (left.op==CST && right.op==CST)
+		return cst(eval(op, csts[left.a], csts[right.a], 0));
+
+	// neutral elements
+	if (right.op==CST) {
+		const Interval& c=csts[right.a];
+		if ((op==ADD || op==SUB) && c==Interval::zero()) return l;
+		if ((op==MUL || op==DIV) && c==Interval::one()) return l;
+	} else if (left.op==CST) {
+		const Interval& c=csts[left.a];
+		if (op==ADD && c==Interval::zero()) return r;
+		if (op==MUL && c==Interval::one()) return r;
+	}
+
+	return record(op, l.i, r.i);
+}
+
+ExprBuilder::Node ExprBuilder::unary(Op op, Node x, int expon) {
+	assert(x.i>=0);
+
+	const Record& arg=tape[x.i];
+
+	if (arg.op==CST)
+		return cst(eval(op, csts[arg.a], Interval::zero(), expon));
+
+	return record(op, x.i, op==POWER? expon : -1);
+}
+
+const ExprNode& ExprBuilder::emit(int e, const Array<const ExprSymbol>& x, vector<const ExprNode*>& img, vector<int>& created) {
+
+	// Iterative depth-first search. A node is built when it is
+	// found a second time on the top of the stack (its subnodes
+	// have been built in the meantime).
+	stack.push_back(e);
+
+	while (!stack.empty()) {
+		int k=stack.back();
+
+		if (img[k]) {
+			stack.pop_back();
+			continue;
+		}
+
+		const Record& r=tape[k];
+
+		bool ready=true;
+		if (r.op!=VAR && r.op!=CST) {
+			if (!img[r.a]) { stack.push_back(r.a); ready=false; }
+			if (r.op!=POWER && r.b!=-1 && !img[r.b]) { stack.push_back(r.b); ready=false; }
+		}
+
+		if (!ready) continue;
+
+		stack.pop_back();
+
+		const ExprNode* node;
+
+		switch(r.op) {
+		case VAR: {
+			const ExprSymbol& s=x[r.a];
+			if (r.b==-1)
+				node=&s;
+			else if (s.dim.is_vector())
+				node=&s[r.b];
+			else
+				node=&s[DoubleIndex::one_elt(s.dim, r.b/s.dim.nb_cols(), r.b%s.dim.nb_cols())];
+			break;
+		}
+		case CST:   node=&ExprConstant::new_scalar(csts[r.a]); break;
+		case ADD:   node=&ExprAdd::new_(*img[r.a], *img[r.b]); break;
+		case SUB:   node=&ExprSub::new_(*img[r.a], *img[r.b]); break;
+		case MUL:   node=&ExprMul::new_(*img[r.a], *img[r.b]); break;
+		case DIV:   node=&ExprDiv::new_(*img[r.a], *img[r.b]); break;
+		case MAX:   node=&ExprMax::new_(*img[r.a], *img[r.b]); break;
+		case MIN:   node=&ExprMin::new_(*img[r.a], *img[r.b]); break;
+		case ATAN2: node=&ExprAtan2::new_(*img[r.a], *img[r.b]); break;
+		case POWER: node=&ibex::pow(*img[r.a], r.b); break; // x^2 -> sqr(x), see pow()
+		case MINUS: node=&ExprMinus::new_(*img[r.a]); break;
+		case ABS:   node=&ExprAbs::new_  (*img[r.a]); break;
+		case SQR:   node=&ExprSqr::new_  (*img[r.a]); break;
+		case SQRT:  node=&ExprSqrt::new_ (*img[r.a]); break;
+		case EXP:   node=&ExprExp::new_  (*img[r.a]); break;
+		case LOG:   node=&ExprLog::new_  (*img[r.a]); break;
+		case COS:   node=&ExprCos::new_  (*img[r.a]); break;
+		case SIN:   node=&ExprSin::new_  (*img[r.a]); break;
+		case TAN:   node=&ExprTan::new_  (*img[r.a]); break;
+		case ACOS:  node=&ExprAcos::new_ (*img[r.a]); break;
+		case ASIN:  node=&ExprAsin::new_ (*img[r.a]); break;
+		case ATAN:  node=&ExprAtan::new_ (*img[r.a]); break;
+		case COSH:  node=&ExprCosh::new_ (*img[r.a]); break;
+		case SINH:  node=&ExprSinh::new_ (*img[r.a]); break;
+		default:    node=&ExprTanh::new_ (*img[r.a]); break;
+		}
+
+		img[k]=node;
+		created.push_back(k);
+	}
+
+	return *img[e];
+}
+
+void ExprBuilder::add_ctr(Node e, CmpOp op) {
+	assert(e.i>=0);
+
+	fac.nb_simplified_ctrs++;
+
+	Array<const ExprSymbol> ctr_args(fac.input_args.size());
+	varcopy(fac.input_args,ctr_args);
+
+	const ExprNode& ctr_expr=emit(e.i, ctr_args, ctr_img, created);
+
+	// reset the images of the constraint nodes
+	// (the symbols of the next constraint are different)
+	for (vector<int>::const_iterator it=created.begin(); it!=created.end(); ++it)
+		ctr_img[*it]=NULL;
+	created.clear();
+
+	// compiled when the system is built
+	fac.add_pending_ctr(ctr_args, ctr_expr, op, false);
+
+	fac.f_ctrs.push_back(&emit(e.i, fac.sys_args, sys_img, created));
+	created.clear();
+}
+
+void ExprBuilder::add_goal(Node e) {
+	assert(e.i>=0);
+
+	Array<const ExprSymbol> goal_args(fac.input_args.size());
+	varcopy(fac.input_args,goal_args);
+
+	const ExprNode& goal_expr=emit(e.i, goal_args, ctr_img, created);
+
+	for (vector<int>::const_iterator it=created.begin(); it!=created.end(); ++it)
+		ctr_img[*it]=NULL;
+	created.clear();
+
+	Timer timer;
+	timer.start();
+	fac.goal = new Function(goal_args, goal_expr);
+	timer.stop();
+	fac.compile_time += timer.get_time();
+}
+
+} // end namespace ibex
@@ -0,0 +1,301 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprBuilder.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_EXPR_BUILDER_H__
+#define __IBEX_EXPR_BUILDER_H__
+
+#include "ibex_SystemFactory.h"
+
+#include <vector>
+#include <unordered_map>
+
+namespace ibex {
+
+/**
+ * \ingroup system
+ *
+ * \brief Streaming builder of scalar constraints for a system factory.
+ *
+ * This class is an alternative to the construction of expressions with
+ * the operators of ExprNode (or to the generation of a Minibex text that
+ * is parsed afterwards) for large models generated by code.
+ *
+ * Operations are recorded in a flat array of small records (the "tape")
+ * which grows by amortized reallocations and where a node is referred to
+ * by a handle (#Node). No expression node is created until a constraint
+ * is added to the factory with #add_ctr. Equal operations are recorded only
+ * once (hash-consing) and operations on constants are evaluated, so that
+ * the expressions sent to the factory are already simplified and maximally
+ * shared, including between different constraints.
+ *
+ * When a constraint is added, its sub-DAG is directly turned into the
+ * expression of the constraint function and into the expression of the
+ * system function (see System::f_ctrs). Nothing else is copied nor simplified,
+ * neither when the constraint is added nor when the system is built
+ * (unless some constraints are also added to the factory by the usual way).
+ *
+ * Example:
+ * \code
+ * const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(n));
+ * SystemFactory fac;
+ * fac.add_var(x);
+ * ExprBuilder b(fac);
+ * for (int i=0; i<n-1; i++)
+ *     b.add_ctr(b.sub(b.sqr(b.var(x,i)),b.var(x,i+1)), EQ);
+ * System sys(fac);
+ * \endcode
+ *
+ * \note Only scalar operations are supported. Vector or matrix variables
+ *       are used through their components (see #var(const ExprSymbol&,int)).
+ */
+class ExprBuilder {
+public:
+
+	/**
+	 * \brief Handle of a node recorded by a builder.
+	 */
+	class Node {
+	public:
+		/** \brief Undefined node. */
+		Node() : i(-1) { }
+
+	private:
+		friend class ExprBuilder;
+		explicit Node(int i) : i(i) { }
+		int i;
+	};
+
+	/**
+	 * \brief Create a builder for a factory.
+	 *
+	 * \pre All the variables must have been added to the factory.
+	 */
+	explicit ExprBuilder(SystemFactory& fac);
+
+	/**
+	 * \brief Scalar variable.
+	 */
+	Node var(const ExprSymbol& x);
+
+	/**
+	 * \brief ith component of a vector variable.
+	 */
+	Node var(const ExprSymbol& x, int i);
+
+	/**
+	 * \brief (i,j) component of a matrix variable.
+	 */
+	Node var(const ExprSymbol& x, int i, int j);
+
+	/**
+	 * \brief Constant.
+	 */
+	Node cst(const Interval& c);
+
+	/** \brief Addition. */
+	Node add(Node l, Node r);
+
+	/** \brief Subtraction. */
+	Node sub(Node l, Node r);
+
+	/** \brief Multiplication. */
+	Node mul(Node l, Node r);
+
+	/** \brief Division. */
+	Node div(Node l, Node r);
+
+	/** \brief Maximum. */
+	Node max(Node l, Node r);
+
+	/** \brief Minimum. */
+	Node min(Node l, Node r);
+
+	/** \brief Arctangent (2 arguments). */
+	Node atan2(Node l, Node r);
+
+	/** \brief Integer power. */
+	Node pow(Node x, int expon);
+
+	/** \brief Opposite. */
+	Node minus(Node x);
+
+	/** \brief Absolute value. */
+	Node abs(Node x);
+
+	/** \brief Square. */
+	Node sqr(Node x);
+
+	/** \brief Square root. */
+	Node sqrt(Node x);
+
+	/** \brief Exponential. */
+	Node exp(Node x);
+
+	/** \brief Logarithm. */
+	Node log(Node x);
+
+	/** \brief Cosine. */
+	Node cos(Node x);
+
+	/** \brief Sine. */
+	Node sin(Node x);
+
+	/** \brief Tangent. */
+	Node tan(Node x);
+
+	/** \brief Arccosine. */
+	Node acos(Node x);
+
+	/** \brief Arcsine. */
+	Node asin(Node x);
+
+	/** \brief Arctangent. */
+	Node atan(Node x);
+
+	/** \brief Hyperbolic cosine. */
+	Node cosh(Node x);
+
+	/** \brief Hyperbolic sine. */
+	Node sinh(Node x);
+
+	/** \brief Hyperbolic tangent. */
+	Node tanh(Node x);
+
+	/**
+	 * \brief Add the constraint e op 0 to the factory.
+	 */
+	void add_ctr(Node e, CmpOp op);
+
+	/**
+	 * \brief Set the goal function of the factory.
+	 */
+	void add_goal(Node e);
+
+	/**
+	 * \brief Number of distinct nodes recorded so far.
+	 */
+	int size() const;
+
+protected:
+
+	/*
+	 * Operation codes.
+	 */
+	typedef enum { VAR, CST, ADD, SUB, MUL, DIV, MAX, MIN, ATAN2, POWER,
+		MINUS, ABS, SQR, SQRT, EXP, LOG, COS, SIN, TAN, ACOS, ASIN, ATAN,
+		COSH, SINH, TANH } Op;
+
+	/*
+	 * A recorded operation. For VAR, a is the number of the
+	 * symbol and b the component (-1 for a scalar symbol). For CST,
+	 * a is the index of the value in csts. For POWER, b is the
+	 * exponent. Otherwise, a and b are the operands (b=-1 for
+	 * a unary operation).
+	 */
+	struct Record {
+		Op op;
+		int a;
+		int b;
+		bool operator==(const Record& r) const { return op==r.op && a==r.a && b==r.b; }
+	};
+
+	struct RecordHash {
+		size_t operator()(const Record& r) const;
+	};
+
+	struct IntervalHash {
+		size_t operator()(const std::pair<double,double>& x) const;
+	};
+
+	/*
+	 * Evaluation of an operation on constants.
+	 */
+	static Interval eval(Op op, const Interval& x, const Interval& y, int expon);
+
+	/*
+	 * Record an operation (if not already done).
+	 */
+	Node record(Op op, int a, int b);
+
+	/*
+	 * Record a binary (resp. unary) operation after
+	 * evaluation of constants.
+	 */
+	Node binary(Op op, Node l, Node r);
+	Node unary(Op op, Node x, int expon=0);
+
+	/*
+	 * Create the expression of the node e, with variables x.
+	 * img contains the expressions already created (entries of
+	 * newly created nodes are set and appended to the "created" list).
+	 */
+	const ExprNode& emit(int e, const Array<const ExprSymbol>& x, std::vector<const ExprNode*>& img, std::vector<int>& created);
+
+	SystemFactory& fac;
+
+	// number of each symbol in the factory
+	NodeMap<int> symbol;
+
+	// the tape
+	std::vector<Record> tape;
+
+	// values of constants
+	std::vector<Interval> csts;
+
+	// for hash-consing
+	std::unordered_map<Record,int,RecordHash> table;
+	std::unordered_map<std::pair<double,double>,int,IntervalHash> cst_table;
+
+	// expressions in the system function (persistent)
+	std::vector<const ExprNode*> sys_img;
+
+	// expressions in the current constraint function
+	std::vector<const ExprNode*> ctr_img;
+
+	// working structures of emit (DFS)
+	std::vector<int> stack;
+	std::vector<int> created;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline ExprBuilder::Node ExprBuilder::add(Node l, Node r)   { return binary(ADD,l,r); }
+inline ExprBuilder::Node ExprBuilder::sub(Node l, Node r)   { return binary(SUB,l,r); }
+inline ExprBuilder::Node ExprBuilder::mul(Node l, Node r)   { return binary(MUL,l,r); }
+inline ExprBuilder::Node ExprBuilder::div(Node l, Node r)   { return binary(DIV,l,r); }
+inline ExprBuilder::Node ExprBuilder::max(Node l, Node r)   { return binary(MAX,l,r); }
+inline ExprBuilder::Node ExprBuilder::min(Node l, Node r)   { return binary(MIN,l,r); }
+inline ExprBuilder::Node ExprBuilder::atan2(Node l, Node r) { return binary(ATAN2,l,r); }
+inline ExprBuilder::Node ExprBuilder::pow(Node x, int expon) {
+	if (expon==1) return x;
+	if (expon==2) return unary(SQR,x);
+	return unary(POWER,x,expon);
+}
+inline ExprBuilder::Node ExprBuilder::minus(Node x) { return unary(MINUS,x); }
+inline ExprBuilder::Node ExprBuilder::abs(Node x)   { return unary(ABS,x);   }
+inline ExprBuilder::Node ExprBuilder::sqr(Node x)   { return unary(SQR,x);   }
+inline ExprBuilder::Node ExprBuilder::sqrt(Node x)  { return unary(SQRT,x);  }
+inline ExprBuilder::Node ExprBuilder::exp(Node x)   { return unary(EXP,x);   }
+inline ExprBuilder::Node ExprBuilder::log(Node x)   { return unary(LOG,x);   }
+inline ExprBuilder::Node ExprBuilder::cos(Node x)   { return unary(COS,x);   }
+inline ExprBuilder::Node ExprBuilder::sin(Node x)   { return unary(SIN,x);   }
+inline ExprBuilder::Node ExprBuilder::tan(Node x)   { return unary(TAN,x);   }
+inline ExprBuilder::Node ExprBuilder::acos(Node x)  { return unary(ACOS,x);  }
+inline ExprBuilder::Node ExprBuilder::asin(Node x)  { return unary(ASIN,x);  }
+inline ExprBuilder::Node ExprBuilder::atan(Node x)  { return unary(ATAN,x);  }
+inline ExprBuilder::Node ExprBuilder::cosh(Node x)  { return unary(COSH,x);  }
+inline ExprBuilder::Node ExprBuilder::sinh(Node x)  { return unary(SINH,x);  }
+inline ExprBuilder::Node ExprBuilder::tanh(Node x)  { return unary(TANH,x);  }
+
+inline int ExprBuilder::size() const {
+	return (int) tape.size();
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_EXPR_BUILDER_H__
@@ -57,7 +57,7 @@ CmpOp norm(CmpOp op) {
 
 } // end namespace
 
-NormalizedSystem::NormalizedSystem(const System& sys, double eps, bool extended) : original_sys_id(sys.id) {
+NormalizedSystem::NormalizedSystem(const System& sys, double eps, bool extended, bool share) : original_sys_id(sys.id) {
 
 	int nb_arg;
 	int k=0; // index of components of sys.f_ctrs
@@ -122,6 +122,47 @@ NormalizedSystem::NormalizedSystem(const System& sys, double eps, bool extended)
 
 		const ExprNode& f_cpy = ExprCopy().copy(sys.f_ctrs.args(), args, sys.f_ctrs.expr());
 
+		// Note: building f_cpy[k]-u directly would calculate the size of the
+		// whole f_cpy DAG for each k (see ExprBinaryOp). So the nodes f_cpy-U
+		// and L-f_cpy, where U and L gather the bounds of all the equalities,
+		// are built once and the constraints are components of them (the index
+		// is then pushed through the subtraction by simplify()).
+		const ExprNode* fu_all=NULL;
+		const ExprNode* fl_all=NULL;
+
+		if (eps>0) {
+			IntervalVector U(sys.f_ctrs.image_dim(), Interval::zero());
+			IntervalVector L(sys.f_ctrs.image_dim(), Interval::zero());
+			bool eq=false;
+
+			for (int c=0; c<sys.nb_ctr; c++) {
+				const Dim& dim=sys.ctrs[c].f.expr().dim;
+				if (sys.ctrs[c].op==EQ) {
+					Domain l(dim);
+					Domain u(dim);
+					Domain rhs(dim);
+					rhs.clear();
+					set_lb_ub(rhs, l, u, eps);
+					for (int i=0; i<dim.nb_rows(); i++)
+						for (int j=0; j<dim.nb_cols(); j++) {
+							U[k]=u[i][j].i();
+							L[k]=l[i][j].i();
+							k++;
+						}
+					eq=true;
+				} else
+					k+=dim.size();
+			}
+			k=0;
+
+			if (eq) {
+				const ExprConstant& cu=f_cpy.dim.is_scalar()? ExprConstant::new_scalar(U[0]) : ExprConstant::new_vector(U,false);
+				const ExprConstant& cl=f_cpy.dim.is_scalar()? ExprConstant::new_scalar(L[0]) : ExprConstant::new_vector(L,false);
+				fu_all = &(f_cpy-cu);
+				fl_all = &(cl-f_cpy);
+			}
+		}
+
 		for (int c=0; c<sys.nb_ctr; c++) {
 
 			const Function& fc=sys.ctrs[c].f;
@@ -162,23 +203,28 @@ NormalizedSystem::NormalizedSystem(const System& sys, double eps, bool extended)
 
 				for (int i=0; i<fc.expr().dim.nb_rows(); i++) {
 					for (int j=0; j<fc.expr().dim.nb_cols(); j++) {
-						_f_ctr.push_back(&(f_cpy[k]-ExprConstant::new_(u[i][j])));
+						_f_ctr.push_back(&(*fu_all)[k]);
 						_ops.push_back(LEQ);
-						_f_ctr.push_back(&(ExprConstant::new_(l[i][j])-f_cpy[k]));
+						_f_ctr.push_back(&(*fl_all)[k]);
 						_ops.push_back(LEQ);
 						k++;
 					}
 				}
 			} else {
 
-				Array<const ExprSymbol> argsc(nb_arg);
-				varcopy(args, argsc);
-				const ExprNode* _fc=&ExprCopy().copy(fc.args(), argsc, fc.expr());
+				if (share && !extended && norm(opc)==opc) {
+					// the constraint is unchanged
+					_ctrs.push_back(new NumConstraint(fc,opc,false));
+				} else {
+					Array<const ExprSymbol> argsc(nb_arg);
+					varcopy(args, argsc);
+					const ExprNode* _fc=&ExprCopy().copy(fc.args(), argsc, fc.expr());
 
-				if (opc==GT || opc==GEQ) {
-					_fc = & (- (*_fc)); // reverse the inequality
+					if (opc==GT || opc==GEQ) {
+						_fc = & (- (*_fc)); // reverse the inequality
+					}
+					_ctrs.push_back(new NumConstraint(argsc,ExprCtr(*_fc,norm(opc))));
 				}
-				_ctrs.push_back(new NumConstraint(argsc,ExprCtr(*_fc,norm(opc))));
 
 				for (int j=0; j<fc.expr().dim.size(); j++) {
 					if (opc==LT || opc==LEQ || opc==EQ)
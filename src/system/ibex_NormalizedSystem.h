@@ -39,8 +39,12 @@ public:
 	 * \param eps - if >0, transforms an equation f=0 into two
 	 *              inequalities: f<=eps and -f<=eps. If eps==0
 	 *              equalities are duplicated.
+	 * \param share - if true (and if the system is not extended), the
+	 *              constraints that are left unchanged by the normalization
+	 *              share their function with \a sys instead of being copied.
+	 *              In this case, \a sys must outlive this system.
 	 */
-	explicit NormalizedSystem(const System& sys, double eps=0, bool extended=false);
+	explicit NormalizedSystem(const System& sys, double eps=0, bool extended=false, bool share=false);
 
 	/** Default epsilon applied to equations: 1e-8. */
 	static constexpr double default_eps_h = 1e-08;
@@ -10,12 +10,14 @@
 
 #include "ibex_System.h"
 #include "ibex_SystemFactory.h"
+#include "ibex_SystemBinary.h"
 #include "ibex_SyntaxError.h"
 #include "ibex_UnknownFileException.h"
 #include "ibex_ExprCopy.h"
 #include "ibex_Expr2Minibex.h"
 #include "ibex_P_Struct.h"
 #include "ibex_Domain.h"
+#include "ibex_Timer.h"
 
 #include <stdio.h>
 #include <sstream>
@@ -78,7 +80,13 @@ System::System() : id(next_id()), nb_var(0), nb_ctr(0), goal(NULL), ops(NULL), b
 System::System(const char* filename) : id(next_id()), nb_var(0), nb_ctr(0), goal(NULL), ops(NULL), box(1) /* tmp */ {
 	FILE *fd;
 	if ((fd = fopen(filename, "r")) == NULL) throw UnknownFileException(filename);
-	load(fd);
+	if (SystemBinary::has_signature(fd)) {
+		fclose(fd);
+		SystemBinary::read(filename, *this);
+	} else {
+		rewind(fd);
+		load(fd);
+	}
 }
 
 System::System(int n, const char* syntax) : id(next_id()), nb_var(n), /* NOT TMP (required by parser) */
@@ -169,6 +177,10 @@ std::string System::minibex(bool human) const {
 	return s.str();
 }
 
+void System::save(const char* filename) const {
+	SystemBinary::write(filename, *this);
+}
+
 std::ostream& operator<<(std::ostream& os, const System& sys) {
 
 	os << "variables: " << endl << "  ";
@@ -206,6 +218,11 @@ void System::load(FILE* fd) {
 	LOCK;
 
 	ibexin = fd;
+	// the buffer of the lexer still refers to the previous (closed) file
+	ibexrestart(ibexin);
+
+	Timer timer;
+	timer.start();
 
 	try {
 		parser::pstruct = new parser::P_StructSystem(*this);
@@ -225,9 +242,17 @@ void System::load(FILE* fd) {
 
 	fclose(fd);
 
+	timer.stop();
+	load_times.parse = timer.get_time() - load_times.simplify - load_times.compile - load_times.build;
+
 	UNLOCK;
 }
 
+void System::set_sparse() {
+	for (int i=0; i<ctrs.size(); i++)
+		ctrs[i].set_sparse();
+}
+
 System::~System() {
 
 	if (goal) delete goal;
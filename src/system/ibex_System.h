@@ -49,6 +49,9 @@ public:
 
 	/**
 	 * \brief Load a system from a file.
+	 *
+	 * The file is either a Minibex file or a binary
+	 * (precompiled) file generated by #save().
 	 */
 	System(const char* filename);
 
@@ -213,6 +216,27 @@ public:
 	 */
 	std::string minibex(bool human=true) const;
 
+	/**
+	 * \brief Save the system in a binary (precompiled) file.
+	 *
+	 * The expressions are saved once parsed and simplified: loading
+	 * the file with System(filename) is much faster than loading
+	 * the Minibex file. See SystemBinary.
+	 */
+	void save(const char* filename) const;
+
+	/**
+	 * \brief Switch to sparse mode.
+	 *
+	 * Build the local form of each constraint, i.e., the constraint
+	 * compiled over its own variables only (see NumConstraint::set_sparse()).
+	 * Contractors built afterwards from the constraints (e.g., CtcHC4)
+	 * only gather/scatter the variables of each constraint from/into
+	 * the box. This makes the cost of a constraint independent from the
+	 * number of variables, for large systems with local constraints.
+	 */
+	void set_sparse();
+
 	/**
 	 * \brief Identifying number.
 	 */
@@ -263,6 +287,33 @@ public:
 	 * this array is zero-sized. */
 	Array<NumConstraint> ctrs;
 
+	/**
+	 * \brief Times (in seconds, see Timer) of the phases of the construction.
+	 *
+	 * For benchmarking purposes.
+	 *
+	 * \note These are processor times: if the constraints are built by
+	 *       several threads (see SystemFactory::set_nb_threads), the times
+	 *       of all the threads are added.
+	 */
+	struct LoadTimes {
+		LoadTimes() : parse(0), simplify(0), compile(0), build(0) { }
+		/** Lexing, parsing and generation of the expressions
+		 * (0 if the system is not loaded from a Minibex file). */
+		double parse;
+		/** Simplification of the expressions. */
+		double simplify;
+		/** Compilation of the functions (goal, constraints and f_ctrs). */
+		double compile;
+		/** Remaining work (copy of the expressions, etc.). */
+		double build;
+	};
+
+	/**
+	 * Times of the construction of this system.
+	 */
+	LoadTimes load_times;
+
 protected:
 	/** Uninitialized system */
 	System();
@@ -278,7 +329,9 @@ private:
 
 	// initialize f and ops from the constraints in ctrs,
 	// once *all* the other fields are set (including args and nb_ctr).
-	void init_f_ctrs(const std::vector<const ExprNode*>& fac_f_ctrs);
+	// If simplify is false, the expressions are assumed to be already
+	// simplified (see ExprBuilder).
+	void init_f_ctrs(const std::vector<const ExprNode*>& fac_f_ctrs, bool simplify=true);
 };
 
 std::ostream& operator<<(std::ostream&, const System&);
@@ -0,0 +1,639 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SystemBinary.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_SystemBinary.h"
+#include "ibex_UnknownFileException.h"
+#include "ibex_ExprVisitor.h"
+#include "ibex_ExprCopy.h"
+#include "ibex_Expr.h"
+#include "ibex_Domain.h"
+#include "ibex_Timer.h"
+
+#include <fstream>
+#include <vector>
+#include <string.h>
+#include <stdint.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include <iterator>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+const unsigned int SystemBinary::FORMAT_VERSION = 1;
+
+const size_t SystemBinary::SIGNATURE_LENGTH = 21;
+const char* SystemBinary::SIGNATURE = "IBEX COMPILED SYSTEM";
+
+namespace {
+
+/*
+ * Operation codes of the nodes.
+ */
+typedef enum {
+	SYMBOL, CONSTANT, INDEX, VECTOR, CHI,
+	GEN_BINARY, ADD, MUL, SUB, DIV, MAX, MIN, ATAN2,
+	GEN_UNARY, MINUS, TRANS, SIGN, ABS, POWER, SQR, SQRT, EXP, LOG,
+	COS, SIN, TAN, COSH, SINH, TANH, ACOS, ASIN, ATAN, ACOSH, ASINH, ATANH,
+	FLOOR, CEIL, SAW
+} Opcode;
+
+/*================================== writing ==================================*/
+
+void write_pos_int(ofstream& f, uint32_t x) {
+	f.write((char*) &x, sizeof(uint32_t));
+}
+
+void write_int(ofstream& f, int32_t x) {
+	f.write((char*) &x, sizeof(int32_t));
+}
+
+void write_double(ofstream& f, double x) {
+	f.write((char*) &x, sizeof(x));
+}
+
+void write_string(ofstream& f, const char* s) {
+	f.write(s, (strlen(s)+1)*sizeof(char));
+}
+
+void write_interval(ofstream& f, const Interval& x) {
+	write_double(f, x.lb());
+	write_double(f, x.ub());
+}
+
+void write_dim(ofstream& f, const Dim& dim) {
+	write_pos_int(f, dim.nb_rows());
+	write_pos_int(f, dim.nb_cols());
+}
+
+void write_domain(ofstream& f, const Domain& d) {
+	write_dim(f, d.dim);
+	switch(d.dim.type()) {
+	case Dim::SCALAR:
+		write_interval(f, d.i());
+		break;
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR:
+		for (int i=0; i<d.dim.vec_size(); i++)
+			write_interval(f, d.v()[i]);
+		break;
+	case Dim::MATRIX:
+		for (int i=0; i<d.dim.nb_rows(); i++)
+			for (int j=0; j<d.dim.nb_cols(); j++)
+				write_interval(f, d.m()[i][j]);
+		break;
+	}
+}
+
+/*
+ * Write the nodes of the expression of a function, from
+ * the leaves to the root (the reverse order of f.nodes).
+ */
+class ExprWriter : public ExprVisitor {
+public:
+	ExprWriter(ofstream& f, const Function& func) : f(f), func(func) { }
+
+	void write() {
+		write_pos_int(f, func.nb_nodes());
+		for (int i=func.nb_nodes()-1; i>=0; i--)
+			func.node(i).acceptVisitor(*this);
+	}
+
+protected:
+
+	// position of a node in the file
+	uint32_t pos(const ExprNode& e) {
+		return func.nb_nodes()-1-func.nodes.rank(e);
+	}
+
+	void nary(Opcode op, const ExprNAryOp& e) {
+		write_pos_int(f, op);
+		write_pos_int(f, e.nb_args);
+		for (int i=0; i<e.nb_args; i++)
+			write_pos_int(f, pos(e.arg(i)));
+	}
+
+	void binary(Opcode op, const ExprBinaryOp& e) {
+		write_pos_int(f, op);
+		write_pos_int(f, pos(e.left));
+		write_pos_int(f, pos(e.right));
+	}
+
+	void unary(Opcode op, const ExprUnaryOp& e) {
+		write_pos_int(f, op);
+		write_pos_int(f, pos(e.expr));
+	}
+
+	void visit(const ExprSymbol& e) {
+		write_pos_int(f, SYMBOL);
+		write_pos_int(f, e.key);
+	}
+
+	void visit(const ExprConstant& e) {
+		write_pos_int(f, CONSTANT);
+		write_domain(f, e.get());
+	}
+
+	void visit(const ExprIndex& e) {
+		write_pos_int(f, INDEX);
+		write_pos_int(f, pos(e.expr));
+		write_pos_int(f, e.index.first_row());
+		write_pos_int(f, e.index.last_row());
+		write_pos_int(f, e.index.first_col());
+		write_pos_int(f, e.index.last_col());
+	}
+
+	void visit(const ExprVector& e) {
+		nary(VECTOR, e);
+		write_pos_int(f, e.orient==ExprVector::ROW ? 0 : 1);
+	}
+
+	void visit(const ExprApply& e) {
+		ibex_error("[SystemBinary]: cannot save function applications (not supported)");
+	}
+
+	void visit(const ExprChi& e) { nary(CHI, e); }
+
+	void visit(const ExprGenericBinaryOp& e) {
+		binary(GEN_BINARY, e);
+		write_string(f, e.name);
+	}
+
+	void visit(const ExprAdd& e)   { binary(ADD, e); }
+	void visit(const ExprMul& e)   { binary(MUL, e); }
+	void visit(const ExprSub& e)   { binary(SUB, e); }
+	void visit(const ExprDiv& e)   { binary(DIV, e); }
+	void visit(const ExprMax& e)   { binary(MAX, e); }
+	void visit(const ExprMin& e)   { binary(MIN, e); }
+	void visit(const ExprAtan2& e) { binary(ATAN2, e); }
+
+	void visit(const ExprGenericUnaryOp& e) {
+		unary(GEN_UNARY, e);
+		write_string(f, e.name);
+	}
+
+	void visit(const ExprPower& e) {
+		unary(POWER, e);
+		write_int(f, e.expon);
+	}
+
+	void visit(const ExprMinus& e) { unary(MINUS, e); }
+	void visit(const ExprTrans& e) { unary(TRANS, e); }
+	void visit(const ExprSign& e)  { unary(SIGN, e); }
+	void visit(const ExprAbs& e)   { unary(ABS, e); }
+	void visit(const ExprSqr& e)   { unary(SQR, e); }
+	void visit(const ExprSqrt& e)  { unary(SQRT, e); }
+	void visit(const ExprExp& e)   { unary(EXP, e); }
+	void visit(const ExprLog& e)   { unary(LOG, e); }
+	void visit(const ExprCos& e)   { unary(COS, e); }
+	void visit(const ExprSin& e)   { unary(SIN, e); }
+	void visit(const ExprTan& e)   { unary(TAN, e); }
+	void visit(const ExprCosh& e)  { unary(COSH, e); }
+	void visit(const ExprSinh& e)  { unary(SINH, e); }
+	void visit(const ExprTanh& e)  { unary(TANH, e); }
+	void visit(const ExprAcos& e)  { unary(ACOS, e); }
+	void visit(const ExprAsin& e)  { unary(ASIN, e); }
+	void visit(const ExprAtan& e)  { unary(ATAN, e); }
+	void visit(const ExprAcosh& e) { unary(ACOSH, e); }
+	void visit(const ExprAsinh& e) { unary(ASINH, e); }
+	void visit(const ExprAtanh& e) { unary(ATANH, e); }
+	void visit(const ExprFloor& e) { unary(FLOOR, e); }
+	void visit(const ExprCeil& e)  { unary(CEIL, e); }
+	void visit(const ExprSaw& e)   { unary(SAW, e); }
+
+	ofstream& f;
+	const Function& func;
+};
+
+/*
+ * Write the name, the expression and the
+ * differential (if calculated) of a function.
+ */
+void write_function(ofstream& f, const Function& func, const Function* df) {
+	write_string(f, func.name);
+	ExprWriter(f, func).write();
+	write_pos_int(f, df ? 1 : 0);
+}
+
+/*================================== reading ==================================*/
+
+/*
+ * The content of a file, mapped in memory.
+ */
+class MappedFile {
+public:
+	MappedFile(const char* filename) : data(NULL), size(0) {
+#ifndef _WIN32
+		fd = open(filename, O_RDONLY);
+		if (fd==-1) throw UnknownFileException(filename);
+		struct stat st;
+		if (fstat(fd, &st)==-1) {
+			close(fd);
+			throw UnknownFileException(filename);
+		}
+		size = st.st_size;
+		if (size>0) {
+			void* addr = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (addr==MAP_FAILED) {
+				close(fd);
+				ibex_error("[SystemBinary]: cannot map file in memory.");
+			}
+			data = (const char*) addr;
+		}
+#else
+		ifstream f(filename, ios::in | ios::binary);
+		if (f.fail()) throw UnknownFileException(filename);
+		buffer.assign(istreambuf_iterator<char>(f), istreambuf_iterator<char>());
+		size = buffer.size();
+		data = buffer.empty() ? NULL : &buffer[0];
+#endif
+	}
+
+	~MappedFile() {
+#ifndef _WIN32
+		if (data) munmap((void*) data, size);
+		close(fd);
+#endif
+	}
+
+	const char* data;
+	size_t size;
+
+private:
+#ifndef _WIN32
+	int fd;
+#else
+	vector<char> buffer;
+#endif
+};
+
+/*
+ * Sequential reading of a mapped file.
+ */
+class Buffer {
+public:
+	Buffer(const MappedFile& file) : p(file.data), end(file.data+file.size) { }
+
+	void read(void* x, size_t n) {
+		if ((size_t) (end-p)<n) ibex_error("[SystemBinary]: unexpected end of file.");
+		memcpy(x, p, n); // note: p may not be aligned
+		p += n;
+	}
+
+	uint32_t read_pos_int() {
+		uint32_t x;
+		read(&x, sizeof(x));
+		return x;
+	}
+
+	int32_t read_int() {
+		int32_t x;
+		read(&x, sizeof(x));
+		return x;
+	}
+
+	double read_double() {
+		double x;
+		read(&x, sizeof(x));
+		return x;
+	}
+
+	// the string is not copied
+	const char* read_string() {
+		const char* s=p;
+		const char* eos=(const char*) memchr(p, '\0', end-p);
+		if (!eos) ibex_error("[SystemBinary]: unexpected end of file.");
+		p = eos+1;
+		return s;
+	}
+
+	Interval read_interval() {
+		double lb=read_double();
+		double ub=read_double();
+		return Interval(lb,ub);
+	}
+
+	Dim read_dim() {
+		int nb_rows=read_pos_int();
+		int nb_cols=read_pos_int();
+		return Dim(nb_rows, nb_cols);
+	}
+
+	const ExprConstant& read_constant() {
+		Domain d(read_dim());
+		switch(d.dim.type()) {
+		case Dim::SCALAR:
+			d.i()=read_interval();
+			break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR:
+			for (int i=0; i<d.dim.vec_size(); i++)
+				d.v()[i]=read_interval();
+			break;
+		case Dim::MATRIX:
+			for (int i=0; i<d.dim.nb_rows(); i++)
+				for (int j=0; j<d.dim.nb_cols(); j++)
+					d.m()[i][j]=read_interval();
+			break;
+		}
+		return ExprConstant::new_(d);
+	}
+
+	/*
+	 * Read an expression of the symbols x.
+	 */
+	const ExprNode& read_expr(const Array<const ExprSymbol>& x) {
+		unsigned int n=read_pos_int();
+		if (n==0) ibex_error("[SystemBinary]: empty expression.");
+
+		vector<const ExprNode*> node;
+		node.reserve(n);
+
+		while (node.size()<n) {
+			const ExprNode* e;
+			Opcode op=(Opcode) read_pos_int();
+
+			switch(op) {
+			case SYMBOL: {
+				unsigned int key=read_pos_int();
+				if (key>=(unsigned int) x.size()) ibex_error("[SystemBinary]: bad symbol number.");
+				e=&x[key];
+				break;
+			}
+			case CONSTANT:
+				e=&read_constant();
+				break;
+			case INDEX: {
+				const ExprNode& expr=arg(node);
+				int first_row=read_pos_int();
+				int last_row=read_pos_int();
+				int first_col=read_pos_int();
+				int last_col=read_pos_int();
+				e=&ExprIndex::new_(expr, DoubleIndex(expr.dim, first_row, last_row, first_col, last_col));
+				break;
+			}
+			case VECTOR:
+			case CHI: {
+				Array<const ExprNode> args(read_pos_int());
+				for (int i=0; i<args.size(); i++)
+					args.set_ref(i, arg(node));
+				if (op==CHI)
+					e=&ExprChi::new_(args);
+				else
+					e=&ExprVector::new_(args, read_pos_int()==0 ? ExprVector::ROW : ExprVector::COL);
+				break;
+			}
+			case GEN_BINARY: {
+				const ExprNode& left=arg(node);
+				const ExprNode& right=arg(node);
+				e=&ExprGenericBinaryOp::new_(read_string(), left, right);
+				break;
+			}
+			case ADD:
+			case MUL:
+			case SUB:
+			case DIV:
+			case MAX:
+			case MIN:
+			case ATAN2: {
+				const ExprNode& left=arg(node);
+				const ExprNode& right=arg(node);
+				switch(op) {
+				case ADD:   e=&ExprAdd::new_(left, right); break;
+				case MUL:   e=&ExprMul::new_(left, right); break;
+				case SUB:   e=&ExprSub::new_(left, right); break;
+				case DIV:   e=&ExprDiv::new_(left, right); break;
+				case MAX:   e=&ExprMax::new_(left, right); break;
+				case MIN:   e=&ExprMin::new_(left, right); break;
+				default:    e=&ExprAtan2::new_(left, right); break;
+				}
+				break;
+			}
+			case GEN_UNARY: {
+				const ExprNode& expr=arg(node);
+				e=&ExprGenericUnaryOp::new_(read_string(), expr);
+				break;
+			}
+			case POWER: {
+				const ExprNode& expr=arg(node);
+				e=&ExprPower::new_(expr, read_int());
+				break;
+			}
+			case MINUS: e=&ExprMinus::new_(arg(node)); break;
+			case TRANS: e=&ExprTrans::new_(arg(node)); break;
+			case SIGN:  e=&ExprSign::new_ (arg(node)); break;
+			case ABS:   e=&ExprAbs::new_  (arg(node)); break;
+			case SQR:   e=&ExprSqr::new_  (arg(node)); break;
+			case SQRT:  e=&ExprSqrt::new_ (arg(node)); break;
+			case EXP:   e=&ExprExp::new_  (arg(node)); break;
+			case LOG:   e=&ExprLog::new_  (arg(node)); break;
+			case COS:   e=&ExprCos::new_  (arg(node)); break;
+			case SIN:   e=&ExprSin::new_  (arg(node)); break;
+			case TAN:   e=&ExprTan::new_  (arg(node)); break;
+			case COSH:  e=&ExprCosh::new_ (arg(node)); break;
+			case SINH:  e=&ExprSinh::new_ (arg(node)); break;
+			case TANH:  e=&ExprTanh::new_ (arg(node)); break;
+			case ACOS:  e=&ExprAcos::new_ (arg(node)); break;
+			case ASIN:  e=&ExprAsin::new_ (arg(node)); break;
+			case ATAN:  e=&ExprAtan::new_ (arg(node)); break;
+			case ACOSH: e=&ExprAcosh::new_(arg(node)); break;
+			case ASINH: e=&ExprAsinh::new_(arg(node)); break;
+			case ATANH: e=&ExprAtanh::new_(arg(node)); break;
+			case FLOOR: e=&ExprFloor::new_(arg(node)); break;
+			case CEIL:  e=&ExprCeil::new_ (arg(node)); break;
+			case SAW:   e=&ExprSaw::new_  (arg(node)); break;
+			default:
+				ibex_error("[SystemBinary]: unknown operation code.");
+			}
+			node.push_back(e);
+		}
+
+		// the root is the last node
+		return *node.back();
+	}
+
+	const char* p;
+	const char* end;
+
+private:
+	// read the position of an operand (which must already be built)
+	const ExprNode& arg(const vector<const ExprNode*>& node) {
+		unsigned int i=read_pos_int();
+		if (i>=node.size()) ibex_error("[SystemBinary]: bad node number.");
+		return *node[i];
+	}
+};
+
+} // end anonymous namespace
+
+/*
+ * Note: the names of the arguments of a function are the same
+ * as those of the system, so they are only saved once.
+ */
+void SystemBinary::write(const char* filename, const System& sys) {
+
+	ofstream f;
+
+	f.open(filename, ios::out | ios::binary);
+
+	if (f.fail())
+		ibex_error("[SystemBinary]: cannot create output file.\n");
+
+	f.write(SIGNATURE, SIGNATURE_LENGTH*sizeof(char));
+
+	write_pos_int(f, FORMAT_VERSION);
+
+	write_pos_int(f, sys.args.size());
+	for (int i=0; i<sys.args.size(); i++) {
+		write_string(f, sys.args[i].name);
+		write_dim(f, sys.args[i].dim);
+	}
+
+	write_pos_int(f, sys.nb_var);
+	for (int i=0; i<sys.nb_var; i++)
+		write_interval(f, sys.box[i]);
+
+	// differentials of differentials are saved as well
+	vector<const Function*> functions;
+
+	write_pos_int(f, sys.goal ? 1 : 0);
+	if (sys.goal) functions.push_back(sys.goal);
+
+	write_pos_int(f, sys.nb_ctr);
+
+	for (int i=0; i<sys.nb_ctr; i++) {
+		write_pos_int(f, sys.ctrs[i].op);
+		functions.push_back(&sys.ctrs[i].f);
+	}
+
+	if (sys.nb_ctr>0) functions.push_back(&sys.f_ctrs);
+
+	// each function is followed by its differential
+	for (vector<const Function*>::const_iterator it=functions.begin(); it!=functions.end(); ++it) {
+		for (const Function* func=*it; func!=NULL; func=func->df) {
+			write_function(f, *func, func->df);
+		}
+		if (*it==&sys.f_ctrs) {
+			for (int i=0; i<sys.f_ctrs.image_dim(); i++)
+				write_pos_int(f, sys.ops[i]);
+		}
+	}
+
+	f.close();
+}
+
+namespace {
+
+/*
+ * Read a function with new symbols.
+ */
+Function* read_function(Buffer& b, const Array<const ExprSymbol>& args, double& compile_time) {
+	Array<const ExprSymbol> x(args.size());
+	varcopy(args, x);
+	const char* name=b.read_string();
+	const ExprNode& y=b.read_expr(x);
+	Timer timer;
+	timer.start();
+	Function* f=new Function(x, y, name);
+	timer.stop();
+	compile_time += timer.get_time();
+	return f;
+}
+
+}
+
+void SystemBinary::read(const char* filename, System& sys) {
+
+	Timer timer;
+	timer.start();
+
+	double compile_time=0;
+
+	MappedFile file(filename);
+	Buffer b(file);
+
+	// read the differentials of a function (if saved)
+	auto read_diff = [&](const Function& f) {
+		for (Function* g=(Function*) &f; b.read_pos_int(); g=g->df)
+			g->df = read_function(b, g->args(), compile_time);
+	};
+
+	char sig[SIGNATURE_LENGTH];
+	b.read(sig, SIGNATURE_LENGTH*sizeof(char));
+	if (strncmp(sig, SIGNATURE, SIGNATURE_LENGTH)!=0)
+		ibex_error("[SystemBinary]: not an Ibex compiled system file.");
+
+	if (b.read_pos_int()>FORMAT_VERSION)
+		ibex_error("[SystemBinary]: unsupported format version.");
+
+	sys.args.resize(b.read_pos_int());
+	for (int i=0; i<sys.args.size(); i++) {
+		const char* name=b.read_string();
+		sys.args.set_ref(i, ExprSymbol::new_(name, b.read_dim()));
+	}
+
+	(int&) sys.nb_var = b.read_pos_int();
+	sys.box.resize(sys.nb_var);
+	for (int i=0; i<sys.nb_var; i++)
+		sys.box[i] = b.read_interval();
+
+	bool has_goal = b.read_pos_int();
+
+	(int&) sys.nb_ctr = b.read_pos_int();
+
+	vector<CmpOp> ctr_ops(sys.nb_ctr);
+	for (int i=0; i<sys.nb_ctr; i++)
+		ctr_ops[i] = (CmpOp) b.read_pos_int();
+
+	if (has_goal) {
+		sys.goal = read_function(b, sys.args, compile_time);
+		read_diff(*sys.goal);
+	}
+
+	sys.ctrs.resize(sys.nb_ctr);
+	for (int i=0; i<sys.nb_ctr; i++) {
+		Function* f=read_function(b, sys.args, compile_time);
+		read_diff(*f);
+		sys.ctrs.set_ref(i, *new NumConstraint(*f, ctr_ops[i], true));
+	}
+
+	if (sys.nb_ctr>0) {
+		// the symbols of f_ctrs are the arguments of the system
+		const char* name=b.read_string();
+		const ExprNode& y=b.read_expr(sys.args);
+		Timer compile_timer;
+		compile_timer.start();
+		sys.f_ctrs.init(sys.args, y, name);
+		compile_timer.stop();
+		compile_time += compile_timer.get_time();
+		read_diff(sys.f_ctrs);
+
+		sys.ops = new CmpOp[sys.f_ctrs.image_dim()];
+		for (int i=0; i<sys.f_ctrs.image_dim(); i++)
+			sys.ops[i] = (CmpOp) b.read_pos_int();
+	}
+
+	timer.stop();
+	sys.load_times.compile = compile_time;
+	sys.load_times.parse = timer.get_time() - compile_time;
+}
+
+bool SystemBinary::has_signature(FILE* fd) {
+	char sig[SIGNATURE_LENGTH];
+	return fread(sig, sizeof(char), SIGNATURE_LENGTH, fd)==SIGNATURE_LENGTH
+			&& strncmp(sig, SIGNATURE, SIGNATURE_LENGTH)==0;
+}
+
+} // end namespace ibex
@@ -0,0 +1,94 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SystemBinary.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_SYSTEM_BINARY_H__
+#define __IBEX_SYSTEM_BINARY_H__
+
+#include "ibex_System.h"
+
+#include <stdio.h>
+
+namespace ibex {
+
+/**
+ * \ingroup system
+ *
+ * \brief Binary (precompiled) system files.
+ *
+ * A system is saved with its expressions already parsed and
+ * simplified, so that loading it does not involve the lexer,
+ * the parser, the generation of the expressions (evaluation of
+ * constants, loops, function calls, etc.) nor the simplification.
+ * The file is mapped in memory (mmap) and all the expression nodes
+ * are created in a single pass. The functions are then compiled
+ * (which is linear in the size of the expressions).
+ *
+ * The differential of a function (see Function::diff()) is also
+ * saved if it has already been calculated.
+ *
+ * Format (like COV files, integers are uint32_t, real values
+ * are 64 bits double and strings are null-terminated):
+ * <ul>
+ * <li> the signature: the null-terminated sequence of characters
+ *      "IBEX COMPILED SYSTEM"
+ * <li> 1 integer:  the format version
+ * <li> 1 integer:  the number of arguments, followed by the name,
+ *                  the number of rows and columns of each argument
+ * <li> 1 integer:  the number of variables n, followed by the
+ *                  n domains of the variables (lb,ub)
+ * <li> 1 integer:  1 if there is a goal function (0 otherwise)
+ * <li> 1 integer:  the number of constraints m, followed by
+ *                  the m comparison operators
+ * <li> the goal function (if any)
+ * <li> the m functions of the constraints
+ * <li> if m>0:     the function f_ctrs and the comparison operators
+ *                  of its components.
+ * </ul>
+ *
+ * A function is its name, its expression and (1 integer) 1 if the
+ * differential follows (0 otherwise). An expression is the number of
+ * nodes followed by the nodes in topological order, each node being
+ * an operation code and its operands, subnodes being referred to by
+ * their position.
+ */
+class SystemBinary {
+public:
+
+	/**
+	 * \brief Save a system in a binary file.
+	 */
+	static void write(const char* filename, const System& sys);
+
+	/**
+	 * \brief Load a system from a binary file.
+	 *
+	 * \pre sys is uninitialized.
+	 */
+	static void read(const char* filename, System& sys);
+
+	/**
+	 * \brief True if the file starts with the signature.
+	 *
+	 * The position in the file is not restored.
+	 */
+	static bool has_signature(FILE* fd);
+
+	/**
+	 * \brief Binary file format version.
+	 */
+	static const unsigned int FORMAT_VERSION;
+
+protected:
+	static const size_t SIGNATURE_LENGTH;
+
+	static const char*  SIGNATURE;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_SYSTEM_BINARY_H__
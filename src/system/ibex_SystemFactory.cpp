@@ -12,18 +12,38 @@
 #include "ibex_Exception.h"
 #include "ibex_ExprCtr.h"
 #include "ibex_ExprCopy.h"
+#include "ibex_Timer.h"
+#include "ibex_String.h"
+
+#include <thread>
+#include <algorithm>
+#include <cstdlib>
 
 using std::vector;
+using std::thread;
+using std::exception_ptr;
 
 namespace ibex {
 
-SystemFactory::SystemFactory() : nb_arg(0), nb_var(0), input_args(0), sys_args(0), goal(NULL), system_built(false) { }
+int SystemFactory::default_nb_threads = 1;
+
+SystemFactory::SystemFactory() : nb_arg(0), nb_var(0), input_args(0), sys_args(0), goal(NULL), system_built(false),
+		nb_simplified_ctrs(0), simplify_time(0), compile_time(0), nb_threads(default_nb_threads) { }
 
 
 SystemFactory::~SystemFactory() {
 	if (!system_built) {
 		if (goal) delete goal;
 
+		for (vector<PendingCtr>::iterator it=pending_ctrs.begin(); it!=pending_ctrs.end(); ++it) {
+			if (!ctrs[it->index]) { // otherwise, built before an exception
+				cleanup(*it->expr,false);
+				for (int i=0; i<it->args.size(); i++)
+					delete &it->args[i];
+			}
+			free(it->name);
+		}
+
 		for (unsigned int i=0; i<ctrs.size(); i++)
 			delete ctrs[i];
 
@@ -105,7 +125,11 @@ void SystemFactory::add_goal(const ExprNode& goal) {
 	Array<const ExprSymbol> goal_vars(input_args.size());
 	varcopy(input_args,goal_vars);
 	const ExprNode& goal_expr=ExprCopy().copy(input_args, goal_vars, goal);
+	Timer timer;
+	timer.start();
 	this->goal = new Function(goal_vars, goal_expr);
+	timer.stop();
+	compile_time += timer.get_time();
 }
 
 void SystemFactory::add_goal(const Function& goal) {
@@ -123,9 +147,10 @@ void SystemFactory::add_ctr(const ExprCtr& ctr) {
 
 	Array<const ExprSymbol> ctr_args(input_args.size());
 	varcopy(input_args,ctr_args);
-	const ExprNode& ctr_expr=ExprCopy().copy(input_args, ctr_args, ctr.e).simplify();
+	const ExprNode& ctr_copy=ExprCopy().copy(input_args, ctr_args, ctr.e);
 
-	ctrs.push_back(new NumConstraint(*new Function(ctr_args, ctr_expr), ctr.op, true));
+	// simplified and compiled when the system is built
+	add_pending_ctr(ctr_args, ctr_copy, ctr.op, true);
 
 	f_ctrs.push_back(& f_ctrs_copy.copy(input_args, sys_args, ctr.e, true));
 }
@@ -142,8 +167,92 @@ void SystemFactory::add_ctr(const NumConstraint& ctr) {
 	f_ctrs.push_back(& f_ctrs_copy.copy(ctr.f.args(), sys_args, ctr.f.expr(), true));
 }
 
+void SystemFactory::set_nb_threads(int nb_threads) {
+	if (nb_threads<=0)
+		ibex_error("SystemFactory: the number of threads must be positive");
+	this->nb_threads = nb_threads;
+}
+
+void SystemFactory::add_pending_ctr(const Array<const ExprSymbol>& args, const ExprNode& expr, CmpOp op, bool simplify) {
+	// the name is generated now so that it does not depend on the
+	// order in which the threads build the functions
+	pending_ctrs.push_back(PendingCtr(ctrs.size(), args, expr, op, simplify, next_generated_func_name()));
+	ctrs.push_back(NULL);
+}
+
+void SystemFactory::simplify_slice(size_t first, size_t step, exception_ptr& error) {
+	try {
+		for (size_t i=first; i<pending_ctrs.size(); i+=step) {
+			PendingCtr& c=pending_ctrs[i];
+			if (c.simplify) {
+				c.expr=&c.expr->simplify();
+				c.simplify=false;
+			}
+		}
+	} catch(...) {
+		error = std::current_exception();
+	}
+}
+
+void SystemFactory::compile_slice(size_t first, size_t step, exception_ptr& error) {
+	try {
+		for (size_t i=first; i<pending_ctrs.size(); i+=step) {
+			PendingCtr& c=pending_ctrs[i];
+			ctrs[c.index]=new NumConstraint(*new Function(c.args, *c.expr, c.name), c.op, true);
+		}
+	} catch(...) {
+		error = std::current_exception();
+	}
+}
+
+void SystemFactory::run(void (SystemFactory::*slice)(size_t, size_t, exception_ptr&)) {
+
+	// note: default_nb_threads may have been set to a wrong value
+	size_t n=std::min((size_t) std::max(nb_threads,1), pending_ctrs.size());
+
+	vector<exception_ptr> errors(n);
+
+	vector<thread> threads;
+
+	for (size_t i=1; i<n; i++)
+		threads.push_back(thread(slice, this, i, n, std::ref(errors[i])));
+
+	// the calling thread takes the first slice
+	(this->*slice)(0, n, errors[0]);
+
+	for (size_t i=0; i<threads.size(); i++)
+		threads[i].join();
+
+	for (size_t i=0; i<n; i++)
+		if (errors[i]) std::rethrow_exception(errors[i]);
+}
+
+void SystemFactory::build_ctrs() {
+
+	if (pending_ctrs.empty()) return;
+
+	// The expressions (and symbols) of two constraints are disjoint and
+	// all the global resources used during the construction (identifiers
+	// of nodes, generated names, etc.) are thread-safe. The simplification
+	// is done before the compilation only to measure separately their times.
+	Timer timer;
+	timer.start();
+	run(&SystemFactory::simplify_slice);
+	timer.stop();
+	simplify_time += timer.get_time();
+
+	timer.restart();
+	run(&SystemFactory::compile_slice);
+	timer.stop();
+	compile_time += timer.get_time();
+
+	for (vector<PendingCtr>::iterator it=pending_ctrs.begin(); it!=pending_ctrs.end(); ++it)
+		free(it->name);
+	pending_ctrs.clear();
+}
+
 // precondition: nb_ctr > 0
-void System::init_f_ctrs(const std::vector<const ExprNode*>& fac_f_ctrs) {
+void System::init_f_ctrs(const std::vector<const ExprNode*>& fac_f_ctrs, bool simplify) {
 
 	if (fac_f_ctrs.empty()) {
 		// don't delete the symbols now because
@@ -222,7 +331,17 @@ void System::init_f_ctrs(const std::vector<const ExprNode*>& fac_f_ctrs) {
 	}
 	assert(i==total_output_size);
 
-	f_ctrs.init(args, total_output_size>1? ExprVector::new_col(image).simplify() : image[0].simplify());
+	Timer timer;
+	timer.start();
+	const ExprNode& y0=total_output_size>1? ExprVector::new_col(image) : image[0];
+	const ExprNode& y=simplify? y0.simplify() : y0;
+	timer.stop();
+	load_times.simplify += timer.get_time();
+
+	timer.restart();
+	f_ctrs.init(args, y);
+	timer.stop();
+	load_times.compile += timer.get_time();
 }
 
 
@@ -234,6 +353,9 @@ void System::init(const SystemFactory& fac) {
 	if (fac.system_built)
 		ibex_error("only one system can be built with a factory");
 
+	Timer timer;
+	timer.start();
+
 	// the field fac.args is initialized upon addition of an objective
 	// function or a constraint.
 	if (fac.input_args.is_empty()) {
@@ -243,6 +365,9 @@ void System::init(const SystemFactory& fac) {
 		((SystemFactory&) fac).init_args();
 	}
 
+	// simplify and compile the constraints
+	((SystemFactory&) fac).build_ctrs();
+
 	fac.system_built = true;
 
 	(int&) nb_var = fac.nb_var;
@@ -279,7 +404,13 @@ void System::init(const SystemFactory& fac) {
 	// so we do the contrary: we generate first the constraints,
 	// and build f with the components of all constraints' functions.
 
-	init_f_ctrs(fac.f_ctrs);
+	init_f_ctrs(fac.f_ctrs, fac.nb_simplified_ctrs<nb_ctr);
+
+	timer.stop();
+	// the time spent in init_f_ctrs is already counted in load_times
+	load_times.build = timer.get_time() - load_times.simplify - load_times.compile;
+	load_times.simplify += fac.simplify_time;
+	load_times.compile += fac.compile_time;
 }
 
 } // end namespace
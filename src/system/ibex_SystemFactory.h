@@ -14,6 +14,8 @@
 #include "ibex_System.h"
 #include "ibex_ExprCopy.h"
 
+#include <exception>
+
 namespace ibex {
 
 /**
@@ -93,8 +95,32 @@ public:
 	 */
 	void add_ctr_eq (const ExprNode& exp);
 
+	/**
+	 * \brief Set the number of threads that build the constraints.
+	 *
+	 * The expressions of the constraints are copied when they are
+	 * added, but their simplification and the compilation of their
+	 * functions are postponed until the system is built. These tasks
+	 * are independent (each constraint has its own symbols and nodes)
+	 * and are then shared between \a nb_threads threads (including the
+	 * calling one).
+	 *
+	 * By default, the number of threads is #default_nb_threads.
+	 */
+	void set_nb_threads(int nb_threads);
+
+	/**
+	 * \brief Default number of threads that build the constraints (1).
+	 *
+	 * This value also applies to the systems loaded from Minibex files.
+	 * With a single thread, the construction is deterministic (same node
+	 * identifiers from one run to another).
+	 */
+	static int default_nb_threads;
+
 protected:
 	friend class System;
+	friend class ExprBuilder;
 
 	// total number of arguments
 	int nb_arg;
@@ -120,9 +146,61 @@ protected:
 
 	mutable bool system_built; // for cleanup
 
+	// number of constraints whose expression in f_ctrs is
+	// already simplified (see ExprBuilder)
+	int nb_simplified_ctrs;
+
+	// cumulated times of expression simplification and
+	// function compilation (see System::load_times)
+	double simplify_time;
+	double compile_time;
+
+	/**
+	 * Record a constraint whose function is built by #build_ctrs.
+	 *
+	 * The symbols and the nodes of the expression must not be shared
+	 * with any other constraint.
+	 */
+	void add_pending_ctr(const Array<const ExprSymbol>& args, const ExprNode& expr, CmpOp op, bool simplify);
+
 private:
 
+	// number of threads of build_ctrs()
+	int nb_threads;
+
+	// A constraint whose function is not built yet.
+	struct PendingCtr {
+		PendingCtr(int index, const Array<const ExprSymbol>& args, const ExprNode& expr, CmpOp op, bool simplify, char* name) :
+			index(index), args(args), expr(&expr), op(op), simplify(simplify), name(name) { }
+
+		int index;                     // in ctrs
+		Array<const ExprSymbol> args;
+		const ExprNode* expr;
+		CmpOp op;
+		bool simplify;
+		char* name;                    // generated in the order of addition
+	};
+
+	std::vector<PendingCtr> pending_ctrs;
+
 	void init_args();
+
+	/*
+	 * Simplify the pending constraints and build their functions,
+	 * with #nb_threads threads.
+	 */
+	void build_ctrs();
+
+	/*
+	 * Process the pending constraints first, first+step, first+2*step, etc.
+	 */
+	void simplify_slice(size_t first, size_t step, std::exception_ptr& error);
+	void compile_slice(size_t first, size_t step, std::exception_ptr& error);
+
+	/*
+	 * Run slice(i, n) in n threads (the calling thread takes the first slice).
+	 */
+	void run(void (SystemFactory::*slice)(size_t, size_t, std::exception_ptr&));
 };
 
 
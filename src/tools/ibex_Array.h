@@ -223,8 +223,15 @@ public:
 	void clear();
 
 protected:
+	/* Reallocate the array of pointers so that it can contain
+	 * at least cap elements (without changing the size). */
+	void reserve(int cap);
+
 	int _nb;
 
+	/* Size of the allocated array of pointers (>= _nb). */
+	int _capacity;
+
 	/** Array of sub-Ts */
 	T** array;
 private:
@@ -235,32 +242,39 @@ private:
 /*================================== inline implementations ========================================*/
 
 template<class T>
-Array<T>::Array() : _nb(0), array(NULL) {
+Array<T>::Array() : _nb(0), _capacity(0), array(NULL) {
 
 }
 
 template<class T>
-Array<T>::Array(int n) : _nb(n), array(new T*[n]) {
+Array<T>::Array(int n) : _nb(n), _capacity(n), array(new T*[n]) {
 	assert(n>=0);
 	for (int i=0; i<_nb; i++) {
 		array[i] = NULL;
 	}
 }
 
+template<class T>
+void Array<T>::reserve(int cap) {
+	if (cap<=_capacity) return;
+	T** new_array=new T*[cap];
+	for (int i=0; i<_nb; i++)
+		new_array[i] = array[i];
+	if (array) delete[] array;
+	array=new_array;
+	_capacity=cap;
+}
+
 template<class T>
 void Array<T>::resize(int n) {
 	assert(n>=0);
-	T** new_array=new T*[n];
-	int i=0;
-	for (; i<_nb; i++) {
-		if (i<n) new_array[i] = array[i];
-		else if (array[i]) delete array[i];
+	reserve(n);
+	for (int i=n; i<_nb; i++) {
+		if (array[i]) delete array[i];
 	}
-	for (; i<n; i++) {
-		new_array[i]=NULL;
+	for (int i=_nb; i<n; i++) {
+		array[i]=NULL;
 	}
-	if (array) delete[] array;
-	array=new_array;
 	_nb=n;
 }
 
@@ -274,6 +288,8 @@ void Array<T>::set_ref(int i, T& obj) {
 
 template<class T>
 void Array<T>::add(T& obj) {
+	// geometric growth: adding k elements one by one is in O(k)
+	if (size()==_capacity) reserve(2*_capacity+1);
 	resize(size()+1);
 	set_ref(size()-1,obj);
 }
@@ -300,7 +316,7 @@ void Array<T>::add(const std::vector<T*>& vec) {
 }
 
 template<class T>
-Array<T>::Array(T** a, int n) : _nb(n), array(new T*[n]) {
+Array<T>::Array(T** a, int n) : _nb(n), _capacity(n), array(new T*[n]) {
 	assert(n>=0);
 	for (int i=0; i<_nb; i++) {
 		array[i] = a[i];
@@ -308,7 +324,7 @@ Array<T>::Array(T** a, int n) : _nb(n), array(new T*[n]) {
 }
 
 template<class T>
-Array<T>::Array(const std::vector<T*>& vec) : _nb(vec.size()), array(new T*[vec.size()]) {
+Array<T>::Array(const std::vector<T*>& vec) : _nb(vec.size()), _capacity(vec.size()), array(new T*[vec.size()]) {
 
 	assert(vec.size()>0);
 	int i=0;
@@ -318,25 +334,25 @@ Array<T>::Array(const std::vector<T*>& vec) : _nb(vec.size()), array(new T*[vec.
 }
 
 template<class T>
-Array<T>::Array(T& x) : _nb(1), array(new T*[1]) {
+Array<T>::Array(T& x) : _nb(1), _capacity(1), array(new T*[1]) {
 	array[0] = &x;
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2) : _nb(2), array(new T*[2]) {
+Array<T>::Array(T& x1, T& x2) : _nb(2), _capacity(2), array(new T*[2]) {
 	array[0] = &x1;
 	array[1] = &x2;
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3) : _nb(3), array(new T*[3]) {
+Array<T>::Array(T& x1, T& x2, T& x3) : _nb(3), _capacity(3), array(new T*[3]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4) : _nb(4), array(new T*[4]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4) : _nb(4), _capacity(4), array(new T*[4]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -344,7 +360,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4) : _nb(4), array(new T*[4]) {
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5) : _nb(5), array(new T*[5]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5) : _nb(5), _capacity(5), array(new T*[5]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -353,7 +369,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5) : _nb(5), array(new T*[5]) {
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6) : _nb(6), array(new T*[6]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6) : _nb(6), _capacity(6), array(new T*[6]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -363,7 +379,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6) : _nb(6), array(new T*
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7) : _nb(7), array(new T*[7]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7) : _nb(7), _capacity(7), array(new T*[7]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -374,7 +390,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7) : _nb(7), array
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8) : _nb(8), array(new T*[8]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8) : _nb(8), _capacity(8), array(new T*[8]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -386,7 +402,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8) : _nb(8)
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9) : _nb(9), array(new T*[9]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9) : _nb(9), _capacity(9), array(new T*[9]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -399,7 +415,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9) :
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10) : _nb(10), array(new T*[10]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10) : _nb(10), _capacity(10), array(new T*[10]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -413,7 +429,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11) : _nb(11), array(new T*[11]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11) : _nb(11), _capacity(11), array(new T*[11]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -428,7 +444,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12) : _nb(12), array(new T*[12]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12) : _nb(12), _capacity(12), array(new T*[12]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -444,7 +460,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13) : _nb(13), array(new T*[13]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13) : _nb(13), _capacity(13), array(new T*[13]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -461,7 +477,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14) : _nb(14), array(new T*[14]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14) : _nb(14), _capacity(14), array(new T*[14]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -479,7 +495,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15) : _nb(15), array(new T*[15]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15) : _nb(15), _capacity(15), array(new T*[15]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -498,7 +514,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16) : _nb(16), array(new T*[16]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16) : _nb(16), _capacity(16), array(new T*[16]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -518,7 +534,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17) : _nb(17), array(new T*[17]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17) : _nb(17), _capacity(17), array(new T*[17]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -539,7 +555,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18) : _nb(18), array(new T*[18]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18) : _nb(18), _capacity(18), array(new T*[18]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -561,7 +577,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18, T& x19) : _nb(19), array(new T*[19]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18, T& x19) : _nb(19), _capacity(19), array(new T*[19]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -584,7 +600,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18, T& x19, T& x20) : _nb(20), array(new T*[20]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18, T& x19, T& x20) : _nb(20), _capacity(20), array(new T*[20]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -608,7 +624,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(const Array<T>& a) : _nb(a.size()), array(new T*[a.size()]) {
+Array<T>::Array(const Array<T>& a) : _nb(a.size()), _capacity(a.size()), array(new T*[a.size()]) {
 	for (int i=0; i<_nb; i++) {
 		array[i] = &a[i];
 	}
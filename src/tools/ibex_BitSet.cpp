@@ -13,15 +13,23 @@ using namespace std;
 
 namespace ibex {
 
+void BitSet::init_bitset(int n) {
+	// note: initialise(n,0) allocates n words (not n bits)
+	if (n>0)
+		bitset.initialise(0,n-1,Mistral::BitSet::empt);
+	else
+		bitset.initialise(0,0); // empty table
+}
+
 void BitSet::resize(int n) {
 
 	if (initialized()) {
 		BitSet b(*this);
 		bitset.destroy();
-		bitset.initialise(n,0);
+		init_bitset(n);
 		(*this) |= b;
 	} else
-		bitset.initialise(n,0);
+		init_bitset(n);
 }
 
 BitSet BitSet::compose(const BitSet& b) const {
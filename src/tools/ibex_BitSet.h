@@ -241,6 +241,9 @@ protected:
 
 	bool initialized() const;
 
+	/* Allocate the table for a capacity of (at least) n. */
+	void init_bitset(int n);
+
 private:
 
 	Mistral::BitSet bitset;
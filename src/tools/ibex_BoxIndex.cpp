@@ -0,0 +1,212 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BoxIndex.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_BoxIndex.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Sum of the diameters of a box (infinite if the box is unbounded).
+ */
+double margin(const IntervalVector& box) {
+	double m=0;
+	for (int i=0; i<box.size(); i++)
+		m += box[i].diam();
+	return m;
+}
+
+/*
+ * Increase of the margin of a hull if a box is added.
+ */
+double enlargement(const IntervalVector& hull, const IntervalVector& box) {
+	double e=0;
+	for (int i=0; i<hull.size(); i++) {
+		double d0=hull[i].diam();
+		double d1=(hull[i] | box[i]).diam();
+		if (d1>d0) e += d1-d0;
+	}
+	return e;
+}
+
+}
+
+/*
+ * A node of the tree. An entry of a leaf node is itself a node
+ * without children, storing a box (the hull) and its identifier.
+ */
+struct BoxIndex::Node {
+
+	Node(const IntervalVector& hull, int id=-1) : hull(hull), id(id), leaf(true) { }
+
+	~Node() {
+		for (vector<Node*>::iterator it=children.begin(); it!=children.end(); it++)
+			delete *it;
+	}
+
+	/* Recompute the hull from the children. */
+	void update_hull() {
+		hull.set_empty();
+		for (vector<Node*>::iterator it=children.begin(); it!=children.end(); it++)
+			hull |= (*it)->hull;
+	}
+
+	int find_superset(const IntervalVector& box) const {
+		if (id!=-1) return id;
+
+		for (vector<Node*>::const_iterator it=children.begin(); it!=children.end(); it++)
+			if (box.is_subset((*it)->hull)) {
+				int res=(*it)->find_superset(box);
+				if (res!=-1) return res;
+			}
+		return -1;
+	}
+
+	void find_intersecting(const IntervalVector& box, vector<int>& ids) const {
+		if (id!=-1) {
+			ids.push_back(id);
+			return;
+		}
+
+		for (vector<Node*>::const_iterator it=children.begin(); it!=children.end(); it++)
+			if (box.intersects((*it)->hull))
+				(*it)->find_intersecting(box, ids);
+	}
+
+	/* Hull of the entries */
+	IntervalVector hull;
+
+	/* Identifier of the box (-1 if this is not an entry) */
+	int id;
+
+	/* True if the children are entries */
+	bool leaf;
+
+	vector<Node*> children;
+};
+
+BoxIndex::BoxIndex(int n) : n(n), root(NULL), nb_boxes(0) {
+
+}
+
+BoxIndex::~BoxIndex() {
+	clear();
+}
+
+void BoxIndex::clear() {
+	if (root) delete root;
+	root = NULL;
+	nb_boxes = 0;
+}
+
+void BoxIndex::add(const IntervalVector& box, int id) {
+	assert(box.size()==n);
+	assert(id>=0);
+	assert(!box.is_empty());
+
+	Node* entry=new Node(box, id);
+
+	if (!root) {
+		root = new Node(box);
+		root->children.push_back(entry);
+	} else {
+		Node* sibling=insert(root, entry);
+		if (sibling) {
+			// the root is split: the tree grows by one level
+			Node* new_root=new Node(root->hull | sibling->hull);
+			new_root->leaf = false;
+			new_root->children.push_back(root);
+			new_root->children.push_back(sibling);
+			root = new_root;
+		}
+	}
+
+	nb_boxes++;
+}
+
+BoxIndex::Node* BoxIndex::insert(Node* node, Node* entry) {
+
+	node->hull |= entry->hull;
+
+	if (node->leaf)
+		node->children.push_back(entry);
+	else {
+		// choose the child whose hull is the least enlarged (the smallest one in case of tie)
+		Node* best=NULL;
+		double best_enlargement=0;
+		double best_margin=0;
+
+		for (vector<Node*>::iterator it=node->children.begin(); it!=node->children.end(); it++) {
+			double e=enlargement((*it)->hull, entry->hull);
+			double m=margin((*it)->hull);
+			if (!best || e<best_enlargement || (e==best_enlargement && m<best_margin)) {
+				best = *it;
+				best_enlargement = e;
+				best_margin = m;
+			}
+		}
+
+		Node* sibling=insert(best, entry);
+		if (sibling) node->children.push_back(sibling);
+	}
+
+	return ((int) node->children.size())>max_entries ? split(node) : NULL;
+}
+
+BoxIndex::Node* BoxIndex::split(Node* node) {
+
+	vector<Node*>& c=node->children;
+
+	// dimension where the midpoints of the entries are the most spread
+	int dim=0;
+	double max_spread=-1;
+	for (int i=0; i<n; i++) {
+		double lo=POS_INFINITY, hi=NEG_INFINITY;
+		for (vector<Node*>::iterator it=c.begin(); it!=c.end(); it++) {
+			double m=(*it)->hull[i].mid();
+			if (m<lo) lo=m;
+			if (m>hi) hi=m;
+		}
+		if (hi-lo>max_spread) {
+			max_spread = hi-lo;
+			dim = i;
+		}
+	}
+
+	sort(c.begin(), c.end(), [dim](const Node* n1, const Node* n2) {
+		return n1->hull[dim].mid() < n2->hull[dim].mid();
+	});
+
+	Node* sibling=new Node(IntervalVector::empty(n));
+	sibling->leaf = node->leaf;
+	sibling->children.assign(c.begin()+c.size()/2, c.end());
+	c.resize(c.size()/2);
+
+	node->update_hull();
+	sibling->update_hull();
+
+	return sibling;
+}
+
+int BoxIndex::find_superset(const IntervalVector& box) const {
+	if (!root || !box.is_subset(root->hull)) return -1;
+	return root->find_superset(box);
+}
+
+void BoxIndex::find_intersecting(const IntervalVector& box, vector<int>& ids) const {
+	if (!root || !box.intersects(root->hull)) return;
+	root->find_intersecting(box, ids);
+}
+
+} // end namespace ibex
@@ -0,0 +1,113 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BoxIndex.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_BOX_INDEX_H__
+#define __IBEX_BOX_INDEX_H__
+
+#include "ibex_IntervalVector.h"
+
+#include <vector>
+
+namespace ibex {
+
+/** \ingroup tools
+ *
+ * \brief Spatial index over a set of boxes (R-tree).
+ *
+ * Each box is stored with an identifier (typically its index in some
+ * other container). The boxes are grouped in a balanced tree of
+ * nodes, each node being labeled with the hull of its boxes, so that
+ * queries only visit the nodes whose hull is compatible with the
+ * query box (O(log N) nodes in favourable cases instead of N).
+ *
+ * A full node is split in two halves, sorted by the midpoints of their
+ * entries in the dimension where these midpoints are the most spread.
+ *
+ * Boxes can be added but not removed.
+ */
+class BoxIndex {
+public:
+
+	/**
+	 * \brief Create an empty index of boxes of size \a n.
+	 */
+	BoxIndex(int n);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~BoxIndex();
+
+	/**
+	 * \brief Add a box with identifier \a id.
+	 */
+	void add(const IntervalVector& box, int id);
+
+	/**
+	 * \brief Identifier of a box that contains \a box (-1 if none).
+	 */
+	int find_superset(const IntervalVector& box) const;
+
+	/**
+	 * \brief Push back into \a ids the identifiers of all
+	 *        the boxes that intersect \a box.
+	 */
+	void find_intersecting(const IntervalVector& box, std::vector<int>& ids) const;
+
+	/**
+	 * \brief Number of boxes.
+	 */
+	int size() const;
+
+	/**
+	 * \brief True iff there is no box.
+	 */
+	bool empty() const;
+
+	/**
+	 * \brief Remove all the boxes.
+	 */
+	void clear();
+
+	/**
+	 * \brief Size of the boxes.
+	 */
+	const int n;
+
+	/** Maximal number of entries of a node: 8. */
+	static constexpr int max_entries = 8;
+
+protected:
+	struct Node;
+
+	/* Insert in the subtree of \a node. Return the new sibling if \a node is split. */
+	Node* insert(Node* node, Node* entry);
+
+	/* Split a full node (the second half of the entries is moved to the returned node). */
+	Node* split(Node* node);
+
+	Node* root;
+	int nb_boxes;
+
+private:
+	BoxIndex(const BoxIndex&); // forbidden
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline int BoxIndex::size() const {
+	return nb_boxes;
+}
+
+inline bool BoxIndex::empty() const {
+	return nb_boxes==0;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_BOX_INDEX_H__
@@ -0,0 +1,51 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Cancellation.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_Cancellation.h"
+#include "ibex_Interval.h"
+
+using namespace std;
+
+namespace ibex {
+
+Cancellation::Cancellation(unsigned int period) : period(period>0? period : 1),
+		stop(false), timed_out(false), has_deadline(false), count(0) {
+
+}
+
+void Cancellation::set_deadline(double timeout) {
+	if (timeout>0) {
+		deadline = Clock::now() + chrono::duration_cast<Clock::duration>(chrono::duration<double>(timeout));
+		// publishes the deadline (see poll() and remaining())
+		has_deadline.store(true, memory_order_release);
+	} else
+		has_deadline.store(false, memory_order_relaxed);
+}
+
+void Cancellation::reset() {
+	has_deadline.store(false, memory_order_relaxed);
+	timed_out.store(false, memory_order_relaxed);
+	stop.store(false, memory_order_relaxed);
+	count.store(0, memory_order_relaxed);
+}
+
+bool Cancellation::check_deadline() {
+	if (Clock::now() < deadline) return false;
+	timed_out.store(true, memory_order_relaxed);
+	// publishes timed_out (see expired())
+	stop.store(true, memory_order_release);
+	return true;
+}
+
+double Cancellation::remaining() const {
+	if (!has_deadline.load(memory_order_acquire)) return POS_INFINITY;
+	double r=chrono::duration<double>(deadline - Clock::now()).count();
+	return r>0? r : 0;
+}
+
+} // end namespace ibex
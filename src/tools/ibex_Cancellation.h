@@ -0,0 +1,138 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Cancellation.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CANCELLATION_H__
+#define __IBEX_CANCELLATION_H__
+
+#include <atomic>
+#include <chrono>
+
+namespace ibex {
+
+/** \ingroup tools
+ *
+ * \brief Cancellation token.
+ *
+ * A stop flag, which can be raised from any thread (see #cancel()),
+ * and an optional deadline, based on a monotonic wall clock (contrary
+ * to Timer, which measures the CPU time of the process).
+ *
+ * The token is polled by the strategies (Solver, Optimizer) at each
+ * cell and by some contractors (CtcFixPoint, CtcPropag, Ctc3BCid)
+ * between two sub-contractions, through ContractContext::cancellation.
+ * A cancelled contractor stops early, leaving a box that is less
+ * contracted but still valid; a cancelled strategy stops the search.
+ *
+ * Polling only reads the flag: the clock is read every #period calls
+ * to #poll(), so that the token can be checked in hot loops. Once the
+ * deadline is reached, the flag is raised.
+ */
+class Cancellation {
+public:
+
+	/**
+	 * \brief Create a token (no deadline, not cancelled).
+	 *
+	 * \param period - number of calls to poll() between two readings of the clock.
+	 */
+	Cancellation(unsigned int period=default_period);
+
+	/**
+	 * \brief Set a deadline.
+	 *
+	 * \param timeout - wall-clock time (in seconds) from now. If
+	 *                  negative or zero, the deadline is removed.
+	 *
+	 * The deadline is visible to the threads that poll the token
+	 * afterwards. It must not be changed while other threads poll
+	 * the token.
+	 */
+	void set_deadline(double timeout);
+
+	/**
+	 * \brief Raise the stop flag.
+	 *
+	 * Can be called from any thread.
+	 */
+	void cancel();
+
+	/**
+	 * \brief Lower the stop flag and remove the deadline.
+	 */
+	void reset();
+
+	/**
+	 * \brief Return true if the stop flag is raised (no clock reading).
+	 */
+	bool cancelled() const;
+
+	/**
+	 * \brief Return true if the stop flag has been raised because
+	 *        the deadline was reached.
+	 */
+	bool expired() const;
+
+	/**
+	 * \brief Return true if the search has to stop.
+	 *
+	 * The clock is read (and the deadline checked) every #period calls.
+	 */
+	bool poll();
+
+	/**
+	 * \brief Remaining wall-clock time before the deadline (in seconds).
+	 *
+	 * +oo if no deadline.
+	 */
+	double remaining() const;
+
+	/**
+	 * \brief Number of calls to poll() between two readings of the clock.
+	 */
+	const unsigned int period;
+
+	/** Default period: 64 calls. */
+	static constexpr unsigned int default_period = 64;
+
+protected:
+	typedef std::chrono::steady_clock Clock;
+
+	/* check the deadline (reads the clock). */
+	bool check_deadline();
+
+	std::atomic<bool> stop;
+	std::atomic<bool> timed_out;
+	std::atomic<bool> has_deadline;
+	std::atomic<unsigned int> count;
+	Clock::time_point deadline;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline void Cancellation::cancel() {
+	stop.store(true, std::memory_order_relaxed);
+}
+
+inline bool Cancellation::cancelled() const {
+	return stop.load(std::memory_order_relaxed);
+}
+
+inline bool Cancellation::expired() const {
+	return timed_out.load(std::memory_order_relaxed);
+}
+
+inline bool Cancellation::poll() {
+	if (stop.load(std::memory_order_acquire)) return true;
+	if (!has_deadline.load(std::memory_order_acquire)) return false;
+	if (count.fetch_add(1, std::memory_order_relaxed)%period!=0) return false;
+	return check_deadline();
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_CANCELLATION_H__
@@ -14,10 +14,29 @@
 #include "ibex_SharedHeap.h"
 #include "ibex_Random.h"
 
+#include <limits>
+#include <vector>
+
 namespace ibex {
 
 /**
  * \brief Double-heap
+ *
+ * Contraction (see #contract(double)) is lazy: a discarded data is only
+ * removed when it reaches the top of one of the heaps, and the heaps are
+ * rebuilt once enough data has been pushed since the last rebuild (the cost
+ * of the rebuild is therefore amortized over the pushes).
+ *
+ * In the same way, if the costs of the second heap have to be recalculated
+ * after a contraction (see update_cost2_when_sorting in the constructor),
+ * they are not all updated immediately: the cost of the top data is only
+ * recalculated when it is about to be selected, and the data is moved down
+ * if its cost has increased. This is only exact if costs can only increase
+ * with the contraction, e.g., the criteria C3 and C5 of the optimizer (see
+ * CellCostFunc) when the loup decreases. Otherwise (e.g., the criterion C7,
+ * whose sign is that of the lower bound of the objective), #lazy_cost2 must
+ * be set to false: the second heap is then entirely rebuilt at each
+ * contraction.
  */
 template<class T>
 class DoubleHeap {
@@ -55,7 +74,12 @@ public:
 	 */
 	void clear();
 
-	/** \brief Return the size of the buffer. */
+	/**
+	 * \brief Return the size of the buffer.
+	 *
+	 * Because of lazy contraction, this is an upper bound of the number
+	 * of data that can be retrieved (see #prune()).
+	 */
 	unsigned int size() const;
 
 	/** \brief Return true if the buffer is empty. */
@@ -112,12 +136,47 @@ public:
 	 *
 	 * The costs of the first heap are assumed to be up-to-date.
 	 *
+	 * The removal is lazy (see the class description). Amortized
+	 * complexity: O(log(size)) per data.
+	 *
 	 * TODO: in principle we should implement the symmetric
 	 * case where the contraction is performed with respect
 	 * to the cost of the second heap.
 	 */
 	void contract(double loup1);
 
+	/**
+	 * \brief Remove all the data discarded by the last contraction.
+	 *
+	 * Rebuilds the two heaps and recalculates the outdated costs of
+	 * the second heap. After this call, #size() is exact.
+	 *
+	 * Complexity: O(size*log(size))
+	 */
+	void prune();
+
+	/**
+	 * \brief Whether the costs of the second heap are recalculated lazily.
+	 *
+	 * Only relevant if update_cost2_when_sorting is true (see the
+	 * constructor). Must be set to false if these costs may decrease
+	 * with a contraction (see the class description). Default value: true.
+	 */
+	bool lazy_cost2;
+
+	/**
+	 * \brief Shrink the heap.
+	 *
+	 * Removes from the two heaps the data with the greatest cost
+	 * according to the first heap so that \a n data at most remain,
+	 * and appends them to \a removed (they are not deleted).
+	 * The data discarded by the last contraction are removed (and
+	 * deleted) before.
+	 *
+	 * Complexity: O(size*log(size))
+	 */
+	void shrink(unsigned int n, std::vector<T*>& removed);
+
 	/**
 	 * \brief Delete this
 	 */
@@ -144,27 +203,52 @@ protected:
 	/** Current selected heap. */
 	mutable int current_heap_id;
 
+	/** Number of calls to contract (used to stamp the elements). */
+	unsigned int nb_contract;
+
+	/** The bound of the last contraction. */
+	double bound;
+
+	/** Whether some data may have been discarded but not removed yet. */
+	bool pending;
+
+	/** Number of data pushed since the last rebuild. */
+	unsigned int nb_pushed;
+
 	/**
-	 * Used in the contract function by recursivity
+	 * Remove discarded data and recalculate outdated costs at the top
+	 * of the heaps, until the top element of each heap is valid.
 	 *
-	 * \param heap: the new heap1 under construction (will
-	 *        eventually replace the current heap1).
+	 * Called after every modification, so that top() and minimum()
+	 * can be constant.
 	 */
-	void contract_rec(double new_loup, HeapNode<T>* node, SharedHeap<T>& heap, bool percolate);
+	void update_top();
 
 private:
 	/**
-	 * Erase all the subnodes of node (including itself) in the first heap
-	 * and manage the impact on the second heap.
-	 * If "percolate" is true, the second heap is left in a correct state.
-	 * Otherwise, the second heap has a binary tree structure but not sorted
-	 * anymore. Therefore, "sort" should be called on the second heap.
-	 *
-	 * So the heap structure is maintained for the second heap
-	 * but not the first one. The reason is that this function is called
-	 * either by "contract" or "flush". "contract" will build a new heap from scratch.
+	 * Whether the element was there at the last contraction
+	 * and its first cost is greater than the bound.
 	 */
-	void erase_subnodes(HeapNode<T>* node, bool percolate);
+	bool discarded(const HeapElt<T>* elt) const;
+
+	/**
+	 * Whether the second cost of the element has to be recalculated.
+	 */
+	bool outdated(const HeapElt<T>* elt) const;
+
+	/**
+	 * Remove the element from the two heaps and delete it (with the data).
+	 */
+	void erase_elt(HeapElt<T>* elt);
+
+	/**
+	 * Greatest first cost first (see #shrink).
+	 */
+	struct WorstFirst {
+		bool operator()(const HeapElt<T>* e1, const HeapElt<T>* e2) const {
+			return e1->crit[0] > e2->crit[0];
+		}
+	};
 
 	std::ostream& print(std::ostream& os) const;
 };
@@ -174,15 +258,17 @@ private:
 
 template<class T>
 DoubleHeap<T>::DoubleHeap(CostFunc<T>& cost1, bool update_cost1_when_sorting, CostFunc<T>& cost2, bool update_cost2_when_sorting, int critpr) :
-		 nb_nodes(0), heap1(new SharedHeap<T>(cost1,update_cost1_when_sorting,0)),
+		 lazy_cost2(true), nb_nodes(0), heap1(new SharedHeap<T>(cost1,update_cost1_when_sorting,0)),
 		              heap2(new SharedHeap<T>(cost2,update_cost2_when_sorting,1)),
-		              critpr(critpr), current_heap_id(0) {
+		              critpr(critpr), current_heap_id(0),
+		              nb_contract(0), bound(std::numeric_limits<double>::infinity()), pending(false), nb_pushed(0) {
 
 }
 
 template<class T>
 DoubleHeap<T>::DoubleHeap(const DoubleHeap &dhcp, bool deep_copy) :
-nb_nodes(dhcp.nb_nodes), heap1(NULL), heap2(NULL), critpr(dhcp.critpr), current_heap_id(dhcp.current_heap_id) {
+lazy_cost2(dhcp.lazy_cost2), nb_nodes(dhcp.nb_nodes), heap1(NULL), heap2(NULL), critpr(dhcp.critpr), current_heap_id(dhcp.current_heap_id),
+nb_contract(dhcp.nb_contract), bound(dhcp.bound), pending(dhcp.pending), nb_pushed(dhcp.nb_pushed) {
 	heap1 = new SharedHeap<T>(*dhcp.heap1, 2, deep_copy);
 	std::vector<HeapElt<T>*> p = heap1->elt();
 	heap2 = new SharedHeap<T>(dhcp.heap2->costf, dhcp.heap2->update_cost_when_sorting, dhcp.heap2->heap_id);
@@ -208,6 +294,8 @@ void DoubleHeap<T>::flush() {
 		heap2->clear(SharedHeap<T>::NODE_ELT_DATA);
 		nb_nodes=0;
 	}
+	pending=false;
+	nb_pushed=0;
 }
 
 template<class T>
@@ -217,6 +305,8 @@ void DoubleHeap<T>::clear() {
 		heap2->clear(SharedHeap<T>::NODE_ELT);
 		nb_nodes=0;
 	}
+	pending=false;
+	nb_pushed=0;
 }
 
 template<class T>
@@ -228,60 +318,135 @@ unsigned int DoubleHeap<T>::size() const {
 template<class T>
 void DoubleHeap<T>::contract(double new_loup1) {
 
-	if (nb_nodes==0) return;
+	// data discarded by the previous contraction
+	// must not be restored with a greater bound.
+	if (pending && new_loup1 > bound) prune();
 
-	SharedHeap<T>* copy1 = new SharedHeap<T>(heap1->costf, heap1->update_cost_when_sorting, 0);
+	nb_contract++;
+	bound = new_loup1;
+	pending = true;
 
-	contract_rec(new_loup1, heap1->root, *copy1, !heap2->update_cost_when_sorting);
+	// the heaps are rebuilt if the number of data pushed
+	// since the last rebuild is large enough (amortization)
+	// or if the costs of the second heap cannot be updated lazily
+	if (2*nb_pushed >= nb_nodes || (heap2->update_cost_when_sorting && !lazy_cost2))
+		prune();
+	else
+		update_top();
+}
 
-	heap1->root = copy1->root;
-	heap1->nb_nodes = copy1->size();
-	nb_nodes = copy1->size();
-	copy1->root = NULL;
-	copy1->nb_nodes=0;// avoid to delete heap1 with copy1
-	delete copy1;
+template<class T>
+void DoubleHeap<T>::prune() {
+
+	std::vector<HeapElt<T>*> elts = heap1->elt();
+
+	heap1->clear(SharedHeap<T>::NODE);
+	heap2->clear(SharedHeap<T>::NODE);
+
+	nb_nodes=0;
+
+	for (typename std::vector<HeapElt<T>*>::iterator it=elts.begin(); it!=elts.end(); it++) {
+		HeapElt<T>* elt=*it;
+		if (discarded(elt)) {
+			if (elt->data) delete elt->data;
+			delete elt;
+		} else {
+			if (outdated(elt)) elt->crit[1] = heap2->cost(*elt->data);
+			elt->stamp = nb_contract;
+			heap1->push_elt(elt);
+			heap2->push_elt(elt);
+			nb_nodes++;
+		}
+	}
 
-	if (heap2->update_cost_when_sorting) heap2->sort();
+	pending = false;
+	nb_pushed = 0;
 
 	assert(nb_nodes==heap2->size());
 	assert(nb_nodes==heap1->size());
 	assert(heap1->heap_state());
-	assert(!heap2 || heap2->heap_state());
+	assert(heap2->heap_state());
 }
 
-
 template<class T>
-void DoubleHeap<T>::contract_rec(double new_loup1, HeapNode<T>* node, SharedHeap<T>& heap, bool percolate) {
+void DoubleHeap<T>::shrink(unsigned int n, std::vector<T*>& removed) {
 
-	// the cost are assumed to be up-to-date for the 1st heap
-	if (node->is_sup(new_loup1, 0)) {
-		// we must remove from the other heap all the sub-nodes
-		if (heap2) erase_subnodes(node, percolate);
-	} else {
-		heap.push_elt(node->elt);
-		if (node->left)	 contract_rec(new_loup1, node->left, heap, percolate);
-		if (node->right) contract_rec(new_loup1, node->right, heap, percolate);
+	if (pending) prune();
 
-		delete node;
+	if (nb_nodes<=n) return;
+
+	std::vector<HeapElt<T>*> elts = heap1->elt();
+
+	unsigned int k=nb_nodes-n; // number of data to remove
+
+	std::nth_element(elts.begin(), elts.begin()+k, elts.end(), WorstFirst());
+
+	heap1->clear(SharedHeap<T>::NODE);
+	heap2->clear(SharedHeap<T>::NODE);
+
+	nb_nodes=0;
+
+	for (unsigned int i=0; i<elts.size(); i++) {
+		HeapElt<T>* elt=elts[i];
+		if (i<k) {
+			removed.push_back(elt->data);
+			elt->data=NULL;
+			delete elt;
+		} else {
+			heap1->push_elt(elt);
+			heap2->push_elt(elt);
+			nb_nodes++;
+		}
 	}
+
+	nb_pushed = 0;
+
+	assert(heap1->heap_state());
+	assert(heap2->heap_state());
 }
 
 template<class T>
-void DoubleHeap<T>::erase_subnodes(HeapNode<T>* node, bool percolate) {
-	if (node->left)	erase_subnodes(node->left, percolate);
-	if (node->right) erase_subnodes(node->right, percolate);
-
-	if (!percolate)
-		// there is no need to update the order now in the second heap
-		// since all costs will have to be recalculated.
-		// The heap2 will be sorted at the end (see contract)
-		heap2->erase_node_no_percolate(node->elt->holder[1]);
-	else
-		heap2->erase_node(node->elt->holder[1]);
+void DoubleHeap<T>::update_top() {
+
+	while (nb_nodes>0) {
+		HeapElt<T>* elt1 = heap1->root->elt;
+		if (discarded(elt1)) {
+			erase_elt(elt1);
+			continue;
+		}
+
+		HeapElt<T>* elt2 = heap2->root->elt;
+		if (discarded(elt2)) {
+			erase_elt(elt2);
+		} else if (outdated(elt2)) {
+			double old_cost = elt2->crit[1];
+			elt2->crit[1] = heap2->cost(*elt2->data);
+			elt2->stamp = nb_contract;
+			// if the cost has not increased, the element remains at the top
+			if (elt2->crit[1] > old_cost)
+				heap2->percolate_down(heap2->root);
+		} else
+			break;
+	}
+}
 
-	if (node->elt->data) delete node->elt->data;
-	delete node->elt;
-	delete node;
+template<class T>
+inline bool DoubleHeap<T>::discarded(const HeapElt<T>* elt) const {
+	return elt->stamp < nb_contract && elt->is_sup(bound, 0);
+}
+
+template<class T>
+inline bool DoubleHeap<T>::outdated(const HeapElt<T>* elt) const {
+	return elt->stamp < nb_contract && heap2->update_cost_when_sorting;
+}
+
+template<class T>
+void DoubleHeap<T>::erase_elt(HeapElt<T>* elt) {
+	heap1->erase_node(elt->holder[0]);
+	heap2->erase_node(elt->holder[1]);
+	if (elt->data) delete elt->data;
+	delete elt;
+	nb_nodes--;
 }
 
 template<class T>
@@ -298,12 +463,19 @@ void DoubleHeap<T>::push(T* data) {
 	} else {
 		elt = new HeapElt<T>(data, heap1->cost(*data));
 	}
+	elt->stamp = nb_contract;
 
 	// the data is put into the first heap
 	heap1->push_elt(elt);
 	if (heap2) heap2->push_elt(elt);
 
 	nb_nodes++;
+	nb_pushed++;
+
+	// note: the new element is valid so the top
+	// of the heaps does not need to be updated.
+	if (pending && 2*nb_pushed >= nb_nodes)
+		prune();
 }
 
 template<class T>
@@ -327,6 +499,8 @@ T* DoubleHeap<T>::pop() {
 
 	nb_nodes--;
 
+	update_top();
+
 	assert(heap1->heap_state());
 	assert(!heap2 || heap2->heap_state());
 
@@ -98,6 +98,17 @@ public:
 	 */
 	void contract(double lb);
 
+	/**
+	 * \brief Shrink the heap.
+	 *
+	 * Removes from the heap the elements with the greatest cost so
+	 * that \a n elements at most remain, and appends them to \a removed
+	 * (they are not deleted).
+	 *
+	 * Complexity: O(size)
+	 */
+	void shrink(unsigned int n, std::vector<T*>& removed);
+
 	/** Return the minimum (the criterion for
 	 * the first element) */
 	double minimum() const;
@@ -138,6 +149,14 @@ struct HeapComparator {
 	}
 };
 
+/* greatest cost first (strict ordering, for nth_element) */
+template<class T>
+struct HeapWorstFirst {
+	bool operator()(const std::pair<T*,double>& c1, const std::pair<T*,double>& c2) {
+		return c1.second > c2.second;
+	}
+};
+
 template<class T>
 Heap<T>::Heap(CostFunc<T>& costf) : costf(costf) {
 
@@ -193,6 +212,22 @@ void Heap<T>::contract(double loup) {
 
 }
 
+template<class T>
+void Heap<T>::shrink(unsigned int n, std::vector<T*>& removed) {
+	if (l.size()<=n) return;
+
+	unsigned int k=l.size()-n; // number of elements to remove
+
+	nth_element(l.begin(), l.begin()+k, l.end(), HeapWorstFirst<T>());
+
+	for (unsigned int i=0; i<k; i++)
+		removed.push_back(l[i].first);
+
+	l.erase(l.begin(),l.begin()+k);
+
+	make_heap(l.begin(), l.end() ,HeapComparator<T>());
+}
+
 template<class T>
 bool Heap<T>::empty() const {
 	return l.empty();
@@ -18,7 +18,7 @@ namespace ibex {
  * \brief Generate an identifier.
  *
  * This function returns a unique number in the
- * whole execution of the program.
+ * whole execution of the program (and is thread-safe).
  */
 long next_id();
 
@@ -0,0 +1,171 @@
+/* ============================================================================
+ * I B E X - Priority Agenda
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_PRIORITY_AGENDA_H__
+#define __IBEX_PRIORITY_AGENDA_H__
+
+#include "ibex_Agenda.h"
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Priority agenda.
+ *
+ * A fixed-size set of positive integers where each element has a priority.
+ * In particular:
+ * - The "push" operation adds an element with some priority; if the element is
+ *   already present, the priority is increased instead.
+ * - The "pop" operation retrieves the element with the highest priority (the
+ *   smallest element in case of ties).
+ *
+ * Implemented with an indexed binary heap (all operations are in O(log(size))).
+ */
+class PriorityAgenda {
+
+public:
+
+	/**
+	 * \brief Create the agenda.
+	 *
+	 * All elements will be inside the range [0,size-1].
+	 */
+	PriorityAgenda(int size) : size(size), nb(0) {
+		heap = new int[size];
+		pos = new int[size];
+		prio = new double[size];
+		for (int i=0; i<size; i++) {
+			pos[i]=-1;
+			prio[i]=0;
+		}
+	}
+
+	/**
+	 * \brief Delete this.
+	 */
+	~PriorityAgenda() {
+		delete[] heap;
+		delete[] pos;
+		delete[] prio;
+	}
+
+	/**
+	 * \brief Push an integer with a given priority.
+	 *
+	 * If p is already in the agenda, its priority is increased by \a gain.
+	 */
+	inline void push(int p, double gain) {
+		assert(p>=0 && p<size);
+		if (pos[p]==-1) {
+			prio[p] = gain;
+			pos[p] = nb;
+			heap[nb++] = p;
+		} else
+			prio[p] += gain;
+		sift_up(pos[p]);
+	}
+
+	/**
+	 * \brief Pop the integer with the highest priority.
+	 *
+	 * \throw EmptyAgendaException if the agenda is empty.
+	 */
+	inline void pop(int& p) {
+		if (nb==0) throw EmptyAgendaException();
+
+		p = heap[0];
+		pos[p] = -1;
+		nb--;
+		if (nb>0) {
+			heap[0] = heap[nb];
+			pos[heap[0]] = 0;
+			sift_down(0);
+		}
+	}
+
+	/**
+	 * \brief Current priority of p.
+	 *
+	 * \pre p must be in the agenda.
+	 */
+	inline double priority(int p) const {
+		assert(p>=0 && p<size && pos[p]!=-1);
+		return prio[p];
+	}
+
+	/**
+	 * \brief Remove all integers
+	 */
+	inline void flush() {
+		for (int i=0; i<nb; i++)
+			pos[heap[i]]=-1;
+		nb=0;
+	}
+
+	/**
+	 * \brief True iff the agenda is empty.
+	 */
+	inline bool empty() const {
+		return nb==0;
+	}
+
+	/**
+	 * \brief The size defining the range of the agenda.
+	 *
+	 * All elements must be inside [0,size-1].
+	 */
+	const int size;
+
+protected:
+	// true iff element a has to be popped before b
+	inline bool before(int a, int b) const {
+		return prio[a]>prio[b] || (prio[a]==prio[b] && a<b);
+	}
+
+	inline void swap(int i, int j) {
+		int tmp=heap[i];
+		heap[i]=heap[j];
+		heap[j]=tmp;
+		pos[heap[i]]=i;
+		pos[heap[j]]=j;
+	}
+
+	inline void sift_up(int i) {
+		while (i>0 && before(heap[i],heap[(i-1)/2])) {
+			swap(i,(i-1)/2);
+			i=(i-1)/2;
+		}
+	}
+
+	inline void sift_down(int i) {
+		while (true) {
+			int best=i;
+			int l=2*i+1;
+			int r=2*i+2;
+			if (l<nb && before(heap[l],heap[best])) best=l;
+			if (r<nb && before(heap[r],heap[best])) best=r;
+			if (best==i) return;
+			swap(i,best);
+			i=best;
+		}
+	}
+
+	int nb;       // number of elements
+	int *heap;    // the binary heap
+	int *pos;     // position of each element in the heap (-1 if absent)
+	double *prio; // priorities
+
+private:
+	PriorityAgenda(const PriorityAgenda&); // forbidden
+};
+
+} // namespace ibex
+
+#endif // __IBEX_PRIORITY_AGENDA_H__
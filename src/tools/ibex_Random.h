@@ -90,7 +90,9 @@ namespace ibex {
 
 	private:
 		static const uint32_t x0,y0,z0;
-		static uint32_t x,y,z,seed;
+		// thread-local, so that concurrent threads (e.g., asynchronous
+		// upper bounding) do not race on the generator state.
+		static thread_local uint32_t x,y,z,seed;
 	};
 }
 
@@ -309,6 +309,10 @@ private:
 	/** The node that holds this element, for each heap. */
 	HeapNode<T>** holder;
 
+	/** Number of contractions of the double heap when
+	 * the criteria were calculated (see DoubleHeap). */
+	unsigned int stamp;
+
 	template<class U>
 	friend std::ostream& operator<<(std::ostream& os, const HeapElt<U>& node) ;
 
@@ -701,13 +705,13 @@ void HeapNode<T>::switch_elt(HeapNode<T>* node, int heap_id) {
 //}
 
 template<class T>
-HeapElt<T>::HeapElt(T* data, double crit_1) : data(data), /*nb_heaps(1),*/ crit(new double[1]), holder(new HeapNode<T>*[1]){
+HeapElt<T>::HeapElt(T* data, double crit_1) : data(data), /*nb_heaps(1),*/ crit(new double[1]), holder(new HeapNode<T>*[1]), stamp(0) {
 	crit[0] = crit_1;
 	holder[0] = NULL;
 }
 
 template<class T>
-HeapElt<T>::HeapElt(T* data, double crit_1, double crit_2) : data(data), /*nb_heaps(2),*/ crit(new double[2]), holder(new HeapNode<T>*[2]){
+HeapElt<T>::HeapElt(T* data, double crit_1, double crit_2) : data(data), /*nb_heaps(2),*/ crit(new double[2]), holder(new HeapNode<T>*[2]), stamp(0) {
 	crit[0] = crit_1;
 	crit[1] = crit_2;
 	holder[0] = NULL;
@@ -715,7 +719,7 @@ HeapElt<T>::HeapElt(T* data, double crit_1, double crit_2) : data(data), /*nb_he
 }
 
 template<class T>
-HeapElt<T>::HeapElt(const HeapElt<T>& elt, int nb_crit, bool deep) : data(NULL), crit(new double[nb_crit]), holder(new HeapNode<T>*[nb_crit]) {
+HeapElt<T>::HeapElt(const HeapElt<T>& elt, int nb_crit, bool deep) : data(NULL), crit(new double[nb_crit]), holder(new HeapNode<T>*[nb_crit]), stamp(elt.stamp) {
 	for(int i=0; i<nb_crit; i++) {
         crit[i] = elt.crit[i];
         holder[i] = NULL;
@@ -0,0 +1,77 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ThreadPool.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_ThreadPool.h"
+#include "ibex_Exception.h"
+
+using namespace std;
+
+namespace ibex {
+
+ThreadPool::ThreadPool(int nb_threads) : nb_threads(nb_threads), stopped(false) {
+
+	if (nb_threads<1)
+		ibex_error("[ThreadPool] at least one thread is required");
+
+	for (int i=1; i<nb_threads; i++)
+		threads.push_back(thread(&ThreadPool::run, this, i));
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		lock_guard<std::mutex> lock(mtx);
+		stopped = true;
+		tasks.clear();
+	}
+	task_cond.notify_all();
+
+	for (vector<thread>::iterator it=threads.begin(); it!=threads.end(); it++)
+		it->join();
+}
+
+future<void> ThreadPool::submit(const function<void(int)>& task) {
+	packaged_task<void(int)> t(task);
+	future<void> f=t.get_future();
+
+	if (threads.empty()) {
+		t(0);
+		return f;
+	}
+
+	{
+		lock_guard<std::mutex> lock(mtx);
+		tasks.push_back(std::move(t));
+	}
+	task_cond.notify_one();
+
+	return f;
+}
+
+void ThreadPool::discard() {
+	lock_guard<std::mutex> lock(mtx);
+	tasks.clear();
+}
+
+void ThreadPool::run(int i) {
+	unique_lock<std::mutex> lock(mtx);
+
+	while (true) {
+		task_cond.wait(lock, [this] { return stopped || !tasks.empty(); });
+
+		if (stopped) break;
+
+		packaged_task<void(int)> t(std::move(tasks.front()));
+		tasks.pop_front();
+
+		lock.unlock();
+		t(i); // exceptions are stored in the future
+		lock.lock();
+	}
+}
+
+} /* namespace ibex */
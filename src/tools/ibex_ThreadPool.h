@@ -0,0 +1,102 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ThreadPool.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_THREAD_POOL_H__
+#define __IBEX_THREAD_POOL_H__
+
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+
+namespace ibex {
+
+/** \ingroup tools
+ *
+ * \brief Pool of persistent threads.
+ *
+ * The threads are created once (by the constructor) and run the
+ * submitted tasks in the order of submission, so that a parallel
+ * algorithm does not pay the creation of threads at each step.
+ *
+ * A task is given the number of the thread that runs it, from 1 to
+ * #nb_threads-1 (0 stands for the thread that owns the pool), so that
+ * each thread can work on its own data (e.g., a copy of a system or of
+ * a contractor, as function evaluation is not thread-safe).
+ *
+ * A pool with #nb_threads=1 has no thread: the tasks are run
+ * immediately, by the calling thread (with number 0).
+ */
+class ThreadPool {
+public:
+
+	/**
+	 * \brief Launch the threads.
+	 *
+	 * \param nb_threads - number of threads, including the one that
+	 *                     owns the pool (nb_threads-1 threads are created).
+	 */
+	explicit ThreadPool(int nb_threads);
+
+	/**
+	 * \brief Delete this.
+	 *
+	 * The pending tasks are discarded (their futures get a broken_promise
+	 * error) and the threads are joined once their current task is over.
+	 */
+	~ThreadPool();
+
+	/**
+	 * \brief Submit a task.
+	 *
+	 * \param task - called with the number of the thread that runs it.
+	 * \return       a future that gets ready when the task is over. An
+	 *               exception raised by the task is rethrown by get().
+	 */
+	std::future<void> submit(const std::function<void(int)>& task);
+
+	/**
+	 * \brief Discard the pending tasks.
+	 *
+	 * Their futures get a broken_promise error. The tasks in
+	 * progress are not interrupted.
+	 */
+	void discard();
+
+	/** Number of threads (including the one that owns the pool). */
+	const int nb_threads;
+
+protected:
+
+	/**
+	 * Main loop of the thread i.
+	 */
+	void run(int i);
+
+	/** The threads. */
+	std::vector<std::thread> threads;
+
+	/** Pending tasks. */
+	std::deque<std::packaged_task<void(int)> > tasks;
+
+	/** Protects the tasks and the stop flag. */
+	std::mutex mtx;
+
+	/** Notified when a task is submitted or the pool is deleted. */
+	std::condition_variable task_cond;
+
+	/** True if the threads must stop. */
+	bool stopped;
+};
+
+} /* namespace ibex */
+
+#endif /* __IBEX_THREAD_POOL_H__ */
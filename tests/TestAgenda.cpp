@@ -11,6 +11,7 @@
 
 #include "TestAgenda.h"
 #include "ibex_Agenda.h"
+#include "ibex_PriorityAgenda.h"
 #include "utils.h"
 #include <float.h>
 
@@ -128,3 +129,30 @@ void TestAgenda::push01() {
 	CPPUNIT_ASSERT(((i=a.next(i))==a.end()));
 }
 
+void TestAgenda::priority01() {
+	PriorityAgenda a(10);
+	a.push(1,0.5);
+	a.push(4,2.0);
+	a.push(0,0.5);
+	a.push(7,1.0);
+	a.push(1,1.0); // 1 has now priority 1.5
+	int i;
+	CPPUNIT_ASSERT(a.priority(1)==1.5);
+	a.pop(i);
+	CPPUNIT_ASSERT(i==4);
+	a.pop(i);
+	CPPUNIT_ASSERT(i==1);
+	a.push(9,0.5);
+	a.pop(i);
+	CPPUNIT_ASSERT(i==7);
+	a.pop(i); // tie: smallest first
+	CPPUNIT_ASSERT(i==0);
+	a.pop(i);
+	CPPUNIT_ASSERT(i==9);
+	CPPUNIT_ASSERT(a.empty());
+	a.push(3,1.0);
+	a.flush();
+	CPPUNIT_ASSERT(a.empty());
+	a.push(3,1.0); // the former priority is forgotten
+	CPPUNIT_ASSERT(a.priority(3)==1.0);
+}
@@ -28,6 +28,7 @@ public:
 	CPPUNIT_TEST(swap);
 	CPPUNIT_TEST(push01);
 	CPPUNIT_TEST(pop01);
+	CPPUNIT_TEST(priority01);
 	CPPUNIT_TEST_SUITE_END();
 private:
 
@@ -36,6 +37,7 @@ private:
 	void swap();
 	void push01();
 	void pop01();
+	void priority01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestAgenda);
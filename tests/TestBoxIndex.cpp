@@ -0,0 +1,110 @@
+/* ============================================================================
+ * I B E X - BoxIndex Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestBoxIndex.h"
+#include "ibex_Random.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+IntervalVector random_box(int n, double width) {
+	IntervalVector box(n);
+	for (int i=0; i<n; i++) {
+		double lb=RNG::rand(-10,10);
+		box[i]=Interval(lb,lb+RNG::rand(0,width));
+	}
+	return box;
+}
+
+}
+
+void TestBoxIndex::empty() {
+	BoxIndex index(2);
+	CPPUNIT_ASSERT(index.empty());
+	CPPUNIT_ASSERT(index.size()==0);
+	CPPUNIT_ASSERT(index.find_superset(IntervalVector(2,Interval(0,1)))==-1);
+
+	vector<int> ids;
+	index.find_intersecting(IntervalVector(2,Interval(0,1)), ids);
+	CPPUNIT_ASSERT(ids.empty());
+}
+
+void TestBoxIndex::superset() {
+	RNG::srand(1);
+	int n=3;
+	BoxIndex index(n);
+	vector<IntervalVector> boxes;
+
+	for (int k=0; k<500; k++) {
+		boxes.push_back(random_box(n,4));
+		index.add(boxes.back(), k);
+	}
+	CPPUNIT_ASSERT(index.size()==500);
+
+	for (int k=0; k<500; k++) {
+		// a sub-box of a stored box
+		IntervalVector q=boxes[k].mid();
+		int id=index.find_superset(q);
+		CPPUNIT_ASSERT(id!=-1 && q.is_subset(boxes[id]));
+
+		// any box
+		q=random_box(n,1);
+		id=index.find_superset(q);
+		bool found=false;
+		for (size_t j=0; j<boxes.size(); j++)
+			if (q.is_subset(boxes[j])) found=true;
+		CPPUNIT_ASSERT(found == (id!=-1));
+		if (id!=-1) CPPUNIT_ASSERT(q.is_subset(boxes[id]));
+	}
+}
+
+void TestBoxIndex::intersecting() {
+	RNG::srand(1);
+	int n=2;
+	BoxIndex index(n);
+	vector<IntervalVector> boxes;
+
+	for (int k=0; k<300; k++) {
+		boxes.push_back(random_box(n,2));
+		index.add(boxes.back(), k);
+	}
+
+	for (int k=0; k<100; k++) {
+		IntervalVector q=random_box(n,3);
+		vector<int> ids;
+		index.find_intersecting(q, ids);
+		sort(ids.begin(), ids.end());
+
+		vector<int> expected;
+		for (size_t j=0; j<boxes.size(); j++)
+			if (q.intersects(boxes[j])) expected.push_back(j);
+
+		CPPUNIT_ASSERT(ids==expected);
+	}
+}
+
+void TestBoxIndex::clear() {
+	BoxIndex index(1);
+	index.add(IntervalVector(1,Interval(0,1)), 0);
+	index.add(IntervalVector(1,Interval(2,3)), 1);
+	CPPUNIT_ASSERT(index.find_superset(IntervalVector(1,Interval(2.5)))==1);
+	index.clear();
+	CPPUNIT_ASSERT(index.empty());
+	CPPUNIT_ASSERT(index.find_superset(IntervalVector(1,Interval(2.5)))==-1);
+	index.add(IntervalVector(1,Interval(2,3)), 0);
+	CPPUNIT_ASSERT(index.find_superset(IntervalVector(1,Interval(2.5)))==0);
+}
+
+} // end namespace
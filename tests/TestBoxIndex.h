@@ -0,0 +1,45 @@
+/* ============================================================================
+ * I B E X - BoxIndex Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_BOX_INDEX_H__
+#define __TEST_BOX_INDEX_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "ibex_BoxIndex.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestBoxIndex : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestBoxIndex);
+	CPPUNIT_TEST(empty);
+	CPPUNIT_TEST(superset);
+	CPPUNIT_TEST(intersecting);
+	CPPUNIT_TEST(clear);
+	CPPUNIT_TEST_SUITE_END();
+
+	void empty();
+
+	// same result as a linear scan (random boxes)
+	void superset();
+	void intersecting();
+
+	void clear();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestBoxIndex);
+
+} // end namespace
+
+#endif // __TEST_BOX_INDEX_H__
@@ -0,0 +1,185 @@
+/* ============================================================================
+ * I B E X - C interface Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCApi.h"
+#include "ibex_System.h"
+
+#include <cstring>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const char* sys_file=SRCDIR_TESTS "/minibex/capi.bch";
+
+const char* func_file=SRCDIR_TESTS "/minibex/capi.mbx";
+
+/*
+ * Two boxes (lower/upper bounds).
+ */
+double lb[]={ 0, 1,  -1, -0.5 };
+double ub[]={ 1, 2,   0,  0.5 };
+
+IntervalVector box(int k) {
+	IntervalVector x(2);
+	for (int i=0; i<2; i++)
+		x[i]=Interval(lb[2*k+i],ub[2*k+i]);
+	return x;
+}
+
+}
+
+void TestCApi::system01() {
+	ibex_system* sys=ibex_system_load(sys_file);
+	CPPUNIT_ASSERT(sys);
+	CPPUNIT_ASSERT(ibex_system_nb_var(sys)==2);
+	CPPUNIT_ASSERT(ibex_system_nb_ctr(sys)==2);
+	CPPUNIT_ASSERT(ibex_system_goal(sys)==NULL);
+
+	double blb[2],bub[2];
+	ibex_system_box(sys,blb,bub);
+	CPPUNIT_ASSERT(blb[0]==-10 && bub[0]==10 && blb[1]==-10 && bub[1]==10);
+
+	ibex_function* f=ibex_system_ctrs(sys);
+	CPPUNIT_ASSERT(ibex_function_nb_var(f)==2);
+	CPPUNIT_ASSERT(ibex_function_image_dim(f)==2);
+	ibex_function_free(f); // no effect
+	ibex_system_free(sys);
+}
+
+void TestCApi::eval01() {
+	System sys(sys_file);
+	ibex_system* csys=ibex_system_load(sys_file);
+	ibex_function* f=ibex_system_ctrs(csys);
+
+	double ylb[4],yub[4];
+	CPPUNIT_ASSERT(ibex_function_eval(f,2,lb,ub,ylb,yub)==0);
+
+	for (int k=0; k<2; k++) {
+		IntervalVector y=sys.f_ctrs.eval_vector(box(k));
+		for (int i=0; i<2; i++) {
+			CPPUNIT_ASSERT(ylb[2*k+i]==y[i].lb());
+			CPPUNIT_ASSERT(yub[2*k+i]==y[i].ub());
+		}
+	}
+	ibex_system_free(csys);
+}
+
+void TestCApi::eval02() {
+	ibex_function* f=ibex_function_load(func_file);
+	CPPUNIT_ASSERT(f);
+
+	double xlb[]={ -2, 0,  1, 0 };
+	double xub[]={ -1, 1,  4, 1 };
+	double ylb[4],yub[4];
+	CPPUNIT_ASSERT(ibex_function_eval(f,2,xlb,xub,ylb,yub)==0);
+
+	// first box: sqrt(x) is empty
+	CPPUNIT_ASSERT(ylb[0]>yub[0] && ylb[1]>yub[1]);
+	CPPUNIT_ASSERT(ylb[2]==1 && yub[2]==3);
+	CPPUNIT_ASSERT(ylb[3]==0 && yub[3]==4);
+
+	ibex_function_free(f);
+}
+
+void TestCApi::jacobian01() {
+	System sys(sys_file);
+	ibex_system* csys=ibex_system_load(sys_file);
+	ibex_function* f=ibex_system_ctrs(csys);
+
+	double Jlb[8],Jub[8];
+	CPPUNIT_ASSERT(ibex_function_jacobian(f,2,lb,ub,Jlb,Jub)==0);
+
+	for (int k=0; k<2; k++) {
+		IntervalMatrix J=sys.f_ctrs.jacobian(box(k));
+		for (int i=0; i<2; i++)
+			for (int j=0; j<2; j++) {
+				CPPUNIT_ASSERT(Jlb[4*k+2*i+j]==J[i][j].lb());
+				CPPUNIT_ASSERT(Jub[4*k+2*i+j]==J[i][j].ub());
+			}
+	}
+	ibex_system_free(csys);
+}
+
+void TestCApi::contract01() {
+	ibex_system* sys=ibex_system_load(sys_file);
+	ibex_ctc* c=ibex_ctc_hc4(sys);
+	CPPUNIT_ASSERT(c);
+
+	double clb[]={ 0, 0,  2, 2 };
+	double cub[]={ 2, 2,  3, 3 };
+	int empty[2];
+	CPPUNIT_ASSERT(ibex_ctc_contract(c,2,clb,cub,empty)==1);
+	CPPUNIT_ASSERT(!empty[0] && empty[1]);
+	CPPUNIT_ASSERT(cub[0]<=1 && cub[1]<=1);
+	CPPUNIT_ASSERT(clb[0]<=::sqrt(0.5) && cub[0]>=::sqrt(0.5));
+	CPPUNIT_ASSERT(clb[2]>cub[2]);
+
+	ibex_ctc_free(c);
+	ibex_system_free(sys);
+}
+
+void TestCApi::contract02() {
+	ibex_function* f=ibex_function_load(func_file);
+
+	double ylb[]={ 3, 2 };
+	double yub[]={ 3, 2 };
+	ibex_ctc* fb=ibex_ctc_fwdbwd(f,ylb,yub);
+	CPPUNIT_ASSERT(fb);
+
+	// solution: x=4, y=1/2
+	double xlb[]={ 0, 0 };
+	double xub[]={ 5, 5 };
+	CPPUNIT_ASSERT(ibex_ctc_contract(fb,1,xlb,xub,NULL)==0);
+	CPPUNIT_ASSERT(xlb[0]>0 && xub[1]<5);
+
+	ibex_ctc* newton=ibex_ctc_newton(f);
+	CPPUNIT_ASSERT(newton);
+	ibex_ctc_free(newton);
+
+	ibex_ctc_free(fb);
+	ibex_function_free(f);
+}
+
+void TestCApi::solve01() {
+	ibex_system* sys=ibex_system_load(sys_file);
+	ibex_solver* s=ibex_solver_new(sys,1e-8,1e-2);
+	CPPUNIT_ASSERT(s);
+
+	CPPUNIT_ASSERT(ibex_solver_solve(s,NULL,NULL)==0); // SUCCESS
+	CPPUNIT_ASSERT(ibex_solver_nb_solution(s)==2);
+	CPPUNIT_ASSERT(ibex_solver_nb_unknown(s)==0);
+
+	double slb[4],sub[4];
+	ibex_solver_solutions(s,slb,sub);
+	for (int j=0; j<2; j++)
+		for (int i=0; i<2; i++) {
+			CPPUNIT_ASSERT(slb[2*j+i]<=sub[2*j+i]);
+			CPPUNIT_ASSERT(Interval(slb[2*j+i],sub[2*j+i]).contains(slb[2*j+i]>0? ::sqrt(0.5) : -::sqrt(0.5)));
+		}
+
+	// solve again in a sub-box
+	double blb[]={ 0, 0 };
+	double bub[]={ 10, 10 };
+	CPPUNIT_ASSERT(ibex_solver_solve(s,blb,bub)==0);
+	CPPUNIT_ASSERT(ibex_solver_nb_solution(s)==1);
+
+	ibex_solver_free(s);
+	ibex_system_free(sys);
+}
+
+void TestCApi::error01() {
+	CPPUNIT_ASSERT(ibex_system_load(SRCDIR_TESTS "/quimper/error01.qpr")==NULL);
+	CPPUNIT_ASSERT(strlen(ibex_last_error())>0);
+}
+
+} // end namespace
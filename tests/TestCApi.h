@@ -0,0 +1,65 @@
+/* ============================================================================
+ * I B E X - C interface Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_C_API_H__
+#define __TEST_C_API_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "ibex_CApi.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCApi : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCApi);
+	CPPUNIT_TEST(system01);
+	CPPUNIT_TEST(eval01);
+	CPPUNIT_TEST(eval02);
+	CPPUNIT_TEST(jacobian01);
+	CPPUNIT_TEST(contract01);
+	CPPUNIT_TEST(contract02);
+	CPPUNIT_TEST(solve01);
+	CPPUNIT_TEST(error01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// loading a system
+	void system01();
+
+	// batch evaluation (same result as the C++ interface)
+	void eval01();
+
+	// evaluation outside the definition domain
+	void eval02();
+
+	// batch jacobian (same result as the C++ interface)
+	void jacobian01();
+
+	// HC4 on a batch of boxes (one becomes empty)
+	void contract01();
+
+	// forward-backward and Newton contractors
+	void contract02();
+
+	// solving a system
+	void solve01();
+
+	// syntax error
+	void error01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCApi);
+
+} // end namespace
+
+#endif // __TEST_C_API_H__
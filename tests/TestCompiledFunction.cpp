@@ -0,0 +1,119 @@
+/* ============================================================================
+ * I B E X - CompiledFunction Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCompiledFunction.h"
+#include "ibex_Expr.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestCompiledFunction::sqr01() {
+	Variable x;
+	Function f(x,x*x);
+	IntervalVector box(1,Interval(-1,2));
+	CPPUNIT_ASSERT(f.eval(box)==Interval(0,4));
+}
+
+void TestCompiledFunction::sum_eval() {
+	Variable x,y,z,w;
+	Function f(x,y,z,w,x+y-z+w);
+
+	double _box[][2]= { {0,0.1}, {1,1.3}, {-0.7,2}, {1e-10,3} };
+	IntervalVector box(4,_box);
+
+	CPPUNIT_ASSERT(f.eval(box)==box[0]+box[1]-box[2]+box[3]);
+}
+
+void TestCompiledFunction::sum_bwd() {
+	Variable x,y,z;
+	Function f(x,y,z,x+y-z);
+
+	double _box[][2]= { {0,1}, {0,1}, {0,4} };
+	IntervalVector box(3,_box);
+
+	f.backward(Interval::zero(),box);
+
+	double _res[][2]= { {0,1}, {0,1}, {0,2} };
+	CPPUNIT_ASSERT(box==IntervalVector(3,_res));
+
+	box[2]=Interval(3,4);
+	f.backward(Interval::zero(),box);
+	CPPUNIT_ASSERT(box.is_empty());
+}
+
+void TestCompiledFunction::sum_ibwd() {
+	Variable x,y,z;
+	Function f(x,y,z,x+y-z);
+
+	IntervalVector box(3,Interval(-1,1));
+
+	f.ibwd(Interval(0,1),box);
+
+	CPPUNIT_ASSERT(!box.is_empty());
+	CPPUNIT_ASSERT(f.eval(box).is_subset(Interval(0,1)));
+}
+
+void TestCompiledFunction::sum_gradient() {
+	Variable x,y,z,w;
+	Function f(x,y,z,w,x+y-z-w*x);
+
+	IntervalVector box(4,Interval(1,2));
+
+	IntervalVector g=f.gradient(box);
+	CPPUNIT_ASSERT(g[0]==Interval(1)-box[3]);
+	CPPUNIT_ASSERT(g[1]==Interval(1));
+	CPPUNIT_ASSERT(g[2]==Interval(-1));
+	CPPUNIT_ASSERT(g[3]==-box[0]);
+}
+
+void TestCompiledFunction::sum_shared() {
+	Variable x,y,z;
+	const ExprNode& e=x+y;
+	Function f(x,y,z,Return(e-z,e*z));
+
+	double _box[][2]= { {0,1}, {2,3}, {-1,1} };
+	IntervalVector box(3,_box);
+
+	IntervalVector res=f.eval_vector(box);
+	CPPUNIT_ASSERT(res[0]==(box[0]+box[1])-box[2]);
+	CPPUNIT_ASSERT(res[1]==(box[0]+box[1])*box[2]);
+}
+
+void TestCompiledFunction::mul_cst_matrix() {
+	double _A[]={1,1,1,-1};
+	Matrix A(2,2,_A);
+
+	Variable x(2);
+	Function f(x,A*x);
+
+	// same function, with the matrix as argument
+	Variable a(2,2),x2(2);
+	Function g(a,x2,a*x2);
+
+	IntervalVector box(2,Interval(-10,10));
+	IntervalVector gbox(6);
+	gbox.put(0,IntervalVector(4,Interval::one()));
+	gbox[3]=Interval(-1);
+	gbox.put(4,box);
+
+	CPPUNIT_ASSERT(f.eval_vector(box)==g.eval_vector(gbox));
+
+	IntervalVector y(2);
+	y[0]=Interval(2);
+	y[1]=Interval(0);
+	f.backward(y,box);
+	g.backward(y,gbox);
+	CPPUNIT_ASSERT(box==gbox.subvector(4,5));
+	CPPUNIT_ASSERT(box.contains(Vector::ones(2)));
+	CPPUNIT_ASSERT(box.is_strict_subset(IntervalVector(2,Interval(-10,10))));
+}
+
+} // end namespace
@@ -0,0 +1,56 @@
+/* ============================================================================
+ * I B E X - CompiledFunction Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_COMPILED_FUNCTION_H__
+#define __TEST_COMPILED_FUNCTION_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "ibex_Function.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCompiledFunction : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCompiledFunction);
+	CPPUNIT_TEST(sqr01);
+	CPPUNIT_TEST(sum_eval);
+	CPPUNIT_TEST(sum_bwd);
+	CPPUNIT_TEST(sum_ibwd);
+	CPPUNIT_TEST(sum_gradient);
+	CPPUNIT_TEST(sum_shared);
+	CPPUNIT_TEST(mul_cst_matrix);
+	CPPUNIT_TEST_SUITE_END();
+
+	// x*x is evaluated as a square
+	void sqr01();
+
+	// a chain of additions/subtractions gives the same
+	// result as the binary operations
+	void sum_eval();
+	void sum_bwd();
+	void sum_ibwd();
+	void sum_gradient();
+
+	// an intermediate sum used elsewhere is not fused
+	void sum_shared();
+
+	// product of a constant matrix by a vector
+	void mul_cst_matrix();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCompiledFunction);
+
+} // end namespace
+
+#endif // __TEST_COMPILED_FUNCTION_H__
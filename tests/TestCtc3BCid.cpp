@@ -0,0 +1,57 @@
+/* ============================================================================
+ * I B E X - Ctc3BCid Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtc3BCid.h"
+#include "ibex_CtcFwdBwd.h"
+#include "Ponts30.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestCtc3BCid::check_parallel(int s3b, int scid, int nb_threads) {
+	// one instance of the problem per thread
+	Array<Ponts30> p30(nb_threads);
+	Array<Ctc> ctcs(nb_threads-1);
+	for (int i=0; i<nb_threads; i++) {
+		p30.set_ref(i, *new Ponts30());
+		if (i>0) ctcs.set_ref(i-1, *new CtcFwdBwd(*p30[i].f));
+	}
+
+	CtcFwdBwd ctc(*p30[0].f);
+
+	Ctc3BCid seq(ctc, s3b, scid);
+	IntervalVector box1(p30[0].init_box);
+	seq.contract(box1);
+
+	Ctc3BCid par(ctc, s3b, scid);
+	par.set_parallel(ctcs);
+	IntervalVector box2(p30[0].init_box);
+	par.contract(box2);
+
+	CPPUNIT_ASSERT(box1.is_strict_subset(p30[0].init_box));
+	CPPUNIT_ASSERT(box1==box2);
+
+	for (int i=0; i<nb_threads-1; i++) {
+		delete &ctcs[i];
+		delete &p30[i+1];
+	}
+	delete &p30[0];
+}
+
+void TestCtc3BCid::parallel01() {
+	check_parallel(Ctc3BCid::default_s3b, Ctc3BCid::default_scid, 2);
+}
+
+void TestCtc3BCid::parallel02() {
+	check_parallel(7, 5, 4);
+}
+
+} // end namespace ibex
@@ -0,0 +1,42 @@
+/* ============================================================================
+ * I B E X - Ctc3BCid Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_3B_CID_H__
+#define __TEST_CTC_3B_CID_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "ibex_Ctc3BCid.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtc3BCid : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtc3BCid);
+	CPPUNIT_TEST(parallel01);
+	CPPUNIT_TEST(parallel02);
+	CPPUNIT_TEST_SUITE_END();
+
+	void parallel01();
+	void parallel02();
+
+private:
+	void check_parallel(int s3b, int scid, int nb_threads);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtc3BCid);
+
+} // namespace ibex
+
+#endif // __TEST_CTC_3B_CID_H__
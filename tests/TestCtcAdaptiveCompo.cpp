@@ -0,0 +1,78 @@
+/* ============================================================================
+ * I B E X - CtcAdaptiveCompo Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcAdaptiveCompo.h"
+#include "ibex_CtcIdentity.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_SystemFactory.h"
+#include "ibex_Solver.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CellStack.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestCtcAdaptiveCompo::throttle01() {
+	Variable x,y;
+	Function f(x,y,x-y);
+	CtcFwdBwd c(f);
+	CtcIdentity id(2);
+
+	CtcAdaptiveCompo compo(id,c,10);
+
+	int n=1000;
+	for (int k=0; k<n; k++) {
+		double _box[][2]={{0,2},{1,3}};
+		IntervalVector box(2,_box);
+		compo.contract(box);
+		CPPUNIT_ASSERT(box[0]==Interval(1,2));
+		CPPUNIT_ASSERT(box[1]==Interval(1,2));
+	}
+
+	CPPUNIT_ASSERT(compo.rate(0)==0);
+	CPPUNIT_ASSERT(compo.rate(1)>0);
+	// the productive contractor is always applied
+	CPPUNIT_ASSERT(compo.nb_applied(1)==n);
+	// the unproductive one is applied at least every "period" calls
+	// and at most a logarithmic number of times otherwise
+	CPPUNIT_ASSERT(compo.nb_applied(0)>=n/10);
+	CPPUNIT_ASSERT(compo.nb_applied(0)<=n/10+2*::log(n)+1);
+}
+
+void TestCtcAdaptiveCompo::solve01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(sqr(x-1)+sqr(y)=1);
+
+	System sys(f);
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(sys);
+	CtcIdentity id(2);
+	CtcAdaptiveCompo compo(hc4,id);
+	Vector prec(2,1e-3);
+
+	Solver solver(sys,compo,rr,stack,prec,prec);
+	solver.solve(IntervalVector(2,Interval(-10,10)));
+
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==2);
+	CPPUNIT_ASSERT(compo.nb_applied(0)==solver.get_nb_cells());
+	CPPUNIT_ASSERT(compo.nb_applied(1)<compo.nb_applied(0));
+}
+
+} // end namespace ibex
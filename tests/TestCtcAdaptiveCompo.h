@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - CtcAdaptiveCompo Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_ADAPTIVE_COMPO_H__
+#define __TEST_CTC_ADAPTIVE_COMPO_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "ibex_CtcAdaptiveCompo.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcAdaptiveCompo : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcAdaptiveCompo);
+	CPPUNIT_TEST(throttle01);
+	CPPUNIT_TEST(solve01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void throttle01();
+	void solve01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcAdaptiveCompo);
+
+} // namespace ibex
+
+#endif // __TEST_CTC_ADAPTIVE_COMPO_H__
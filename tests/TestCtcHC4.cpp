@@ -12,10 +12,37 @@
 #include "Ponts30.h"
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_CtcHC4.h"
+#include "ibex_CtcPropag.h"
 #include "ibex_Array.h"
 
 namespace ibex {
 
+namespace {
+
+// counts the calls to a contractor
+class CtcCount : public Ctc {
+public:
+	CtcCount(Ctc& c, int& nb_calls) : Ctc(c.nb_var), c(c), nb_calls(nb_calls) {
+		input=c.input;   // not owned
+		output=c.output;
+	}
+
+	void contract(IntervalVector& box) {
+		ContractContext context(box);
+		contract(box,context);
+	}
+
+	void contract(IntervalVector& box, ContractContext& context) {
+		nb_calls++;
+		c.contract(box,context);
+	}
+
+	Ctc& c;
+	int& nb_calls;
+};
+
+}
+
 void TestCtcHC4::ponts30() {
 	Ponts30 p30;
 	IntervalVector box = p30.init_box;
@@ -54,5 +81,102 @@ void TestCtcHC4::ponts30() {
 		delete ctr[i];
 	}
 }
+void TestCtcHC4::ponts30_prioritized() {
+	Ponts30 p30;
+
+	NumConstraint* ctr[30];
+	for (int i=0; i<30; i++) {
+		Function* fi=dynamic_cast<Function*>(&((*p30.f)[i]));
+		ctr[i]=new NumConstraint(*fi,EQ);
+	}
+
+	Array<NumConstraint> a(ctr,30);
+	CtcHC4 hc4(a,0.1);
+	hc4.accumulate=true;
+	hc4.prioritized=true;
+	IntervalVector box=p30.init_box;
+	hc4.contract(box);
+
+	CPPUNIT_ASSERT(box.is_subset(p30.init_box));
+	CPPUNIT_ASSERT(almost_eq(box, p30.hc4_box,1e-04));
+
+	for (int i=0; i<30; i++) {
+		delete ctr[i];
+	}
+}
+
+void TestCtcHC4::ponts30_prioritized_nb_calls() {
+	Ponts30 p30;
+
+	NumConstraint* ctr[30];
+	CtcFwdBwd* c[30];
+	for (int i=0; i<30; i++) {
+		Function* fi=dynamic_cast<Function*>(&((*p30.f)[i]));
+		ctr[i]=new NumConstraint(*fi,EQ);
+		c[i]=new CtcFwdBwd(*ctr[i]);
+	}
+
+	int nb_calls[2]={ 0, 0 };
+	IntervalVector box[2]={ p30.init_box, p30.init_box };
+
+	for (int k=0; k<2; k++) {
+		Array<Ctc> list(30);
+		for (int i=0; i<30; i++)
+			list.set_ref(i,*new CtcCount(*c[i],nb_calls[k]));
+
+		CtcPropag propag(list,0.1);
+		propag.accumulate=true;
+		propag.prioritized=(k==1);
+		propag.contract(box[k]);
+
+		for (int i=0; i<30; i++)
+			delete &list[i];
+	}
+
+	// same fixpoint with less calls to HC4Revise
+	CPPUNIT_ASSERT(almost_eq(box[0], p30.hc4_box,1e-04));
+	CPPUNIT_ASSERT(almost_eq(box[1], p30.hc4_box,1e-04));
+	CPPUNIT_ASSERT(nb_calls[1]<=nb_calls[0]);
+
+	for (int i=0; i<30; i++) {
+		delete c[i];
+		delete ctr[i];
+	}
+}
+
+void TestCtcHC4::ponts30_sparse() {
+	Ponts30 p30;
+	IntervalVector box = p30.init_box;
+
+	NumConstraint* ctr[30];
+	CtcFwdBwd* c[30];
+
+	for (int i=0; i<30; i++) {
+		Function* fi=dynamic_cast<Function*>(&((*p30.f)[i]));
+		ctr[i]=new NumConstraint(*fi,EQ);
+		ctr[i]->set_sparse();
+		CPPUNIT_ASSERT(ctr[i]->local!=NULL);
+		CPPUNIT_ASSERT(ctr[i]->local->f.nb_var()==(int) fi->used_vars.size());
+		c[i]=new CtcFwdBwd(*ctr[i]);
+	}
+
+	for (int i=0; i<30; i++) {
+		c[i]->contract(box);
+		CPPUNIT_ASSERT(almost_eq(box, p30.hc4r_box[i],1e-02));
+	}
+
+	Array<NumConstraint> a(ctr,30);
+	CtcHC4 hc4(a,0.1);
+	hc4.accumulate=true;
+	box=p30.init_box;
+	hc4.contract(box);
+
+	CPPUNIT_ASSERT(almost_eq(box, p30.hc4_box,1e-04));
+
+	for (int i=0; i<30; i++) {
+		delete c[i];
+		delete ctr[i];
+	}
+}
 
 } // end namespace ibex
@@ -23,9 +23,15 @@ public:
 	CPPUNIT_TEST_SUITE(TestCtcHC4);
 	
 		CPPUNIT_TEST(ponts30);
+		CPPUNIT_TEST(ponts30_prioritized);
+		CPPUNIT_TEST(ponts30_prioritized_nb_calls);
+		CPPUNIT_TEST(ponts30_sparse);
 	CPPUNIT_TEST_SUITE_END();
 
 	void ponts30();
+	void ponts30_prioritized();
+	void ponts30_prioritized_nb_calls();
+	void ponts30_sparse();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcHC4);
@@ -246,4 +246,139 @@ void TestDoubleHeap::test05() {
 }
 
 
+void TestDoubleHeap::test06() {
+
+    int nb= 100;
+    TestCostFunc2 costf2;
+    TestCostFunc3 costf3;
+
+    DoubleHeap<Interval> h(costf2,false,costf3,true,50);
+
+    for (int i=1; i<=nb ;i++) {
+            h.push(new Interval(i,i+1+(i*7)%13));
+    }
+    // so that the next contraction is lazy
+    h.prune();
+
+    costf3.set_loup(100);
+    h.contract(60.5);
+    CPPUNIT_ASSERT(h.minimum1()==1);
+    CPPUNIT_ASSERT(h.size()==(unsigned int) nb); // not removed yet
+
+    // the data pushed after the contraction is kept
+    h.push(new Interval(70,71));
+
+    double last=NEG_INFINITY;
+    int count=0;
+    while (!h.empty()) {
+            Interval* x=h.pop2();
+            CPPUNIT_ASSERT(x->lb()<=60.5 || *x==Interval(70,71));
+            // the costs are recalculated with the new loup
+            CPPUNIT_ASSERT(x->ub()*100>=last);
+            last=x->ub()*100;
+            delete x;
+            count++;
+    }
+    CPPUNIT_ASSERT(count==61);
+}
+
+void TestDoubleHeap::test07() {
+
+    int nb= 100;
+    TestCostFunc2 costf2;
+    TestCostFunc3 costf3;
+
+    DoubleHeap<Interval> h(costf2,false,costf3,true,50);
+
+    for (int i=1; i<=nb ;i++) {
+            h.push(new Interval(i,2*i));
+    }
+    h.prune();
+
+    h.contract(50.5);
+    h.contract(20.5);
+    // a greater bound does not restore the data
+    h.contract(30.5);
+    h.prune();
+    CPPUNIT_ASSERT(h.size()==20);
+    CPPUNIT_ASSERT(h.minimum1()==1);
+    CPPUNIT_ASSERT(h.minimum2()==20);
+
+    h.flush();
+    CPPUNIT_ASSERT(h.size()==0);
+}
+
+void TestDoubleHeap::test08() {
+
+    int nb= 100;
+    TestCostFunc2 costf2;
+    TestCostFunc3 costf3;
+
+    DoubleHeap<Interval> h(costf2,false,costf3,true,50);
+
+    for (int i=1; i<=nb ;i++) {
+            h.push(new Interval(i,2*i));
+    }
+
+    // the discarded data are not returned
+    h.contract(80.5);
+
+    vector<Interval*> removed;
+    h.shrink(30,removed);
+    CPPUNIT_ASSERT(h.size()==30);
+    CPPUNIT_ASSERT(removed.size()==50);
+    for (vector<Interval*>::iterator it=removed.begin(); it!=removed.end(); it++) {
+            CPPUNIT_ASSERT((*it)->lb()>30 && (*it)->lb()<=80);
+            delete *it;
+    }
+
+    CPPUNIT_ASSERT(h.minimum1()==1);
+    CPPUNIT_ASSERT(h.minimum2()==20);
+
+    removed.clear();
+    h.shrink(50,removed);
+    CPPUNIT_ASSERT(removed.empty());
+
+    int count=0;
+    while (!h.empty()) {
+            Interval* x=h.pop();
+            CPPUNIT_ASSERT(x->lb()<=30);
+            delete x;
+            count++;
+    }
+    CPPUNIT_ASSERT(count==30);
+}
+
+void TestDoubleHeap::test09() {
+
+    TestCostFunc2 costf2;
+    TestCostFunc3 costf3;
+
+    DoubleHeap<Interval> h(costf2,false,costf3,true,50);
+    // the costs of the second heap decrease when the loup changes sign
+    h.lazy_cost2=false;
+
+    for (int i=-50; i<50 ;i++) {
+            h.push(new Interval(i,i+1));
+    }
+    h.prune();
+
+    costf3.set_loup(-10);
+    h.contract(30.5);
+    CPPUNIT_ASSERT(h.size()==81);
+    CPPUNIT_ASSERT(h.minimum1()==-50);
+    CPPUNIT_ASSERT(h.minimum2()==-310);
+
+    double last=NEG_INFINITY;
+    int count=0;
+    while (!h.empty()) {
+            Interval* x=h.pop2();
+            CPPUNIT_ASSERT(x->ub()*(-10)>=last);
+            last=x->ub()*(-10);
+            delete x;
+            count++;
+    }
+    CPPUNIT_ASSERT(count==81);
+}
+
 } // end namespace
@@ -30,6 +30,10 @@ public:
 	CPPUNIT_TEST(test03);
 	CPPUNIT_TEST(test04);
 	CPPUNIT_TEST(test05);
+	CPPUNIT_TEST(test06);
+	CPPUNIT_TEST(test07);
+	CPPUNIT_TEST(test08);
+	CPPUNIT_TEST(test09);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
@@ -37,6 +41,10 @@ public:
 	void test03();
 	void test04();
 	void test05();
+	void test06();
+	void test07();
+	void test08();
+	void test09();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestDoubleHeap);
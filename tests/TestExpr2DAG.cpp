@@ -48,4 +48,31 @@ void TestExpr2DAG::test02() {
 
 }
 
+void TestExpr2DAG::index01() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(2));
+
+	Array<const ExprSymbol> old_x(x);
+	Array<const ExprSymbol> new_x(1);
+	varcopy(old_x,new_x);
+
+	const ExprNode& e1=x[0]*x[1]+x[0]*x[1];
+	const ExprNode& e2 = Expr2DAG().transform(old_x,(Array<const ExprNode> const&) new_x,e1);
+
+	CPPUNIT_ASSERT(e1.size==8 && e2.size==5);
+	CPPUNIT_ASSERT(sameExpr(e2,"((x(1)*x(2))+(x(1)*x(2)))"));
+}
+
+void TestExpr2DAG::share01() {
+	const ExprSymbol& x1=ExprSymbol::new_(Dim::scalar());
+	const ExprSymbol& x2=ExprSymbol::new_(Dim::scalar());
+
+	const ExprNode& e1=(x1+x2)*(x1+x2);
+	const ExprMul& e2=(const ExprMul&) Expr2DAG().share(e1);
+
+	CPPUNIT_ASSERT(&e2!=&e1);
+	CPPUNIT_ASSERT(&e2.left==&((const ExprMul&) e1).left);
+	CPPUNIT_ASSERT(&e2.left==&e2.right);
+	CPPUNIT_ASSERT(e2.size==4);
+}
+
 } // end namespace
@@ -26,10 +26,14 @@ public:
 	
 		CPPUNIT_TEST(test01);
 		CPPUNIT_TEST(test02);
+		CPPUNIT_TEST(index01);
+		CPPUNIT_TEST(share01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
 	void test02();
+	void index01();
+	void share01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestExpr2DAG);
@@ -0,0 +1,223 @@
+/* ============================================================================
+ * I B E X - ExprBuilder Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestExprBuilder.h"
+#include "ibex_System.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Compare two systems on a box.
+ */
+bool same_eval(const System& sys1, const System& sys2, const IntervalVector& box) {
+	if (sys1.nb_var!=sys2.nb_var || sys1.nb_ctr!=sys2.nb_ctr) return false;
+
+	for (int i=0; i<sys1.nb_ctr; i++) {
+		if (sys1.ops[i]!=sys2.ops[i]) return false;
+		if (!almost_eq(sys1.ctrs[i].f.eval(box), sys2.ctrs[i].f.eval(box))) return false;
+	}
+
+	if (!almost_eq(sys1.f_ctrs.eval_vector(box), sys2.f_ctrs.eval_vector(box))) return false;
+
+	if ((sys1.goal==NULL) != (sys2.goal==NULL)) return false;
+
+	return sys1.goal==NULL || almost_eq(sys1.goal->eval(box), sys2.goal->eval(box));
+}
+
+}
+
+void TestExprBuilder::hash_cons() {
+	Variable x(2,"x");
+	SystemFactory fac;
+	fac.add_var(x);
+	ExprBuilder b(fac);
+
+	ExprBuilder::Node x0=b.var(x,0);
+	ExprBuilder::Node x1=b.var(x,1);
+	CPPUNIT_ASSERT(b.size()==2);
+
+	b.var(x,0);
+	CPPUNIT_ASSERT(b.size()==2);
+
+	ExprBuilder::Node e=b.mul(x0,b.sin(x1));
+	CPPUNIT_ASSERT(b.size()==4);
+
+	b.mul(b.var(x,0),b.sin(b.var(x,1)));
+	CPPUNIT_ASSERT(b.size()==4);
+
+	// not commutative
+	b.mul(b.sin(x1),x0);
+	CPPUNIT_ASSERT(b.size()==5);
+
+	b.add_ctr(e,EQ);
+	System sys(fac);
+	CPPUNIT_ASSERT(sys.nb_ctr==1);
+	// x, x[0], x[1], sin and *
+	CPPUNIT_ASSERT(sys.ctrs[0].f.nodes.size()==5);
+}
+
+void TestExprBuilder::fold() {
+	Variable x("x");
+	SystemFactory fac;
+	fac.add_var(x);
+	ExprBuilder b(fac);
+
+	ExprBuilder::Node vx=b.var(x);
+	ExprBuilder::Node c=b.add(b.cst(1),b.sqr(b.cst(2)));
+	// x, 1, 2, 4 and 5
+	CPPUNIT_ASSERT(b.size()==5);
+
+	b.add(vx,b.cst(0));
+	b.mul(b.cst(1),vx);
+	b.pow(vx,1);
+	// only the constant 0 is new
+	CPPUNIT_ASSERT(b.size()==6);
+
+	// x^2 is the same node as sqr(x)
+	b.sqr(vx);
+	CPPUNIT_ASSERT(b.size()==7);
+	b.pow(vx,2);
+	CPPUNIT_ASSERT(b.size()==7);
+
+	b.add_ctr(b.sub(vx,c),LEQ);
+	b.add_ctr(b.pow(vx,2),LEQ);
+	System sys(fac);
+
+	const ExprSub* sub=dynamic_cast<const ExprSub*>(&sys.ctrs[0].f.expr());
+	CPPUNIT_ASSERT(sub);
+	const ExprConstant* cst=dynamic_cast<const ExprConstant*>(&sub->right);
+	CPPUNIT_ASSERT(cst);
+	CPPUNIT_ASSERT(cst->get_value()==Interval(5));
+
+	CPPUNIT_ASSERT(dynamic_cast<const ExprSqr*>(&sys.ctrs[1].f.expr()));
+}
+
+void TestExprBuilder::system01() {
+	Variable x1(3,"x");
+	Variable A1(2,2,"A");
+	Variable y1("y");
+	SystemFactory fac1;
+	fac1.add_var(x1);
+	fac1.add_var(A1);
+	fac1.add_var(y1);
+	fac1.add_goal(y1-cos(x1[1]));
+	fac1.add_ctr(sqr(x1[0])+A1[1][0]*y1-1=0);
+	fac1.add_ctr(exp(x1[2])-sin(y1)*A1[0][1]<=0);
+	fac1.add_ctr(pow(x1[1],3)/(1+abs(x1[0]))>=y1);
+	System sys1(fac1);
+
+	Variable x2(3,"x");
+	Variable A2(2,2,"A");
+	Variable y2("y");
+	SystemFactory fac2;
+	fac2.add_var(x2);
+	fac2.add_var(A2);
+	fac2.add_var(y2);
+	ExprBuilder b(fac2);
+	b.add_goal(b.sub(b.var(y2),b.cos(b.var(x2,1))));
+	b.add_ctr(b.sub(b.add(b.sqr(b.var(x2,0)),b.mul(b.var(A2,1,0),b.var(y2))),b.cst(1)),EQ);
+	b.add_ctr(b.sub(b.exp(b.var(x2,2)),b.mul(b.sin(b.var(y2)),b.var(A2,0,1))),LEQ);
+	b.add_ctr(b.sub(b.div(b.pow(b.var(x2,1),3),b.add(b.cst(1),b.abs(b.var(x2,0)))),b.var(y2)),GEQ);
+	System sys2(fac2);
+
+	CPPUNIT_ASSERT(sys2.nb_var==8);
+	CPPUNIT_ASSERT(sys2.args.size()==3);
+
+	double _box[8][2]={{-1,1},{0,2},{0.5,1},{1,1},{-2,3},{1,2},{0,0},{-1,0.5}};
+	CPPUNIT_ASSERT(same_eval(sys1, sys2, IntervalVector(8,_box)));
+	CPPUNIT_ASSERT(same_eval(sys1, sys2, IntervalVector(8,Interval(0.5))));
+}
+
+void TestExprBuilder::system02() {
+	const int n=50;
+
+	Variable x(n,"x");
+	SystemFactory fac;
+	fac.add_var(x);
+	ExprBuilder b(fac);
+
+	vector<ExprBuilder::Node> t;
+	for (int i=0; i<n; i++)
+		t.push_back(b.exp(b.sqr(b.var(x,i))));
+
+	for (int i=0; i<n-1; i++)
+		b.add_ctr(b.sub(t[i],t[i+1]),EQ);
+
+	System sys(fac);
+	CPPUNIT_ASSERT(sys.nb_ctr==n-1);
+
+	// x, 3n nodes for exp(x[i]^2), n-1 subtractions
+	// and the vector of the constraints.
+	CPPUNIT_ASSERT(sys.f_ctrs.nodes.size()==1+3*n+n-1+1);
+
+	IntervalVector box(n);
+	for (int i=0; i<n; i++)
+		box[i]=Interval(i,i+1)/n;
+	IntervalVector y=sys.f_ctrs.eval_vector(box);
+	for (int i=0; i<n-1; i++)
+		CPPUNIT_ASSERT(almost_eq(y[i],exp(sqr(box[i]))-exp(sqr(box[i+1]))));
+}
+
+void TestExprBuilder::mixed() {
+	Variable x1(2,"x");
+	SystemFactory fac1;
+	fac1.add_var(x1);
+	fac1.add_ctr(x1[0]*x1[1]-1=0);
+	fac1.add_ctr(x1[0]+x1[1]<=2);
+	fac1.add_ctr(sqrt(x1[0])-x1[1]>=0);
+	System sys1(fac1);
+
+	Variable x2(2,"x");
+	SystemFactory fac2;
+	fac2.add_var(x2);
+	ExprBuilder b(fac2);
+	b.add_ctr(b.sub(b.mul(b.var(x2,0),b.var(x2,1)),b.cst(1)),EQ);
+	fac2.add_ctr(x2[0]+x2[1]<=2);
+	b.add_ctr(b.sub(b.sqrt(b.var(x2,0)),b.var(x2,1)),GEQ);
+	System sys2(fac2);
+
+	double _box[2][2]={{0,1},{1,3}};
+	CPPUNIT_ASSERT(same_eval(sys1, sys2, IntervalVector(2,_box)));
+}
+
+void TestExprBuilder::threads() {
+	const int n=20;
+
+	Variable x1(n,"x");
+	SystemFactory fac1;
+	fac1.add_var(x1);
+	for (int i=0; i<n-1; i++)
+		fac1.add_ctr(x1[i]*exp(x1[i+1])-1=0);
+	System sys1(fac1);
+
+	Variable x2(n,"x");
+	SystemFactory fac2;
+	fac2.add_var(x2);
+	fac2.set_nb_threads(4);
+	ExprBuilder b(fac2);
+	for (int i=0; i<n-1; i++) {
+		if (i%2==0)
+			b.add_ctr(b.sub(b.mul(b.var(x2,i),b.exp(b.var(x2,i+1))),b.cst(1)),EQ);
+		else
+			fac2.add_ctr(x2[i]*exp(x2[i+1])-1=0);
+	}
+	System sys2(fac2);
+
+	IntervalVector box(n);
+	for (int i=0; i<n; i++)
+		box[i]=Interval(i,i+1)/n;
+	CPPUNIT_ASSERT(same_eval(sys1, sys2, box));
+}
+
+} // end namespace
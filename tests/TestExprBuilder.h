@@ -0,0 +1,57 @@
+/* ============================================================================
+ * I B E X - ExprBuilder Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_EXPR_BUILDER_H__
+#define __TEST_EXPR_BUILDER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "ibex_ExprBuilder.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestExprBuilder : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestExprBuilder);
+	CPPUNIT_TEST(hash_cons);
+	CPPUNIT_TEST(fold);
+	CPPUNIT_TEST(system01);
+	CPPUNIT_TEST(system02);
+	CPPUNIT_TEST(mixed);
+	CPPUNIT_TEST(threads);
+	CPPUNIT_TEST_SUITE_END();
+
+	// equal operations are recorded once
+	void hash_cons();
+
+	// operations on constants and neutral elements
+	void fold();
+
+	// same system as with operators (vector and matrix variables, goal)
+	void system01();
+
+	// sharing between constraints in the system function
+	void system02();
+
+	// constraints also added by SystemFactory::add_ctr
+	void mixed();
+
+	// constraints built by several threads
+	void threads();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestExprBuilder);
+
+} // end namespace
+
+#endif // __TEST_EXPR_BUILDER_H__
@@ -320,5 +320,43 @@ void TestExprDiff::issue247() {
 	CPPUNIT_ASSERT(g==Vector::ones(2));
 }
 
-} // end namespace
+void TestExprDiff::vecimg03() {
+	Variable x(3,"x");
+	Function f(x,Return(exp(x[0])*x[1], x[1]+x[2], tanh(x[0])*x[0]));
+	Function df(f,Function::DIFF);
+
+	IntervalVector box(3);
+	box[0]=Interval(0.5); box[1]=Interval(2); box[2]=Interval(-1);
+	IntervalMatrix J=df.eval_matrix(box);
+
+	double e=::exp(0.5), t=::tanh(0.5);
+	CPPUNIT_ASSERT(almost_eq(J[0][0],Interval(2*e),1e-12));
+	CPPUNIT_ASSERT(almost_eq(J[0][1],Interval(e),1e-12));
+	CPPUNIT_ASSERT(J[0][2]==Interval::zero());
+	CPPUNIT_ASSERT(J[1][0]==Interval::zero() && J[1][1]==Interval::one() && J[1][2]==Interval::one());
+	CPPUNIT_ASSERT(almost_eq(J[2][0],Interval((1-t*t)*0.5+t),1e-12));
+	CPPUNIT_ASSERT(J[2][1]==Interval::zero() && J[2][2]==Interval::zero());
+}
+
+void TestExprDiff::linear_size() {
+	int n=50;
+	Variable x(n,"x");
+	Array<const ExprNode> comp(n);
+	for (int i=0; i<n; i++) {
+		const ExprNode* e=&(0.01*exp(x[i]) - 2*x[i]);
+		if (i>0) e=&(*e + x[i-1]);
+		if (i<n-1) e=&(*e + x[i+1]);
+		comp.set_ref(i,*e);
+	}
+	Function f(x,ExprVector::new_col(comp));
+	Function df(f,Function::DIFF);
+
+	CPPUNIT_ASSERT(df.nodes.size() <= f.nodes.size());
 
+	IntervalMatrix J=df.eval_matrix(IntervalVector(n,Interval::zero()));
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			CPPUNIT_ASSERT(almost_eq(J[i][j],Interval(i==j? -1.99 : (i-j==1 || j-i==1)? 1 : 0),1e-12));
+}
+
+} // end namespace
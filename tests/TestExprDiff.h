@@ -45,6 +45,8 @@ public:
 	CPPUNIT_TEST(mul04);
 	CPPUNIT_TEST(apply_mul01);
 	CPPUNIT_TEST(issue247);
+	CPPUNIT_TEST(vecimg03);
+	CPPUNIT_TEST(linear_size);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -79,6 +81,12 @@ public:
 	// function with constant gradient
 	void cst_grad();
 
+	// x (vec) -> (exp(x[0])*x[1] ; x[1]+x[2] ; tanh(x[0])*x[0])
+	void vecimg03();
+
+	// the size of the differential is linear in the size of the function
+	void linear_size();
+
 	// x -> (x,x,x)
 	void vecimg01();
 
@@ -11,6 +11,7 @@
 
 #include "TestExprSimplify.h"
 #include "ibex_Expr.h"
+#include "ibex_ExprSimplify.h"
 #include <sstream>
 
 using namespace std;
@@ -99,4 +100,16 @@ void TestExprSimplify::issue366() {
 	CPPUNIT_ASSERT(e.right.fathers.size()==1);
 }
 
+void TestExprSimplify::hash_cons() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	const ExprNode& e0=exp(x)*y-(1*exp(x))*y;
+	const ExprBinaryOp& e=(const ExprBinaryOp&) ExprSimplify(true).simplify(e0);
+
+	CPPUNIT_ASSERT(sameExpr(e,"((exp(x)*y)-(exp(x)*y))"));
+	CPPUNIT_ASSERT(&e.left==&e.right);
+	CPPUNIT_ASSERT(e.size==5);
+	CPPUNIT_ASSERT(e.left.fathers.size()==2);
+}
+
 } // end namespace
@@ -36,6 +36,7 @@ public:
 	CPPUNIT_TEST(index_add);
 	CPPUNIT_TEST(index_transpose);
 	CPPUNIT_TEST(issue366);
+	CPPUNIT_TEST(hash_cons);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -51,6 +52,7 @@ public:
 	void index_add();
 	void index_transpose();
 	void issue366();
+	void hash_cons();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestExprSimplify);
@@ -157,4 +157,33 @@ void TestNewton::ctc_parameter01() {
 	CPPUNIT_ASSERT(box[0].diam()<=0.1);
 	CPPUNIT_ASSERT(box[1].diam()<=0.1);
 }
+
+void TestNewton::newton_cache01() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+	BxpNewtonCache cache(0,30,0,1.0);
+
+	newton(*p30.f,box,cache);
+
+	CPPUNIT_ASSERT(cache.nb_reuse>0);
+	IntervalVector expected(30,BOX2);
+	CPPUNIT_ASSERT(almost_eq(box,expected,1e-10));
+
+	// the cache is not valid for a box which is not a subset
+	CPPUNIT_ASSERT(cache.is_valid(box));
+	CPPUNIT_ASSERT(!cache.is_valid(IntervalVector(30,BOX1).inflate(0.1)));
+}
+
+void TestNewton::newton_cache02() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+	BxpNewtonCache cache(0,30,0,1.0,true);
+
+	newton(*p30.f,box,cache);
+
+	CPPUNIT_ASSERT(cache.nb_reuse>0);
+	IntervalVector expected(30,BOX2);
+	CPPUNIT_ASSERT(almost_eq(box,expected,1e-10));
+}
+
 } // end namespace ibex
@@ -114,4 +114,34 @@ void TestNumConstraint::build_from_file02() {
 //}
 
 
+void TestNumConstraint::sparse01() {
+	NumConstraint c("x[5]","y[2][2]","x(2)*y(2,1)+x(4)*(y(1)*x(1:2))=0");
+	c.set_sparse();
+
+	CPPUNIT_ASSERT(c.local!=NULL);
+	CPPUNIT_ASSERT(c.local->op==EQ);
+	CPPUNIT_ASSERT(c.local->f.nb_var()==6);
+	CPPUNIT_ASSERT(c.local->f.expr().dim.is_scalar());
+
+	// used components: x[0],x[1],x[3],y[0][0],y[0][1],y[1][0]
+	int vars[6] = { 0, 1, 3, 5, 6, 7 };
+	CPPUNIT_ASSERT(c.f.used_vars==vector<int>(vars,vars+6));
+
+	double _box[][2] = {{1,2},{-1,3},{0,0},{2,4},{-2,-1},{0,1},{1,1},{-1,2},{5,6}};
+	IntervalVector box(9,_box);
+	IntervalVector x(6);
+	for (int i=0; i<6; i++) x[i]=box[vars[i]];
+
+	CPPUNIT_ASSERT(c.local->f.eval(x)==c.f.eval(box));
+
+	c.set_sparse(); // does nothing
+	CPPUNIT_ASSERT(c.local->f.nb_var()==6);
+}
+
+void TestNumConstraint::sparse02() {
+	NumConstraint c("x","1<=2");
+	c.set_sparse();
+	CPPUNIT_ASSERT(c.local==NULL);
+}
+
 } // end namespace
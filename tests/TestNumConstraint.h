@@ -29,6 +29,8 @@ public:
 
 	CPPUNIT_TEST(build_from_file01);
 	CPPUNIT_TEST(build_from_file02);
+	CPPUNIT_TEST(sparse01);
+	CPPUNIT_TEST(sparse02);
 //	CPPUNIT_TEST(is_thick_eq01);
 //	CPPUNIT_TEST(is_thick_eq02);
 	
@@ -41,6 +43,12 @@ public:
 	// check that only the first constraint in the file
 	// is loaded
 	void build_from_file02();
+
+	// local form of a constraint on vector and matrix variables
+	void sparse01();
+
+	// constraint with no variable
+	void sparse02();
 //	void is_thick_eq01();
 //	void is_thick_eq02();
 
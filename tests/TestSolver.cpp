@@ -15,6 +15,9 @@
 #include "ibex_RoundRobin.h"
 #include "ibex_CellStack.h"
 #include "ibex_CtcHC4.h"
+#include "ibex_CtcFixPoint.h"
+
+#include <thread>
 
 using namespace std;
 
@@ -195,5 +198,295 @@ void TestSolver::circle4() {
 	CPPUNIT_ASSERT(!res);
 }
 
+void TestSolver::profile01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(sqr(x-1)+sqr(y)=1);
+
+	System sys(f);
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(sys);
+	CtcFixPoint fp(hc4);
+	Vector prec(2,1e-3);
+
+	Solver solver(sys,fp,rr,stack,prec,prec);
+
+	CtcProfile::enabled=true;
+	solver.solve(IntervalVector(2,Interval(-10,10)));
+	CtcProfile::enabled=false;
+
+	CPPUNIT_ASSERT(fp.profile!=NULL);
+	CPPUNIT_ASSERT(hc4.profile!=NULL);
+	CPPUNIT_ASSERT(fp.profile->name=="CtcFixPoint");
+	CPPUNIT_ASSERT(fp.profile->nb_calls==solver.get_nb_cells());
+	CPPUNIT_ASSERT(hc4.profile->nb_calls>=fp.profile->nb_calls);
+	CPPUNIT_ASSERT(fp.profile->nb_empty==hc4.profile->nb_empty);
+	CPPUNIT_ASSERT(fp.profile->nb_empty>0);
+	CPPUNIT_ASSERT(fp.profile->avg_log_reduction()>0);
+	CPPUNIT_ASSERT(fp.profile->max_time<=fp.profile->total_time);
+
+	// not recorded anymore
+	unsigned long nb_calls=hc4.profile->nb_calls;
+	solver.solve(IntervalVector(2,Interval(-10,10)));
+	CPPUNIT_ASSERT(hc4.profile->nb_calls==nb_calls);
+
+	CtcProfile::clear();
+	CPPUNIT_ASSERT(hc4.profile->nb_calls==0);
+}
+
+namespace {
+
+const int nb_profile_threads=4;
+const int nb_profile_calls=1000;
+
+// contractors of different threads are profiled simultaneously
+void profile_thread(const System* sys, CtcProfile* shared, CtcProfile** own) {
+	System copy(*sys, System::COPY); // evaluators are not thread-safe
+	CtcHC4 hc4(copy);
+	for (int i=0; i<nb_profile_calls; i++) {
+		IntervalVector box(2,Interval(-10,10));
+		ContractContext context(box);
+		hc4.profiled_contract(box,context);
+		shared->add_call(1, i%2==0, 1);
+	}
+	*own=hc4.profile;
+}
+
+}
+
+void TestSolver::profile02() {
+	System sys(2,"{0}^2+{1}^2=1;({0}-1)^2+{1}^2=1");
+
+	CtcProfile* shared=CtcProfile::create(typeid(CtcHC4));
+	size_t nb_profiles=CtcProfile::profiles().size();
+
+	CtcProfile* own[nb_profile_threads];
+	vector<thread> threads;
+
+	CtcProfile::enabled=true;
+	for (int i=0; i<nb_profile_threads; i++)
+		threads.push_back(thread(profile_thread, &sys, shared, &own[i]));
+	for (int i=0; i<nb_profile_threads; i++)
+		threads[i].join();
+	CtcProfile::enabled=false;
+
+	CPPUNIT_ASSERT(CtcProfile::profiles().size()==nb_profiles+nb_profile_threads);
+	for (int i=0; i<nb_profile_threads; i++) {
+		CPPUNIT_ASSERT(own[i]!=NULL);
+		CPPUNIT_ASSERT(own[i]->nb_calls==(unsigned long) nb_profile_calls);
+		for (int j=0; j<i; j++)
+			CPPUNIT_ASSERT(own[i]->id!=own[j]->id);
+	}
+
+	CPPUNIT_ASSERT(shared->nb_calls==(unsigned long) nb_profile_threads*nb_profile_calls);
+	CPPUNIT_ASSERT(shared->nb_empty==(unsigned long) nb_profile_threads*nb_profile_calls/2);
+	CPPUNIT_ASSERT(shared->total_time==nb_profile_threads*nb_profile_calls);
+	CPPUNIT_ASSERT(shared->sum_log_reduction==nb_profile_threads*nb_profile_calls/2);
+}
+
+namespace {
+
+class StopListener : public SolverListener {
+public:
+	StopListener() : SolverListener(4), nb_boxes(0), nb_cells(0) { }
+
+	void box_found(Solver& solver, const IntervalVector& box, CovSolverData::BoxStatus status) {
+		CPPUNIT_ASSERT(status==CovSolverData::SOLUTION);
+		CPPUNIT_ASSERT(&box==&solver.get_data()[solver.get_data().size()-1]);
+		nb_boxes++;
+		solver.interrupt();
+	}
+
+	void cells_handled(Solver&) { nb_cells++; }
+
+	int nb_boxes;
+	int nb_cells;
+};
+
+}
+
+void TestSolver::listener() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(sqr(x-1)+sqr(y)=1);
+
+	System sys(f);
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(sys);
+	Vector prec(2,1e-3);
+
+	Solver solver(sys,hc4,rr,stack,prec,prec);
+	StopListener stop;
+	solver.listener=&stop;
+
+	CPPUNIT_ASSERT(solver.solve(IntervalVector(2,Interval(-10,10)))==Solver::INTERRUPTED);
+	CPPUNIT_ASSERT(stop.nb_boxes==1);
+	CPPUNIT_ASSERT(stop.nb_cells==(int) (solver.get_current_nb_cells()/4));
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==1);
+	CPPUNIT_ASSERT(solver.get_data().nb_pending()>0);
+
+	// continue from the intermediate result
+	CovSolverData data(solver.get_data(), true);
+	solver.listener=NULL;
+	CPPUNIT_ASSERT(solver.solve(data)==Solver::SUCCESS);
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==2);
+}
+
+void TestSolver::cancellation() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(sqr(x-1)+sqr(y)=1);
+
+	System sys(f);
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(sys);
+	CtcFixPoint fp(hc4);
+	Vector prec(2,1e-3);
+	IntervalVector box(2,Interval(-10,10));
+
+	Cancellation token;
+
+	// a cancelled contractor leaves the box unchanged
+	ContractContext context(box);
+	context.cancellation=&token;
+	token.cancel();
+	IntervalVector box2(box);
+	fp.contract(box2,context);
+	CPPUNIT_ASSERT(box2==box);
+
+	Solver solver(sys,fp,rr,stack,prec,prec);
+	solver.cancellation=&token;
+	CPPUNIT_ASSERT(solver.solve(box)==Solver::INTERRUPTED);
+	CPPUNIT_ASSERT(solver.get_data().nb_pending()==1);
+
+	token.reset();
+	token.set_deadline(1e-9);
+	CPPUNIT_ASSERT(solver.solve(box)==Solver::TIME_OUT);
+	CPPUNIT_ASSERT(token.expired());
+
+	token.reset();
+	CPPUNIT_ASSERT(solver.solve(box)==Solver::SUCCESS);
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==2);
+}
+
+void TestSolver::time_limit() {
+	System sys(2,"{0}^2+{1}^2=1");
+	RoundRobin rr(1e-9);
+	CellStack stack;
+	CtcHC4 hc4(sys);
+	Vector prec(2,1e-9);
+	IntervalVector box(2,Interval(-10,10));
+
+	Solver solver(sys,hc4,rr,stack,prec,prec);
+	// the time is not checked at each cell
+	solver.time_limit=0.05;
+	CPPUNIT_ASSERT(solver.solve(box)==Solver::TIME_OUT);
+	CPPUNIT_ASSERT(solver.get_time()>=0.05);
+	CPPUNIT_ASSERT(solver.get_time()<1);
+	CPPUNIT_ASSERT(solver.get_data().nb_pending()>0);
+}
+
+namespace {
+
+// true if the boxes of "data" with status "status" are the same as in "ref" (in any order)
+bool same_boxes(const CovSolverData& data, const CovSolverData& ref, CovSolverData::BoxStatus status) {
+	for (size_t i=0; i<data.size(); i++) {
+		if (data.status(i)!=status) continue;
+		bool found=false;
+		for (size_t j=0; !found && j<ref.size(); j++)
+			found = ref.status(j)==status && ref[j]==data[i];
+		if (!found) return false;
+	}
+	return true;
+}
+
+}
+
+void TestSolver::parallel_certification() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(x+y>=0);
+
+	System sys(f);
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(sys);
+	Vector eps_min(2,1e-3);
+	Vector eps_max(2,1e-1);
+	IntervalVector box(2,Interval(-10,10));
+
+	Solver solver(sys,hc4,rr,stack,eps_min,eps_max);
+	Solver::Status status=solver.solve(box);
+	CovSolverData ref(solver.get_data(), true);
+	CPPUNIT_ASSERT(ref.nb_solution()>0);
+	CPPUNIT_ASSERT(ref.nb_boundary()>0);
+
+	for (int nb_threads=1; nb_threads<=3; nb_threads++) {
+		solver.set_parallel_certification(nb_threads, 8);
+		CPPUNIT_ASSERT(solver.solve(box)==status);
+
+		const CovSolverData& data=solver.get_data();
+		CPPUNIT_ASSERT(data.nb_solution()==ref.nb_solution());
+		CPPUNIT_ASSERT(data.nb_boundary()==ref.nb_boundary());
+		CPPUNIT_ASSERT(data.nb_unknown()==ref.nb_unknown());
+		CPPUNIT_ASSERT(solver.get_nb_cells()==ref.nb_cells());
+		CPPUNIT_ASSERT(same_boxes(data, ref, CovSolverData::SOLUTION));
+		CPPUNIT_ASSERT(same_boxes(data, ref, CovSolverData::BOUNDARY));
+		CPPUNIT_ASSERT(same_boxes(data, ref, CovSolverData::UNKNOWN));
+	}
+
+	// back to the sequential mode
+	solver.set_parallel_certification(0);
+	solver.solve(box);
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==ref.nb_solution());
+}
+
+void TestSolver::parallel_certification_cell_limit() {
+	System sys(2,"{0}^2+{1}^2=1;{0}+{1}>=0");
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(sys);
+	Vector eps_min(2,1e-3);
+	// large boxes are submitted to certification and
+	// bisected after (in record_cert)
+	Vector eps_max(2,1);
+	IntervalVector box(2,Interval(-10,10));
+
+	Solver solver(sys,hc4,rr,stack,eps_min,eps_max);
+	solver.solve(box);
+	int nb_cells=solver.get_nb_cells();
+
+	solver.set_parallel_certification(2, 8);
+
+	for (int limit=2; limit<nb_cells-2; limit++) {
+		solver.cell_limit=limit;
+		CPPUNIT_ASSERT(solver.solve(box)==Solver::CELL_OVERFLOW);
+		CPPUNIT_ASSERT(solver.get_nb_cells()<=limit+2);
+		CPPUNIT_ASSERT(solver.get_data().nb_pending()>0);
+	}
+}
 
 } // end namespace
@@ -28,12 +28,26 @@ public:
 	CPPUNIT_TEST(circle2);
 	CPPUNIT_TEST(circle3);
 	CPPUNIT_TEST(circle4);
+	CPPUNIT_TEST(profile01);
+	CPPUNIT_TEST(profile02);
+	CPPUNIT_TEST(listener);
+	CPPUNIT_TEST(cancellation);
+	CPPUNIT_TEST(time_limit);
+	CPPUNIT_TEST(parallel_certification);
+	CPPUNIT_TEST(parallel_certification_cell_limit);
 	CPPUNIT_TEST_SUITE_END();
 
 	void circle1();
 	void circle2();
 	void circle3();
 	void circle4();
+	void profile01();
+	void profile02();
+	void listener();
+	void cancellation();
+	void time_limit();
+	void parallel_certification();
+	void parallel_certification_cell_limit();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestSolver);
@@ -15,8 +15,11 @@
 #include "ibex_SystemFactory.h"
 #include "ibex_SyntaxError.h"
 #include "ibex_NormalizedSystem.h"
+#include "ibex_CtcHC4.h"
 
 #include <sstream>
+#include <cstdio>
+#include <cassert>
 
 using namespace std;
 
@@ -278,6 +281,42 @@ void TestSystem::normalize02() {
 	  CPPUNIT_ASSERT(sameExpr(sys.ctrs[1].f.expr(),"((-((x+y);(x+y)))+(0 ; 1))"));
 }
 
+void TestSystem::normalize03() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x+y<=1);
+	fac.add_ctr(x-y>=0);
+	fac.add_ctr(x*y=1);
+	System sys(fac);
+
+	NormalizedSystem nsys1(sys,0.5);
+	NormalizedSystem nsys2(sys,0.5,false,true);
+
+	CPPUNIT_ASSERT(nsys2.nb_ctr==4);
+	CPPUNIT_ASSERT(&nsys2.ctrs[0].f==&sys.ctrs[0].f); // shared
+	CPPUNIT_ASSERT(&nsys2.ctrs[1].f!=&sys.ctrs[1].f); // reversed
+	CPPUNIT_ASSERT(sameExpr(nsys2.ctrs[1].f.expr(),nsys1.ctrs[1].f.expr()));
+	CPPUNIT_ASSERT(sameExpr(nsys2.ctrs[2].f.expr(),nsys1.ctrs[2].f.expr()));
+	CPPUNIT_ASSERT(sameExpr(nsys2.ctrs[3].f.expr(),nsys1.ctrs[3].f.expr()));
+
+	for (int i=0; i<4; i++) {
+		CPPUNIT_ASSERT(nsys1.ops[i]==LEQ);
+		CPPUNIT_ASSERT(nsys2.ops[i]==LEQ);
+	}
+
+	IntervalVector pt(2);
+	pt[0]=2;
+	pt[1]=3;
+	IntervalVector res=nsys2.f_ctrs.eval_vector(pt);
+	CPPUNIT_ASSERT(res==nsys1.f_ctrs.eval_vector(pt));
+	CPPUNIT_ASSERT(almost_eq(res[2],Interval(4.5),ERROR)); // x*y-1-0.5
+	CPPUNIT_ASSERT(almost_eq(res[3],Interval(-5.5),ERROR)); // -0.5-(x*y-1)
+}
+
 void TestSystem::merge01() {
 	SystemFactory fac1;
 	{
@@ -386,4 +425,140 @@ void TestSystem::merge04() {
 		CPPUNIT_ASSERT(sameExpr(sys3.ctrs[sys1.nb_ctr+i].f.expr(),sys2.ctrs[i].f.expr()));
 }
 
+void TestSystem::save01() {
+	System& _sys(*sysex1());
+	_sys.goal->diff();
+	char *tmpname = (char*) malloc(L_tmpnam);
+	char* ret=tmpnam(tmpname);
+	assert(ret!=NULL);
+	_sys.save(tmpname);
+	delete &_sys;
+
+	System sys(tmpname);
+	remove(tmpname);
+	free(tmpname);
+
+	// all the lines below are copy-pasted from factory01...
+	CPPUNIT_ASSERT(sys.nb_ctr==2);
+	CPPUNIT_ASSERT(sys.nb_var==13);
+	CPPUNIT_ASSERT(sys.args.size()==3);
+	CPPUNIT_ASSERT(strcmp(sys.args[0].name,"x")==0);
+	CPPUNIT_ASSERT(sys.args[0].dim==Dim::col_vec(3));
+	CPPUNIT_ASSERT(sys.args[1].dim==Dim::matrix(3,3));
+	CPPUNIT_ASSERT(sys.args[2].dim==Dim::scalar());
+	CPPUNIT_ASSERT(sameExpr(sys.goal->expr(),"(y-cos(x(2)))"));
+
+	CPPUNIT_ASSERT(sys.box.size()==13);
+
+	CPPUNIT_ASSERT(sys.ctrs.size()==2);
+	CPPUNIT_ASSERT(sys.f_ctrs.nb_arg()==3);
+	CPPUNIT_ASSERT(sys.f_ctrs.nb_var()==13);
+	CPPUNIT_ASSERT(sys.f_ctrs.image_dim()==4);
+	CPPUNIT_ASSERT(sameExpr(sys.ctrs[0].f.expr(),"(A*x)"));
+	CPPUNIT_ASSERT(sys.ctrs[0].op==EQ);
+	CPPUNIT_ASSERT(sameExpr(sys.ctrs[1].f.expr(),"(y-x(1))"));
+	CPPUNIT_ASSERT(sys.ctrs[1].op==GEQ);
+
+	CPPUNIT_ASSERT(sys.ops[0]==EQ);
+	CPPUNIT_ASSERT(sys.ops[1]==EQ);
+	CPPUNIT_ASSERT(sys.ops[2]==EQ);
+	CPPUNIT_ASSERT(sys.ops[3]==GEQ);
+
+	// the differential of the goal has been saved
+	System& sys2(*sysex1());
+	CPPUNIT_ASSERT(sameExpr(sys.goal->diff().expr(),sys2.goal->diff().expr()));
+	delete &sys2;
+}
+
+void TestSystem::save02() {
+	System sys1(SRCDIR_TESTS "/minibex/bearing.bch");
+	char *tmpname = (char*) malloc(L_tmpnam);
+	char* ret=tmpnam(tmpname);
+	assert(ret!=NULL);
+	sys1.save(tmpname);
+
+	System sys2(tmpname);
+	remove(tmpname);
+	free(tmpname);
+
+	// same DAG
+	CPPUNIT_ASSERT(sys1.f_ctrs.nb_nodes()==sys2.f_ctrs.nb_nodes());
+	CPPUNIT_ASSERT(sameExpr(sys1.f_ctrs.expr(),sys2.f_ctrs.expr()));
+	CPPUNIT_ASSERT(sys1.box==sys2.box);
+	for (int i=0; i<sys1.nb_ctr; i++)
+		CPPUNIT_ASSERT(sameExpr(sys2.ctrs[i].f.expr(),sys1.ctrs[i].f.expr()));
+
+	IntervalVector box(sys1.nb_var,Interval(1,2));
+	CPPUNIT_ASSERT(sys1.f_ctrs.eval_vector(box)==sys2.f_ctrs.eval_vector(box));
+}
+
+void TestSystem::sparse01() {
+	System sys1(SRCDIR_TESTS "/minibex/bearing.bch");
+	System sys2(SRCDIR_TESTS "/minibex/bearing.bch");
+	sys2.set_sparse();
+
+	IntervalVector box(sys1.nb_var,Interval(1,2));
+
+	for (int i=0; i<sys2.nb_ctr; i++) {
+		const NumConstraint& c=sys2.ctrs[i];
+		CPPUNIT_ASSERT(c.local!=NULL);
+		IntervalVector x((int) c.f.used_vars.size());
+		for (size_t j=0; j<c.f.used_vars.size(); j++)
+			x[j]=box[c.f.used_vars[j]];
+		CPPUNIT_ASSERT(c.local->f.eval_domain(x)==c.f.eval_domain(box));
+	}
+
+	CtcHC4 hc4_1(sys1);
+	CtcHC4 hc4_2(sys2);
+	IntervalVector box1(sys1.box);
+	IntervalVector box2(sys2.box);
+	hc4_1.contract(box1);
+	hc4_2.contract(box2);
+	CPPUNIT_ASSERT(box1==box2);
+}
+
+void TestSystem::threads01() {
+	System sys1(SRCDIR_TESTS "/minibex/bearing.bch");
+	SystemFactory::default_nb_threads=4;
+	System sys2(SRCDIR_TESTS "/minibex/bearing.bch");
+	SystemFactory::default_nb_threads=1;
+
+	CPPUNIT_ASSERT(sys2.nb_ctr==sys1.nb_ctr);
+
+	IntervalVector box(sys1.nb_var,Interval(1,2));
+
+	for (int i=0; i<sys1.nb_ctr; i++) {
+		CPPUNIT_ASSERT(sys2.ctrs[i].op==sys1.ctrs[i].op);
+		CPPUNIT_ASSERT(sys2.ctrs[i].f.expr().size==sys1.ctrs[i].f.expr().size);
+		CPPUNIT_ASSERT(sys2.ctrs[i].f.eval_domain(box)==sys1.ctrs[i].f.eval_domain(box));
+		CPPUNIT_ASSERT(sys2.ctrs[i].f.gradient(box)==sys1.ctrs[i].f.gradient(box));
+	}
+}
+
+void TestSystem::threads02() {
+	const int n=50;
+	Variable x(n,"x");
+
+	SystemFactory fac;
+	fac.add_var(x);
+	for (int i=0; i<n-1; i++)
+		fac.add_ctr(i%2==0? ExprCtr(sqr(x[i])-x[i+1],EQ) : ExprCtr(x[i]+x[i+1]+0*x[0],LEQ));
+	fac.set_nb_threads(3);
+	System sys(fac);
+
+	CPPUNIT_ASSERT(sys.nb_ctr==n-1);
+
+	IntervalVector box(n,Interval(1,2));
+	for (int i=0; i<n-1; i++) {
+		CPPUNIT_ASSERT(sys.ctrs[i].op==(i%2==0? EQ : LEQ));
+		CPPUNIT_ASSERT(sys.ctrs[i].f.eval(box)==(i%2==0? Interval(-1,3) : Interval(2,4)));
+		// the constraints are simplified (0*x[0] is removed)
+		CPPUNIT_ASSERT(sys.ctrs[i].f.used_vars.size()==2);
+	}
+
+	// the names are generated in the order of the constraints
+	for (int i=1; i<n-1; i++)
+		CPPUNIT_ASSERT(atoi(sys.ctrs[i].f.name+3)>atoi(sys.ctrs[i-1].f.name+3));
+}
+
 } // end namespace
@@ -36,6 +36,7 @@ public:
 	CPPUNIT_TEST(eq_only01);
 	//		CPPUNIT_TEST(normalize01);
 	//		CPPUNIT_TEST(normalize02);
+	CPPUNIT_TEST(normalize03);
 	CPPUNIT_TEST(extend01);
 	CPPUNIT_TEST(extend02);
 	//		CPPUNIT_TEST(extend02);
@@ -43,6 +44,11 @@ public:
 	CPPUNIT_TEST(merge02);
 	CPPUNIT_TEST(merge03);
 	CPPUNIT_TEST(merge04);
+	CPPUNIT_TEST(save01);
+	CPPUNIT_TEST(save02);
+	CPPUNIT_TEST(sparse01);
+	CPPUNIT_TEST(threads01);
+	CPPUNIT_TEST(threads02);
 	CPPUNIT_TEST_SUITE_END();
 
 	void factory01();
@@ -53,6 +59,7 @@ public:
 	void eq_only01();
 	void normalize01();
 	void normalize02();
+	void normalize03();
 	void extend01();
 	void extend02();
 //	void extend02();
@@ -60,6 +67,11 @@ public:
 	void merge02();
 	void merge03();
 	void merge04();
+	void save01();
+	void save02();
+	void sparse01();
+	void threads01();
+	void threads02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestSystem);
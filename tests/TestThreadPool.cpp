@@ -0,0 +1,64 @@
+/* ============================================================================
+ * I B E X - ThreadPool Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestThreadPool.h"
+
+#include <stdexcept>
+
+using namespace std;
+
+namespace ibex {
+
+void TestThreadPool::tasks() {
+	ThreadPool pool(3);
+
+	// each task writes its own cell
+	vector<int> thread_of(100,-1);
+	vector<future<void> > done;
+	for (int i=0; i<100; i++)
+		done.push_back(pool.submit([i,&thread_of](int k) { thread_of[i]=k; }));
+
+	for (int i=0; i<100; i++) {
+		done[i].get();
+		CPPUNIT_ASSERT(thread_of[i]>=1 && thread_of[i]<=2);
+	}
+}
+
+void TestThreadPool::no_thread() {
+	ThreadPool pool(1);
+
+	int thread_of=-1;
+	future<void> done=pool.submit([&thread_of](int k) { thread_of=k; });
+
+	// run immediately by the calling thread
+	CPPUNIT_ASSERT(thread_of==0);
+	done.get();
+}
+
+void TestThreadPool::exception() {
+	ThreadPool pool(2);
+
+	future<void> done=pool.submit([](int) { throw runtime_error("task"); });
+
+	bool caught=false;
+	try {
+		done.get();
+	} catch(runtime_error&) {
+		caught=true;
+	}
+	CPPUNIT_ASSERT(caught);
+
+	// the thread survives the exception
+	int thread_of=-1;
+	pool.submit([&thread_of](int k) { thread_of=k; }).get();
+	CPPUNIT_ASSERT(thread_of==1);
+}
+
+} // end namespace ibex
@@ -0,0 +1,41 @@
+/* ============================================================================
+ * I B E X - ThreadPool Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_THREAD_POOL_H__
+#define __TEST_THREAD_POOL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "ibex_ThreadPool.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestThreadPool : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestThreadPool);
+	CPPUNIT_TEST(tasks);
+	CPPUNIT_TEST(no_thread);
+	CPPUNIT_TEST(exception);
+	CPPUNIT_TEST_SUITE_END();
+
+	void tasks();
+	void no_thread();
+	void exception();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestThreadPool);
+
+} // namespace ibex
+
+#endif // __TEST_THREAD_POOL_H__
@@ -134,4 +134,28 @@ void TestTimer::test03() {
 
 }
 
+void TestTimer::cancellation() {
+	Cancellation token(4);
+	CPPUNIT_ASSERT(!token.poll());
+	CPPUNIT_ASSERT(token.remaining()==POS_INFINITY);
+
+	token.cancel();
+	CPPUNIT_ASSERT(token.cancelled());
+	CPPUNIT_ASSERT(token.poll());
+	CPPUNIT_ASSERT(!token.expired());
+
+	token.reset();
+	CPPUNIT_ASSERT(!token.poll());
+
+	token.set_deadline(0.01);
+	CPPUNIT_ASSERT(token.remaining()<=0.01);
+	while (!token.poll()) { } // the clock is read every 4 polls
+	CPPUNIT_ASSERT(token.expired());
+	CPPUNIT_ASSERT(token.cancelled());
+	CPPUNIT_ASSERT(token.remaining()==0);
+
+	token.reset();
+	CPPUNIT_ASSERT(!token.cancelled() && !token.expired());
+}
+
 } // end namespace
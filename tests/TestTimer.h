@@ -15,6 +15,7 @@
 #include <cppunit/TestFixture.h>
 #include <cppunit/extensions/HelperMacros.h>
 #include "ibex_Timer.h"
+#include "ibex_Cancellation.h"
 #include "utils.h"
 
 namespace ibex {
@@ -29,11 +30,13 @@ public:
 		CPPUNIT_TEST(test01);
 		CPPUNIT_TEST(test02);
 		CPPUNIT_TEST(test03);
+		CPPUNIT_TEST(cancellation);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
 	void test02();
 	void test03();
+	void cancellation();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestTimer);